@@ -0,0 +1,76 @@
+/*************************************************************************\
+* EPICS BASE is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+
+/*
+ * Shared memory transport for CA circuits between processes on one host.
+ *
+ * A segment holds one byte ring for each direction.  The circuit's TCP
+ * socket stays open: a reader with an empty ring arms its waiting flag
+ * and blocks in recv(), and the writer which clears that flag sends it
+ * a single wakeup byte.  A closed socket still means a lost circuit.
+ *
+ * The IOC creates the segment with caShmCreate() and the client maps it
+ * with caShmAttach(), see CA_PROTO_SHM in caProto.h.
+ */
+
+#ifndef INC_caShm_H
+#define INC_caShm_H
+
+#include "libCaAPI.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Segment names fit in this, the CA_PROTO_SHM offer payload */
+#define CA_SHM_NAME_SIZE 32u
+
+typedef struct caShm caShm;
+
+/* Nonzero if this target can use the shared memory transport */
+LIBCA_API int caShmSupported ( void );
+
+/*
+ * Create a segment with rings of at least ringSize bytes, for the
+ * server end.  Only the owner of the process may map it.
+ */
+LIBCA_API caShm * caShmCreate ( unsigned ringSize );
+/*
+ * Map a segment created by caShmCreate(), for the client end, and
+ * remove its name
+ */
+LIBCA_API caShm * caShmAttach ( const char *pName );
+/* Remove the name of a created segment if caShmAttach() didn't */
+LIBCA_API void caShmUnlink ( caShm * );
+LIBCA_API void caShmDestroy ( caShm * );
+
+LIBCA_API const char * caShmName ( const caShm * );
+LIBCA_API unsigned caShmRingSize ( const caShm * );
+
+/*
+ * Copy up to nBytes into the ring to the peer, returns the bytes
+ * copied, zero while the ring is full.  Sets *pWakeup when the
+ * peer waits for a wakeup byte on the socket.
+ */
+LIBCA_API unsigned caShmWrite ( caShm *, const void *pBuf,
+    unsigned nBytes, int *pWakeup );
+/* Copy up to nBytes from the ring from the peer, zero if it is empty */
+LIBCA_API unsigned caShmRead ( caShm *, void *pBuf, unsigned nBytes );
+/* Bytes waiting in the ring from the peer */
+LIBCA_API unsigned caShmPending ( const caShm * );
+/*
+ * Before waiting for a wakeup byte, polls briefly on hosts with several
+ * CPUs.  Returns nonzero if bytes have arrived meanwhile and the reader
+ * must not wait.
+ */
+LIBCA_API int caShmWaitArm ( caShm * );
+/* Wait for space in a full ring, longer as attempt increases */
+LIBCA_API void caShmBackoff ( unsigned attempt );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ifndef INC_caShm_H */
@@ -0,0 +1,49 @@
+/*************************************************************************\
+* EPICS BASE is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+
+/* Monitor path latency tracing, active while dbLatencyTracing is set */
+
+#ifndef INC_dbLatency_H
+#define INC_dbLatency_H
+
+#include "epicsTypes.h"
+#include "shareLib.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* The stages of a monitor update, each sample is an interval
+ * of epicsMonotonicGet() times
+ */
+typedef enum {
+    dbLatPost,      /* db_post_events() queueing an update for all monitors */
+    dbLatQueue,     /* from db_post_events() until the event task takes it */
+    dbLatSerialize, /* server copying one update into its send buffer */
+    dbLatSend,      /* server sending buffers holding updates */
+    dbLatTotal,     /* from db_post_events() until the update was sent */
+    dbLatNStages
+} dbLatStage;
+
+/* Samples kept for each thread, the older ones are overwritten */
+#define DBLAT_RING_SIZE 2048
+
+epicsShareExtern int dbLatencyTracing;
+
+/* Record one sample in the ring of the calling thread */
+epicsShareFunc void dbLatencySample(dbLatStage stage,
+    epicsUInt64 start, epicsUInt64 end);
+
+/* Show the latency percentiles of each stage */
+epicsShareFunc long dbLatencyShow(void);
+/* Write the samples as Chrome trace event JSON */
+epicsShareFunc long dbLatencyDump(const char *file);
+epicsShareFunc void dbLatencyReset(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* INC_dbLatency_H */
@@ -0,0 +1,82 @@
+/*************************************************************************\
+* Copyright (c) 2002 The University of Chicago, as Operator of Argonne
+*     National Laboratory.
+* Copyright (c) 2002 The Regents of the University of California, as
+*     Operator of Los Alamos National Laboratory.
+* SPDX-License-Identifier: EPICS
+* EPICS Base is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+/* dbLock.h */
+/*      Author: Marty Kraimer   Date: 12MAR96   */
+
+#ifndef INCdbLockh
+#define INCdbLockh
+
+#include <stddef.h>
+
+#include "ellLib.h"
+#include "shareLib.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct dbCommon;
+struct dbBase;
+typedef struct dbLocker dbLocker;
+
+epicsShareFunc void dbScanLock(struct dbCommon *precord);
+epicsShareFunc void dbScanUnlock(struct dbCommon *precord);
+
+/* Shared locking for callers which only read from the lock set.
+ * Exclusive unless dbLockSharedReaders was set before iocInit.
+ * Must not be nested, or followed by dbScanLock() of the same lock set.
+ */
+epicsShareFunc void dbScanLockRead(struct dbCommon *precord);
+epicsShareFunc void dbScanUnlockRead(struct dbCommon *precord);
+epicsShareExtern int dbLockSharedReaders;
+
+epicsShareFunc dbLocker *dbLockerAlloc(struct dbCommon * const *precs,
+                                       size_t nrecs,
+                                       unsigned int flags);
+
+epicsShareFunc void dbLockerFree(dbLocker *);
+
+epicsShareFunc void dbScanLockMany(dbLocker*);
+epicsShareFunc void dbScanUnlockMany(dbLocker*);
+
+epicsShareFunc unsigned long dbLockGetLockId(
+    struct dbCommon *precord);
+
+epicsShareFunc void dbLockInitRecords(struct dbBase *pdbbase);
+epicsShareFunc void dbLockCleanupRecords(struct dbBase *pdbbase);
+
+
+/* Lock Set Report */
+epicsShareFunc long dblsr(char *recordname,int level);
+/* If recordname NULL then all records*/
+/* level = (0,1,2) (lock set state, + recordname, +DB links) */
+
+epicsShareFunc long dbLockShowLocked(int level);
+
+/* Lock set contention profile, collected while dbLockProfiling is set.
+ * Show the count busiest lock sets, sorted by "wait", "hold" (the
+ * default), "max" hold time or "locks".
+ */
+epicsShareExtern int dbLockProfiling;
+epicsShareFunc long dbLockShowProfile(int count, const char *sortby);
+epicsShareFunc void dbLockResetProfile(void);
+
+/*KLUDGE to support field TPRO*/
+epicsShareFunc int * dbLockSetAddrTrace(struct dbCommon *precord);
+
+/* debugging */
+epicsShareFunc unsigned long dbLockGetRefs(struct dbCommon*);
+epicsShareFunc unsigned long dbLockCountSets(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /*INCdbLockh*/
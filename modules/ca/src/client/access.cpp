@@ -296,22 +296,7 @@ int epicsStdCall ca_create_channel (
         return caStatus;
     }
 
-    {
-        CAFDHANDLER * pFunc = 0;
-        void * pArg = 0;
-        {
-            epicsGuard < epicsMutex >
-                guard ( pcac->mutex );
-            if ( pcac->fdRegFuncNeedsToBeCalled ) {
-                pFunc = pcac->fdRegFunc;
-                pArg = pcac->fdRegArg;
-                pcac->fdRegFuncNeedsToBeCalled = false;
-            }
-        }
-        if ( pFunc ) {
-            ( *pFunc ) ( pArg, pcac->sock, true );
-        }
-    }
+    pcac->fdRegFuncCall ();
 
     try {
         epicsGuard < epicsMutex > guard ( pcac->mutex );
@@ -353,6 +338,94 @@ int epicsStdCall ca_create_channel (
     return ECA_NORMAL;
 }
 
+/*
+ *  ca_create_channels ()
+ *
+ * All arguments are checked before the first channel is created, and the
+ * channels already created are cleared again if a later one fails.
+ */
+// extern "C"
+int epicsStdCall ca_create_channels (
+     unsigned count, const char * const * names, caCh * conn_func,
+     void * const * pusers, capri priority, chid * chanptrs )
+{
+    if ( count == 0u ) {
+        return ECA_NORMAL;
+    }
+    if ( ! names ) {
+        return ECA_BADSTR;
+    }
+    if ( ! chanptrs ) {
+        return ECA_BADCHID;
+    }
+    if ( priority > CA_PRIORITY_MAX ) {
+        return ECA_BADPRIORITY;
+    }
+    for ( unsigned i = 0u; i < count; i++ ) {
+        if ( ! names[i] || names[i][0] == '\0' ) {
+            return ECA_BADSTR;
+        }
+    }
+
+    ca_client_context * pcac;
+    int caStatus = fetchClientContext ( & pcac );
+    if ( caStatus != ECA_NORMAL ) {
+        return caStatus;
+    }
+
+    pcac->fdRegFuncCall ();
+
+    unsigned nCreated = 0u;
+    try {
+        epicsGuard < epicsMutex > guard ( pcac->mutex );
+        pcac->reserveChannels ( guard, count );
+        while ( nCreated < count ) {
+            oldChannelNotify * pChanNotify =
+                new ( pcac->oldChannelNotifyFreeList )
+                    oldChannelNotify ( guard, *pcac, names[nCreated],
+                        conn_func, pusers ? pusers[nCreated] : 0,
+                        priority );
+            // make sure that their chan pointer is set prior to
+            // calling connection call backs
+            chanptrs[nCreated++] = pChanNotify;
+            pChanNotify->initiateConnect ( guard );
+        }
+    }
+    catch ( cacChannel::badString & ) {
+        caStatus = ECA_BADSTR;
+    }
+    catch ( std::bad_alloc & ) {
+        caStatus = ECA_ALLOCMEM;
+    }
+    catch ( cacChannel::badPriority & ) {
+        caStatus = ECA_BADPRIORITY;
+    }
+    catch ( cacChannel::unsupportedByService & ) {
+        caStatus = ECA_UNAVAILINSERV;
+    }
+    catch ( std :: exception & except ) {
+        pcac->printFormated (
+            "ca_create_channels: "
+            "unexpected exception was \"%s\"",
+            except.what () );
+        caStatus = ECA_INTERNAL;
+    }
+    catch ( ... ) {
+        caStatus = ECA_INTERNAL;
+    }
+
+    if ( caStatus != ECA_NORMAL ) {
+        while ( nCreated > 0u ) {
+            ca_clear_channel ( chanptrs[--nCreated] );
+        }
+        for ( unsigned i = 0u; i < count; i++ ) {
+            chanptrs[i] = 0;
+        }
+    }
+
+    return caStatus;
+}
+
 /*
  *  ca_clear_channel ()
  *
@@ -677,6 +677,70 @@ void verifyBlockingConnect ( appChan *pChans, unsigned chanCount,
     showProgressEnd ( interestLevel );
 }
 
+/*
+ * verifyBulkConnect ()
+ *
+ * 1) verify that ca_create_channels() connects all of the channels
+ * and that ca_pend_io() waits for them
+ *
+ * 2) verify that the user private pointers are installed
+ *
+ * 3) verify that nothing is created when one of the names is bad
+ */
+void verifyBulkConnect ( appChan *pChans, unsigned chanCount,
+                            unsigned interestLevel )
+{
+    const char **pNames;
+    void **pUsers;
+    chid *pChids;
+    int status;
+    unsigned j;
+
+    showProgressBegin ( "verifyBulkConnect", interestLevel );
+
+    pNames = calloc ( chanCount, sizeof ( *pNames ) );
+    pUsers = calloc ( chanCount, sizeof ( *pUsers ) );
+    pChids = calloc ( chanCount, sizeof ( *pChids ) );
+    verify ( pNames && pUsers && pChids );
+
+    for ( j = 0u; j < chanCount; j++ ) {
+        pNames[j] = pChans[j].name;
+        pUsers[j] = &pChans[j];
+    }
+
+    status = ca_create_channels ( chanCount, pNames, NULL, pUsers,
+        CA_PRIORITY_DEFAULT, pChids );
+    SEVCHK ( status, NULL );
+
+    status = ca_pend_io ( timeoutToPendIO );
+    SEVCHK ( status, NULL );
+
+    verify ( ca_test_io () == ECA_IODONE );
+
+    for ( j = 0u; j < chanCount; j++ ) {
+        verify ( ca_state ( pChids[j] ) == cs_conn );
+        verify ( ca_puser ( pChids[j] ) == &pChans[j] );
+        verify ( strcmp ( ca_name ( pChids[j] ), pChans[j].name ) == 0 );
+        SEVCHK ( ca_clear_channel ( pChids[j] ), NULL );
+    }
+
+    showProgress ( interestLevel );
+
+    if ( chanCount > 1u ) {
+        pNames[chanCount - 1u] = "";
+        status = ca_create_channels ( chanCount, pNames, NULL, NULL,
+            CA_PRIORITY_DEFAULT, pChids );
+        verify ( status == ECA_BADSTR );
+        verify ( ca_test_io () == ECA_IODONE );
+    }
+
+    free ( pNames );
+    free ( pUsers );
+    free ( pChids );
+
+    showProgressEnd ( interestLevel );
+}
+
 /*
  * 1) verify that use of NULL evid does not cause problems
  * 2) verify clear before connect
@@ -3513,6 +3577,7 @@ int acctst ( const char * pName, unsigned interestLevel, unsigned channelCount,
 
     verifyConnectionHandlerConnect ( pChans, channelCount, repetitionCount, interestLevel );
     verifyBlockingConnect ( pChans, channelCount, repetitionCount, interestLevel );
+    verifyBulkConnect ( pChans, channelCount, interestLevel );
     verifyClear ( pChans, interestLevel );
 
     verifyReasonableBeaconPeriod ( chan, interestLevel );
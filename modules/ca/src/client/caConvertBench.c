@@ -0,0 +1,150 @@
+/*************************************************************************\
+* EPICS Base is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+
+/*
+ *  caConvertBench - time the CA wire format conversion of arrays
+ *
+ *  Each plain array type is converted in both directions at the given
+ *  element count, and the time taken per element printed next to that
+ *  of copying the array.  That the conversions are correct is checked
+ *  by caConvertTest.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "dbDefs.h"
+#include "epicsGetopt.h"
+#include "epicsStdlib.h"
+#include "epicsTime.h"
+
+#include "db_access.h"
+#include "net_convert.h"
+
+static const unsigned timeTypes[] = {
+    DBR_SHORT, DBR_FLOAT, DBR_LONG, DBR_DOUBLE
+};
+
+static void usage ( void )
+{
+    printf ( "usage: caConvertBench [options]\n"
+        "  -n count        elements in each array timed (65536)\n"
+        "  -t sec          time spent converting each type (0.5)\n" );
+}
+
+/*
+ * Host format values which survive the trip through a
+ * floating point register unchanged
+ */
+static void fill ( unsigned type, void *pBuf, unsigned long count )
+{
+    char *pValue = ( char * ) pBuf + dbr_value_offset[type];
+    unsigned long i;
+
+    memset ( pBuf, 0x5a, dbr_size_n ( type, count ) );
+    for ( i = 0; i < count; i++ ) {
+        switch ( type % ( LAST_TYPE + 1 ) ) {
+        case DBR_FLOAT:
+            ( ( dbr_float_t * ) pValue )[i] = i * 0.75f - 1000.125f;
+            break;
+        case DBR_DOUBLE:
+            ( ( dbr_double_t * ) pValue )[i] = i * 1.0e-3 - 3.0e5;
+            break;
+        case DBR_LONG:
+            ( ( dbr_long_t * ) pValue )[i] = ( dbr_long_t ) ( i * 2654435761u );
+            break;
+        default:
+            ( ( dbr_short_t * ) pValue )[i] = ( dbr_short_t ) ( i * 40503u );
+            break;
+        }
+    }
+}
+
+/* returns nano-seconds per element, of copying if not convert */
+static double timeIt ( unsigned type, unsigned long count,
+    const char *pSrc, char *pDest, double duration, int convert )
+{
+    size_t size = dbr_size_n ( type, count );
+    epicsTimeStamp start, now;
+    unsigned long reps = 0u;
+    double elapsed;
+
+    epicsTimeGetCurrent ( &start );
+    do {
+        unsigned i;
+        for ( i = 0u; i < 16u; i++ ) {
+            if ( convert ) {
+                caNetConvert ( type, pSrc, pDest, reps & 1u, count );
+            }
+            else {
+                memcpy ( pDest, pSrc, size );
+            }
+            reps++;
+        }
+        epicsTimeGetCurrent ( &now );
+        elapsed = epicsTimeDiffInSeconds ( &now, &start );
+    } while ( elapsed < duration );
+
+    return elapsed * 1e9 / ( ( double ) reps * count );
+}
+
+int main ( int argc, char **argv )
+{
+    unsigned long count = 65536u;
+    double duration = 0.5;
+    char *pBuf[2];
+    unsigned i;
+    int opt;
+
+    while ( ( opt = getopt ( argc, argv, "n:t:h" ) ) != -1 ) {
+        switch ( opt ) {
+        case 'n':
+            if ( epicsParseULong ( optarg, &count, 0, NULL ) || count == 0u ) {
+                fprintf ( stderr, "bad element count \"%s\"\n", optarg );
+                return 1;
+            }
+            break;
+        case 't':
+            if ( epicsParseDouble ( optarg, &duration, NULL ) ) {
+                fprintf ( stderr, "bad duration \"%s\"\n", optarg );
+                return 1;
+            }
+            break;
+        case 'h':
+            usage ();
+            return 0;
+        default:
+            usage ();
+            return 1;
+        }
+    }
+
+    for ( i = 0u; i < NELEMENTS ( pBuf ); i++ ) {
+        pBuf[i] = malloc ( dbr_size_n ( DBR_DOUBLE, count ) );
+        if ( ! pBuf[i] ) {
+            fprintf ( stderr, "no memory for %lu elements\n", count );
+            return 1;
+        }
+    }
+
+    printf ( "%lu elements, ns per element:\n", count );
+    printf ( "%-16s %10s %10s %8s\n", "", "convert", "copy", "ratio" );
+    for ( i = 0u; i < NELEMENTS ( timeTypes ); i++ ) {
+        unsigned type = timeTypes[i];
+        double convert, copy;
+
+        fill ( type, pBuf[0], count );
+        convert = timeIt ( type, count, pBuf[0], pBuf[1], duration, 1 );
+        copy = timeIt ( type, count, pBuf[0], pBuf[1], duration, 0 );
+        printf ( "%-16s %10.3f %10.3f %7.1fx\n", dbr_type_to_text ( type ),
+            convert, copy, convert / copy );
+    }
+
+    for ( i = 0u; i < NELEMENTS ( pBuf ); i++ ) {
+        free ( pBuf[i] );
+    }
+    return 0;
+}
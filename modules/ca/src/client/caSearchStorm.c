@@ -0,0 +1,328 @@
+/*************************************************************************\
+* EPICS Base is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+
+/*
+ *  caSearchStorm - replay a CA name search storm against a server
+ *
+ *  The names are searched for from several UDP sockets at once, packed
+ *  into datagrams as libca does, as fast as the sockets accept them.
+ *  Replies are counted until none has arrived for the timeout.  Point
+ *  it at an IOC on this host to measure its search throughput without
+ *  any network in between.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "dbDefs.h"
+#include "envDefs.h"
+#include "epicsGetopt.h"
+#include "epicsStdlib.h"
+#include "epicsThread.h"
+#include "epicsTime.h"
+#include "osiSock.h"
+
+#include "caProto.h"
+
+#define MINOR_PROTOCOL_REVISION 13
+#define MAX_DATAGRAM 1024u
+
+static char **names;
+static unsigned nnames;
+static unsigned char *found;
+
+static SOCKET *socks;
+static epicsUInt32 nsocks;
+
+static unsigned long nreplies;
+static epicsTimeStamp lastReply;
+
+static void usage ( void )
+{
+    printf ( "usage: caSearchStorm [options] [-f file] [name ...]\n"
+        "  -a host[:port]  server to search (127.0.0.1 at EPICS_CA_SERVER_PORT)\n"
+        "  -c count        number of client sockets (10)\n"
+        "  -p count        names per datagram, at most (64)\n"
+        "  -r count        times to search for every name (1)\n"
+        "  -t sec          wait for replies until none for sec (1.0)\n"
+        "  -f file         names to search for, one per line\n" );
+}
+
+static void addName ( const char *pName )
+{
+    size_t len = strlen ( pName );
+
+    if ( len == 0u || len + 1u + 2u * sizeof ( caHdr ) > MAX_DATAGRAM ) {
+        return;
+    }
+    if ( ( nnames & 0xffu ) == 0u ) {
+        char **pnew = realloc ( names, ( nnames + 0x100u ) * sizeof ( *names ) );
+        if ( ! pnew ) {
+            fprintf ( stderr, "caSearchStorm: out of memory\n" );
+            exit ( 1 );
+        }
+        names = pnew;
+    }
+    names[nnames] = malloc ( len + 1u );
+    if ( ! names[nnames] ) {
+        fprintf ( stderr, "caSearchStorm: out of memory\n" );
+        exit ( 1 );
+    }
+    strcpy ( names[nnames++], pName );
+}
+
+static int readNames ( const char *pFile )
+{
+    char line[256];
+    FILE *fp = fopen ( pFile, "r" );
+
+    if ( ! fp ) {
+        fprintf ( stderr, "caSearchStorm: can't open \"%s\"\n", pFile );
+        return -1;
+    }
+    while ( fgets ( line, sizeof ( line ), fp ) ) {
+        char *pName = line;
+        char *pEnd;
+
+        while ( *pName == ' ' || *pName == '\t' ) {
+            pName++;
+        }
+        pEnd = pName + strcspn ( pName, " \t\r\n" );
+        *pEnd = '\0';
+        if ( *pName && *pName != '#' ) {
+            addName ( pName );
+        }
+    }
+    fclose ( fp );
+    return 0;
+}
+
+static void putHeader ( char *pBuf, unsigned cmmd, unsigned postsize,
+    unsigned dataType, unsigned count, unsigned cid, unsigned available )
+{
+    caHdr hdr;
+
+    hdr.m_cmmd = htons ( (ca_uint16_t) cmmd );
+    hdr.m_postsize = htons ( (ca_uint16_t) postsize );
+    hdr.m_dataType = htons ( (ca_uint16_t) dataType );
+    hdr.m_count = htons ( (ca_uint16_t) count );
+    hdr.m_cid = htonl ( cid );
+    hdr.m_available = htonl ( available );
+    memcpy ( pBuf, &hdr, sizeof ( hdr ) );
+}
+
+/*
+ * Count the search replies waiting on all sockets
+ */
+static void drain ( void )
+{
+    char buf[0x4000];
+    unsigned i;
+
+    for ( i = 0u; i < nsocks; i++ ) {
+        while ( TRUE ) {
+            int status = recv ( socks[i], buf, sizeof ( buf ), 0 );
+            unsigned pos = 0u;
+
+            if ( status < 0 ) {
+                break;
+            }
+            while ( pos + sizeof ( caHdr ) <= (unsigned) status ) {
+                caHdr hdr;
+
+                memcpy ( &hdr, &buf[pos], sizeof ( hdr ) );
+                if ( ntohs ( hdr.m_cmmd ) == CA_PROTO_SEARCH ) {
+                    ca_uint32_t id = ntohl ( hdr.m_available );
+
+                    nreplies++;
+                    if ( id < nnames ) {
+                        found[id] = 1u;
+                    }
+                    epicsTimeGetCurrent ( &lastReply );
+                }
+                pos += sizeof ( caHdr ) + ntohs ( hdr.m_postsize );
+            }
+        }
+    }
+}
+
+static void sendDatagram ( SOCKET sock, const osiSockAddr *pAddr,
+    const char *pBuf, unsigned size )
+{
+    while ( sendto ( sock, pBuf, size, 0, &pAddr->sa,
+                sizeof ( pAddr->ia ) ) < 0 ) {
+        int err = SOCKERRNO;
+
+        if ( err != SOCK_EWOULDBLOCK && err != SOCK_ENOBUFS &&
+                err != SOCK_EINTR ) {
+            char sockErrBuf[64];
+            epicsSocketConvertErrnoToString (
+                sockErrBuf, sizeof ( sockErrBuf ) );
+            fprintf ( stderr, "caSearchStorm: send failed: %s\n", sockErrBuf );
+            exit ( 1 );
+        }
+        drain ();
+        epicsThreadSleep ( 0.0 );
+    }
+}
+
+int main ( int argc, char **argv )
+{
+    const char *pServer = NULL;
+    osiSockAddr addr;
+    epicsUInt32 perDatagram = 64u;
+    epicsUInt32 rounds = 1u;
+    double timeout = 1.0;
+    unsigned long ndatagrams = 0u, nsearches = 0u;
+    unsigned i, round, nfound;
+    epicsTimeStamp start, now;
+    char buf[MAX_DATAGRAM];
+    int opt;
+
+    nsocks = 10u;
+
+    while ( ( opt = getopt ( argc, argv, ":a:c:p:r:t:f:h" ) ) != -1 ) {
+        switch ( opt ) {
+        case 'a':
+            pServer = optarg;
+            break;
+        case 'c':
+            if ( epicsParseUInt32 ( optarg, &nsocks, 0, NULL ) || ! nsocks ) {
+                usage ();
+                return 1;
+            }
+            break;
+        case 'p':
+            if ( epicsParseUInt32 ( optarg, &perDatagram, 0, NULL ) || ! perDatagram ) {
+                usage ();
+                return 1;
+            }
+            break;
+        case 'r':
+            if ( epicsParseUInt32 ( optarg, &rounds, 0, NULL ) || ! rounds ) {
+                usage ();
+                return 1;
+            }
+            break;
+        case 't':
+            if ( epicsParseDouble ( optarg, &timeout, NULL ) ) {
+                usage ();
+                return 1;
+            }
+            break;
+        case 'f':
+            if ( readNames ( optarg ) ) {
+                return 1;
+            }
+            break;
+        case 'h':
+        default:
+            usage ();
+            return opt == 'h' ? 0 : 1;
+        }
+    }
+    for ( ; optind < argc; optind++ ) {
+        addName ( argv[optind] );
+    }
+    if ( ! nnames ) {
+        usage ();
+        return 1;
+    }
+
+    osiSockAttach ();
+
+    memset ( &addr, 0, sizeof ( addr ) );
+    if ( aToIPAddr ( pServer ? pServer : "127.0.0.1",
+            envGetInetPortConfigParam ( &EPICS_CA_SERVER_PORT,
+                (unsigned short) CA_SERVER_PORT ), &addr.ia ) ) {
+        fprintf ( stderr, "caSearchStorm: bad address \"%s\"\n", pServer );
+        return 1;
+    }
+
+    found = calloc ( nnames, 1u );
+    socks = calloc ( nsocks, sizeof ( *socks ) );
+    if ( ! found || ! socks ) {
+        fprintf ( stderr, "caSearchStorm: out of memory\n" );
+        return 1;
+    }
+    for ( i = 0u; i < nsocks; i++ ) {
+        osiSockIoctl_t yes = TRUE;
+
+        socks[i] = epicsSocketCreate ( AF_INET, SOCK_DGRAM, IPPROTO_UDP );
+        if ( socks[i] == INVALID_SOCKET ||
+                socket_ioctl ( socks[i], FIONBIO, &yes ) < 0 ) {
+            fprintf ( stderr, "caSearchStorm: can't create socket %u\n", i );
+            return 1;
+        }
+    }
+
+    epicsTimeGetCurrent ( &start );
+    lastReply = start;
+
+    for ( round = 0u; round < rounds; round++ ) {
+        unsigned next = 0u;
+
+        while ( next < nnames ) {
+            unsigned size = sizeof ( caHdr );
+            unsigned n = 0u;
+
+            putHeader ( buf, CA_PROTO_VERSION, 0u, 0u,
+                MINOR_PROTOCOL_REVISION, (unsigned) ndatagrams, 0u );
+            while ( next < nnames && n < perDatagram ) {
+                size_t len = strlen ( names[next] ) + 1u;
+                unsigned postsize = CA_MESSAGE_ALIGN ( len );
+
+                if ( size + sizeof ( caHdr ) + postsize > sizeof ( buf ) ) {
+                    break;
+                }
+                putHeader ( &buf[size], CA_PROTO_SEARCH, postsize, DONTREPLY,
+                    MINOR_PROTOCOL_REVISION, next, next );
+                size += sizeof ( caHdr );
+                memset ( &buf[size], 0, postsize );
+                memcpy ( &buf[size], names[next], len );
+                size += postsize;
+                next++;
+                n++;
+            }
+            sendDatagram ( socks[ndatagrams % nsocks], &addr, buf, size );
+            ndatagrams++;
+            nsearches += n;
+            if ( ( ndatagrams % nsocks ) == 0u ) {
+                drain ();
+            }
+        }
+    }
+
+    do {
+        drain ();
+        epicsThreadSleep ( 0.001 );
+        epicsTimeGetCurrent ( &now );
+    } while ( epicsTimeDiffInSeconds ( &now, &lastReply ) < timeout );
+
+    for ( i = 0u, nfound = 0u; i < nnames; i++ ) {
+        nfound += found[i];
+    }
+
+    {
+        double elapsed = epicsTimeDiffInSeconds ( &lastReply, &start );
+
+        printf ( "%lu searches in %lu datagrams from %u sockets\n",
+            nsearches, ndatagrams, nsocks );
+        printf ( "%lu replies, %u of %u names found\n",
+            nreplies, nfound, nnames );
+        if ( nreplies && elapsed > 0.0 ) {
+            printf ( "%.3f sec to the last reply, %.0f searches/sec,"
+                " %.0f replies/sec\n", elapsed, nsearches / elapsed,
+                nreplies / elapsed );
+        }
+    }
+
+    for ( i = 0u; i < nsocks; i++ ) {
+        epicsSocketDestroy ( socks[i] );
+    }
+    osiSockRelease ();
+    return 0;
+}
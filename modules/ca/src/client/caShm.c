@@ -0,0 +1,411 @@
+/*************************************************************************\
+* EPICS BASE is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+
+/*
+ * Shared memory rings for CA circuits on one host, see caShm.h
+ *
+ * Each end only writes its own counter, the head of the ring it sends
+ * on and the tail of the one it receives on.  The counters are kept in
+ * 31 bits and all of the control words are plain ints, so that 32 and
+ * 64 bit processes agree on the layout.  Updating a counter and arming
+ * or clearing a waiting flag are atomic read-modify-write operations,
+ * which are full barriers: a writer which does not see the reader's
+ * waiting flag has published its bytes before the reader looks again.
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+
+#include "dbDefs.h"
+#include "epicsAtomic.h"
+#include "epicsStdio.h"
+#include "epicsThread.h"
+#include "epicsTypes.h"
+#include "errlog.h"
+
+#include "caShm.h"
+
+#if ( defined(__unix__) || defined(__APPLE__) ) && \
+        ! defined(__rtems__) && ! defined(vxWorks) && \
+        defined(EPICS_ATOMIC_CAS_INTT)
+#  include <fcntl.h>
+#  include <unistd.h>
+#  include <sys/mman.h>
+#  include <sys/stat.h>
+#  define CA_SHM_POSIX
+#endif
+
+#ifdef CA_SHM_POSIX
+
+#define CA_SHM_MAGIC 0x43417368u /* "CAsh" */
+#define CA_SHM_LINE 64u /* keep each end's words in its own cache line */
+#define CA_SHM_COUNT_MASK 0x7fffffffu
+#define CA_SHM_MIN_RING ( 1u << 16 )
+#define CA_SHM_MAX_RING ( 1u << 28 )
+
+typedef union caShmWord {
+    int value;
+    char line[CA_SHM_LINE];
+} caShmWord;
+
+typedef struct caShmCtl {
+    caShmWord head;     /* bytes written, by the writer */
+    caShmWord tail;     /* bytes read, by the reader */
+    caShmWord waiting;  /* reader waits for a wakeup byte */
+} caShmCtl;
+
+typedef struct caShmHdr {
+    union {
+        struct {
+            epicsUInt32 magic;
+            epicsUInt32 ringSize;
+        } id;
+        char line[CA_SHM_LINE];
+    } u;
+    caShmCtl ring[2]; /* server to client, client to server */
+} caShmHdr;
+
+struct caShm {
+    caShmHdr *pHdr;
+    size_t mapSize;
+    caShmCtl *pSendCtl, *pRecvCtl;
+    char *pSendData, *pRecvData;
+    unsigned ringSize;
+    unsigned spin;  /* polls of an empty ring before waiting */
+    int linked; /* the name still needs unlinking */
+    char name[CA_SHM_NAME_SIZE];
+};
+
+static size_t caShmMapSize ( unsigned ringSize )
+{
+    return sizeof ( caShmHdr ) + 2u * (size_t) ringSize;
+}
+
+static void caShmSetup ( caShm *pShm, int server )
+{
+    char *pData = (char *) ( pShm->pHdr + 1 );
+    unsigned send = server ? 0u : 1u;
+
+    pShm->pSendCtl = &pShm->pHdr->ring[send];
+    pShm->pRecvCtl = &pShm->pHdr->ring[1u - send];
+    pShm->pSendData = pData + send * pShm->ringSize;
+    pShm->pRecvData = pData + ( 1u - send ) * pShm->ringSize;
+    /* the writer can only fill the ring meanwhile on another CPU */
+    pShm->spin = epicsThreadGetCPUs () > 1 ? 1000u : 0u;
+}
+
+int caShmSupported ( void )
+{
+    return TRUE;
+}
+
+caShm * caShmCreate ( unsigned ringSize )
+{
+    static int serial;
+    unsigned size = CA_SHM_MIN_RING;
+    caShm *pShm;
+    void *pMap;
+    int fd = -1;
+    int i;
+
+    while ( size < ringSize && size < CA_SHM_MAX_RING ) {
+        size <<= 1u;
+    }
+
+    pShm = calloc ( 1, sizeof ( *pShm ) );
+    if ( ! pShm ) {
+        return NULL;
+    }
+    pShm->ringSize = size;
+    pShm->mapSize = caShmMapSize ( size );
+
+    /* a name left over by a process which used our pid is skipped */
+    for ( i = 0; i < 8 && fd < 0; i++ ) {
+        epicsSnprintf ( pShm->name, sizeof ( pShm->name ), "/caShm.%ld.%d",
+            (long) getpid (), epicsAtomicIncrIntT ( &serial ) );
+        fd = shm_open ( pShm->name, O_RDWR | O_CREAT | O_EXCL, 0600 );
+        if ( fd < 0 && errno != EEXIST ) {
+            break;
+        }
+    }
+    if ( fd < 0 ) {
+        errlogPrintf ( "CA shared memory: can't create \"%s\": %s\n",
+            pShm->name, strerror ( errno ) );
+        free ( pShm );
+        return NULL;
+    }
+    if ( ftruncate ( fd, (off_t) pShm->mapSize ) < 0 ) {
+        errlogPrintf ( "CA shared memory: can't size \"%s\": %s\n",
+            pShm->name, strerror ( errno ) );
+        close ( fd );
+        shm_unlink ( pShm->name );
+        free ( pShm );
+        return NULL;
+    }
+    pMap = mmap ( NULL, pShm->mapSize, PROT_READ | PROT_WRITE,
+        MAP_SHARED, fd, 0 );
+    close ( fd );
+    if ( pMap == MAP_FAILED ) {
+        errlogPrintf ( "CA shared memory: can't map \"%s\": %s\n",
+            pShm->name, strerror ( errno ) );
+        shm_unlink ( pShm->name );
+        free ( pShm );
+        return NULL;
+    }
+
+    /* new pages are zero, the rings are empty and nobody waits */
+    pShm->pHdr = (caShmHdr *) pMap;
+    pShm->pHdr->u.id.magic = CA_SHM_MAGIC;
+    pShm->pHdr->u.id.ringSize = size;
+    pShm->linked = TRUE;
+    caShmSetup ( pShm, TRUE );
+    return pShm;
+}
+
+caShm * caShmAttach ( const char *pName )
+{
+    caShm *pShm;
+    struct stat info;
+    caShmHdr *pHdr;
+    void *pMap;
+    int fd;
+
+    if ( strlen ( pName ) >= CA_SHM_NAME_SIZE ) {
+        return NULL;
+    }
+    fd = shm_open ( pName, O_RDWR, 0 );
+    if ( fd < 0 ) {
+        return NULL;
+    }
+    if ( fstat ( fd, &info ) < 0 ||
+            (size_t) info.st_size < sizeof ( caShmHdr ) ) {
+        close ( fd );
+        return NULL;
+    }
+    pMap = mmap ( NULL, (size_t) info.st_size, PROT_READ | PROT_WRITE,
+        MAP_SHARED, fd, 0 );
+    close ( fd );
+    if ( pMap == MAP_FAILED ) {
+        return NULL;
+    }
+
+    pHdr = (caShmHdr *) pMap;
+    if ( pHdr->u.id.magic != CA_SHM_MAGIC ||
+            pHdr->u.id.ringSize < CA_SHM_MIN_RING ||
+            pHdr->u.id.ringSize > CA_SHM_MAX_RING ||
+            ( pHdr->u.id.ringSize & ( pHdr->u.id.ringSize - 1u ) ) ||
+            caShmMapSize ( pHdr->u.id.ringSize ) != (size_t) info.st_size ) {
+        munmap ( pMap, (size_t) info.st_size );
+        return NULL;
+    }
+
+    pShm = calloc ( 1, sizeof ( *pShm ) );
+    if ( ! pShm ) {
+        munmap ( pMap, (size_t) info.st_size );
+        return NULL;
+    }
+    pShm->pHdr = pHdr;
+    pShm->mapSize = (size_t) info.st_size;
+    pShm->ringSize = pHdr->u.id.ringSize;
+    strcpy ( pShm->name, pName );
+    caShmSetup ( pShm, FALSE );
+
+    /* both ends have it mapped, nothing is left in /dev/shm if one dies */
+    shm_unlink ( pName );
+    return pShm;
+}
+
+void caShmUnlink ( caShm *pShm )
+{
+    if ( pShm->linked ) {
+        shm_unlink ( pShm->name );
+        pShm->linked = FALSE;
+    }
+}
+
+void caShmDestroy ( caShm *pShm )
+{
+    if ( ! pShm ) {
+        return;
+    }
+    caShmUnlink ( pShm );
+    munmap ( (void *) pShm->pHdr, pShm->mapSize );
+    free ( pShm );
+}
+
+const char * caShmName ( const caShm *pShm )
+{
+    return pShm->name;
+}
+
+unsigned caShmRingSize ( const caShm *pShm )
+{
+    return pShm->ringSize;
+}
+
+/* Bytes in a ring, a corrupt counter from the peer can't overrun it */
+static unsigned caShmUsed ( const caShm *pShm, unsigned head, unsigned tail )
+{
+    unsigned used = ( head - tail ) & CA_SHM_COUNT_MASK;
+
+    return used < pShm->ringSize ? used : pShm->ringSize;
+}
+
+unsigned caShmWrite ( caShm *pShm, const void *pBuf,
+    unsigned nBytes, int *pWakeup )
+{
+    caShmCtl *pCtl = pShm->pSendCtl;
+    unsigned head = (unsigned) pCtl->head.value;
+    unsigned tail = (unsigned) epicsAtomicGetIntT ( &pCtl->tail.value );
+    unsigned offset, first;
+
+    /* the reader is done with the space before we reuse it */
+    epicsAtomicReadMemoryBarrier ();
+
+    *pWakeup = FALSE;
+    if ( nBytes > pShm->ringSize - caShmUsed ( pShm, head, tail ) ) {
+        nBytes = pShm->ringSize - caShmUsed ( pShm, head, tail );
+    }
+    if ( nBytes == 0u ) {
+        return 0u;
+    }
+
+    offset = head & ( pShm->ringSize - 1u );
+    first = pShm->ringSize - offset;
+    if ( first > nBytes ) {
+        first = nBytes;
+    }
+    memcpy ( pShm->pSendData + offset, pBuf, first );
+    memcpy ( pShm->pSendData, (const char *) pBuf + first, nBytes - first );
+
+    epicsAtomicCmpAndSwapIntT ( &pCtl->head.value, (int) head,
+        (int) ( ( head + nBytes ) & CA_SHM_COUNT_MASK ) );
+    *pWakeup = epicsAtomicCmpAndSwapIntT ( &pCtl->waiting.value, 1, 0 ) == 1;
+    return nBytes;
+}
+
+unsigned caShmRead ( caShm *pShm, void *pBuf, unsigned nBytes )
+{
+    caShmCtl *pCtl = pShm->pRecvCtl;
+    unsigned tail = (unsigned) pCtl->tail.value;
+    unsigned head = (unsigned) epicsAtomicGetIntT ( &pCtl->head.value );
+    unsigned offset, first;
+
+    /* the bytes were written before the head moved */
+    epicsAtomicReadMemoryBarrier ();
+
+    if ( nBytes > caShmUsed ( pShm, head, tail ) ) {
+        nBytes = caShmUsed ( pShm, head, tail );
+    }
+    if ( nBytes == 0u ) {
+        return 0u;
+    }
+
+    offset = tail & ( pShm->ringSize - 1u );
+    first = pShm->ringSize - offset;
+    if ( first > nBytes ) {
+        first = nBytes;
+    }
+    memcpy ( pBuf, pShm->pRecvData + offset, first );
+    memcpy ( (char *) pBuf + first, pShm->pRecvData, nBytes - first );
+
+    epicsAtomicCmpAndSwapIntT ( &pCtl->tail.value, (int) tail,
+        (int) ( ( tail + nBytes ) & CA_SHM_COUNT_MASK ) );
+    return nBytes;
+}
+
+unsigned caShmPending ( const caShm *pShm )
+{
+    caShmCtl *pCtl = pShm->pRecvCtl;
+
+    return caShmUsed ( pShm,
+        (unsigned) epicsAtomicGetIntT ( &pCtl->head.value ),
+        (unsigned) pCtl->tail.value );
+}
+
+int caShmWaitArm ( caShm *pShm )
+{
+    caShmCtl *pCtl = pShm->pRecvCtl;
+    unsigned i;
+
+    for ( i = 0u; i < pShm->spin; i++ ) {
+        if ( caShmPending ( pShm ) ) {
+            return TRUE;
+        }
+    }
+    epicsAtomicCmpAndSwapIntT ( &pCtl->waiting.value, 0, 1 );
+    if ( caShmPending ( pShm ) == 0u ) {
+        return FALSE;
+    }
+    /*
+     * If the writer cleared the flag first its wakeup byte is
+     * still coming, and is taken as a spurious wakeup later
+     */
+    epicsAtomicCmpAndSwapIntT ( &pCtl->waiting.value, 1, 0 );
+    return TRUE;
+}
+
+#else /* CA_SHM_POSIX */
+
+int caShmSupported ( void )
+{
+    return FALSE;
+}
+
+caShm * caShmCreate ( unsigned ringSize )
+{
+    return NULL;
+}
+
+caShm * caShmAttach ( const char *pName )
+{
+    return NULL;
+}
+
+void caShmUnlink ( caShm *pShm ) {}
+
+void caShmDestroy ( caShm *pShm ) {}
+
+const char * caShmName ( const caShm *pShm )
+{
+    return "";
+}
+
+unsigned caShmRingSize ( const caShm *pShm )
+{
+    return 0u;
+}
+
+unsigned caShmWrite ( caShm *pShm, const void *pBuf,
+    unsigned nBytes, int *pWakeup )
+{
+    *pWakeup = FALSE;
+    return 0u;
+}
+
+unsigned caShmRead ( caShm *pShm, void *pBuf, unsigned nBytes )
+{
+    return 0u;
+}
+
+unsigned caShmPending ( const caShm *pShm )
+{
+    return 0u;
+}
+
+int caShmWaitArm ( caShm *pShm )
+{
+    return TRUE;
+}
+
+#endif /* CA_SHM_POSIX */
+
+void caShmBackoff ( unsigned attempt )
+{
+    /* the reader usually drains the ring within a few time slices */
+    epicsThreadSleep ( attempt < 16u ? 0.0 : 0.001 );
+}
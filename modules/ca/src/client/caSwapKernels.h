@@ -0,0 +1,244 @@
+/*************************************************************************\
+* EPICS BASE is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+
+/*
+ * Byte swap kernels of the CA wire format conversion, see convert.cpp.
+ * Not installed, this is also included by the tests to check each set
+ * of kernels the host has.
+ */
+
+#ifndef INC_caSwapKernels_H
+#define INC_caSwapKernels_H
+
+#include "osiWireFormat.h"
+
+#include "net_convert.h"
+
+/*
+ * The arrays of little endian hosts with IEEE floating point differ from
+ * the network format only in byte order, so they are swapped in bulk with
+ * whatever vector instructions are available.
+ */
+#if defined ( EPICS_CONVERSION_REQUIRED ) && \
+        EPICS_BYTE_ORDER == EPICS_ENDIAN_LITTLE && \
+        EPICS_FLOAT_WORD_ORDER == EPICS_ENDIAN_LITTLE
+#   if defined ( __SSE2__ ) || defined ( _M_X64 )
+#       include <emmintrin.h>
+#       define CA_SWAP_SSE2
+#   endif
+#   if ( defined ( __x86_64__ ) || defined ( __i386__ ) ) && \
+        ( defined ( __clang__ ) || __GNUC__ > 4 || \
+            ( __GNUC__ == 4 && __GNUC_MINOR__ >= 9 ) )
+#       include <immintrin.h>
+#       define CA_SWAP_AVX2
+#   endif
+#   if defined ( __ARM_NEON ) || defined ( __ARM_NEON__ )
+#       include <arm_neon.h>
+#       define CA_SWAP_NEON
+#   endif
+#endif
+
+#ifdef EPICS_CONVERSION_REQUIRED
+
+/*
+ * Bulk byte swap kernels. Each swaps as many whole vectors of 2, 4, or
+ * 8 byte elements as fit in the array and returns the number of elements
+ * done, leaving the rest to the element by element loops below. Source
+ * and destination may be the same array, but must not otherwise overlap.
+ */
+typedef arrayElementCount ( * CACSWAPFUNCPTR ) (
+    const void *pSrc, void *pDest, arrayElementCount count );
+
+struct cacSwapKernels {
+    const char * pName;
+    CACSWAPFUNCPTR swap16;
+    CACSWAPFUNCPTR swap32;
+    CACSWAPFUNCPTR swap64;
+};
+
+static arrayElementCount swap_none (
+    const void *, void *, arrayElementCount )
+{
+    return 0u;
+}
+
+static const cacSwapKernels swapScalar = {
+    "scalar", swap_none, swap_none, swap_none
+};
+
+#ifdef CA_SWAP_SSE2
+
+/* SSE2 has no byte shuffle, so bytes are swapped within 16 bit words
+ * by shifting, and the words are then reordered */
+static inline __m128i swap_bytes_sse2 ( __m128i v )
+{
+    return _mm_or_si128 ( _mm_slli_epi16 ( v, 8 ), _mm_srli_epi16 ( v, 8 ) );
+}
+
+static arrayElementCount swap16_sse2 (
+    const void *s, void *d, arrayElementCount num )
+{
+    const __m128i * pSrc = static_cast < const __m128i * > ( s );
+    __m128i * pDest = static_cast < __m128i * > ( d );
+    arrayElementCount nVec = num / 8u;
+    for ( arrayElementCount i = 0; i < nVec; i++ ) {
+        __m128i v = _mm_loadu_si128 ( pSrc + i );
+        _mm_storeu_si128 ( pDest + i, swap_bytes_sse2 ( v ) );
+    }
+    return nVec * 8u;
+}
+
+static arrayElementCount swap32_sse2 (
+    const void *s, void *d, arrayElementCount num )
+{
+    const __m128i * pSrc = static_cast < const __m128i * > ( s );
+    __m128i * pDest = static_cast < __m128i * > ( d );
+    arrayElementCount nVec = num / 4u;
+    for ( arrayElementCount i = 0; i < nVec; i++ ) {
+        __m128i v = swap_bytes_sse2 ( _mm_loadu_si128 ( pSrc + i ) );
+        v = _mm_shufflelo_epi16 ( v, _MM_SHUFFLE ( 2, 3, 0, 1 ) );
+        v = _mm_shufflehi_epi16 ( v, _MM_SHUFFLE ( 2, 3, 0, 1 ) );
+        _mm_storeu_si128 ( pDest + i, v );
+    }
+    return nVec * 4u;
+}
+
+static arrayElementCount swap64_sse2 (
+    const void *s, void *d, arrayElementCount num )
+{
+    const __m128i * pSrc = static_cast < const __m128i * > ( s );
+    __m128i * pDest = static_cast < __m128i * > ( d );
+    arrayElementCount nVec = num / 2u;
+    for ( arrayElementCount i = 0; i < nVec; i++ ) {
+        __m128i v = swap_bytes_sse2 ( _mm_loadu_si128 ( pSrc + i ) );
+        v = _mm_shufflelo_epi16 ( v, _MM_SHUFFLE ( 0, 1, 2, 3 ) );
+        v = _mm_shufflehi_epi16 ( v, _MM_SHUFFLE ( 0, 1, 2, 3 ) );
+        _mm_storeu_si128 ( pDest + i, v );
+    }
+    return nVec * 2u;
+}
+
+static const cacSwapKernels swapSSE2 = {
+    "SSE2", swap16_sse2, swap32_sse2, swap64_sse2
+};
+
+#endif /* CA_SWAP_SSE2 */
+
+#ifdef CA_SWAP_AVX2
+
+/* compiled for AVX2 whatever the target, and only used if the CPU has it */
+#define CA_AVX2_FUNC __attribute__ (( target ( "avx2" ) ))
+
+CA_AVX2_FUNC static arrayElementCount swap_avx2 (
+    const void *s, void *d, arrayElementCount nBytes, const __m256i & order )
+{
+    const __m256i * pSrc = static_cast < const __m256i * > ( s );
+    __m256i * pDest = static_cast < __m256i * > ( d );
+    arrayElementCount nVec = nBytes / sizeof ( __m256i );
+    for ( arrayElementCount i = 0; i < nVec; i++ ) {
+        __m256i v = _mm256_loadu_si256 ( pSrc + i );
+        _mm256_storeu_si256 ( pDest + i, _mm256_shuffle_epi8 ( v, order ) );
+    }
+    return nVec * sizeof ( __m256i );
+}
+
+CA_AVX2_FUNC static arrayElementCount swap16_avx2 (
+    const void *s, void *d, arrayElementCount num )
+{
+    const __m256i order = _mm256_setr_epi8 (
+        1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14,
+        1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14 );
+    return swap_avx2 ( s, d, num * 2u, order ) / 2u;
+}
+
+CA_AVX2_FUNC static arrayElementCount swap32_avx2 (
+    const void *s, void *d, arrayElementCount num )
+{
+    const __m256i order = _mm256_setr_epi8 (
+        3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12,
+        3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12 );
+    return swap_avx2 ( s, d, num * 4u, order ) / 4u;
+}
+
+CA_AVX2_FUNC static arrayElementCount swap64_avx2 (
+    const void *s, void *d, arrayElementCount num )
+{
+    const __m256i order = _mm256_setr_epi8 (
+        7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8,
+        7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8 );
+    return swap_avx2 ( s, d, num * 8u, order ) / 8u;
+}
+
+static const cacSwapKernels swapAVX2 = {
+    "AVX2", swap16_avx2, swap32_avx2, swap64_avx2
+};
+
+#endif /* CA_SWAP_AVX2 */
+
+#ifdef CA_SWAP_NEON
+
+static arrayElementCount swap16_neon (
+    const void *s, void *d, arrayElementCount num )
+{
+    const epicsUInt8 * pSrc = static_cast < const epicsUInt8 * > ( s );
+    epicsUInt8 * pDest = static_cast < epicsUInt8 * > ( d );
+    arrayElementCount nVec = num / 8u;
+    for ( arrayElementCount i = 0; i < nVec; i++ ) {
+        vst1q_u8 ( pDest + 16u * i, vrev16q_u8 ( vld1q_u8 ( pSrc + 16u * i ) ) );
+    }
+    return nVec * 8u;
+}
+
+static arrayElementCount swap32_neon (
+    const void *s, void *d, arrayElementCount num )
+{
+    const epicsUInt8 * pSrc = static_cast < const epicsUInt8 * > ( s );
+    epicsUInt8 * pDest = static_cast < epicsUInt8 * > ( d );
+    arrayElementCount nVec = num / 4u;
+    for ( arrayElementCount i = 0; i < nVec; i++ ) {
+        vst1q_u8 ( pDest + 16u * i, vrev32q_u8 ( vld1q_u8 ( pSrc + 16u * i ) ) );
+    }
+    return nVec * 4u;
+}
+
+static arrayElementCount swap64_neon (
+    const void *s, void *d, arrayElementCount num )
+{
+    const epicsUInt8 * pSrc = static_cast < const epicsUInt8 * > ( s );
+    epicsUInt8 * pDest = static_cast < epicsUInt8 * > ( d );
+    arrayElementCount nVec = num / 2u;
+    for ( arrayElementCount i = 0; i < nVec; i++ ) {
+        vst1q_u8 ( pDest + 16u * i, vrev64q_u8 ( vld1q_u8 ( pSrc + 16u * i ) ) );
+    }
+    return nVec * 2u;
+}
+
+static const cacSwapKernels swapNEON = {
+    "NEON", swap16_neon, swap32_neon, swap64_neon
+};
+
+#endif /* CA_SWAP_NEON */
+
+/* the best kernels that this CPU can run */
+static const cacSwapKernels * bestSwapKernels ()
+{
+#if defined ( CA_SWAP_AVX2 )
+    __builtin_cpu_init ();
+    if ( __builtin_cpu_supports ( "avx2" ) ) {
+        return & swapAVX2;
+    }
+#endif
+#if defined ( CA_SWAP_SSE2 )
+    return & swapSSE2;
+#elif defined ( CA_SWAP_NEON )
+    return & swapNEON;
+#else
+    return & swapScalar;
+#endif
+}
+
+#endif /* EPICS_CONVERSION_REQUIRED */
+
+#endif /* ifndef INC_caSwapKernels_H */
@@ -83,7 +83,8 @@ ca_client_context::ca_client_context ( bool enablePreemptiveCallback ) :
                     this->mutex, this->cbMutex, *this ) );
         }
         else {
-            this->pServiceContext.reset ( new cac ( this->mutex, this->cbMutex, *this ) );
+            this->pServiceContext.reset ( new cac ( this->mutex,
+                this->cbMutex, *this, enablePreemptiveCallback ) );
         }
     }
 
@@ -653,6 +654,25 @@ void ca_client_context::callbackProcessingCompleteNotify ()
     }
 }
 
+// called when a channel is created for the first time
+// after the function was registered
+void ca_client_context::fdRegFuncCall ()
+{
+    CAFDHANDLER * pFunc = 0;
+    void * pArg = 0;
+    {
+        epicsGuard < epicsMutex > guard ( this->mutex );
+        if ( this->fdRegFuncNeedsToBeCalled ) {
+            pFunc = this->fdRegFunc;
+            pArg = this->fdRegArg;
+            this->fdRegFuncNeedsToBeCalled = false;
+        }
+    }
+    if ( pFunc ) {
+        ( *pFunc ) ( pArg, this->sock, true );
+    }
+}
+
 cacChannel & ca_client_context::createChannel (
     epicsGuard < epicsMutex > & guard, const char * pChannelName,
     cacChannelNotify & chan, cacChannel::priLev pri )
@@ -662,6 +682,13 @@ cacChannel & ca_client_context::createChannel (
         guard, pChannelName, chan, pri );
 }
 
+void ca_client_context::reserveChannels (
+    epicsGuard < epicsMutex > & guard, unsigned nChannels )
+{
+    guard.assertIdenticalMutex ( this->mutex );
+    this->pServiceContext->reserveChannels ( guard, nChannels );
+}
+
 void ca_client_context::flush ( epicsGuard < epicsMutex > & guard )
 {
     this->pServiceContext->flush ( guard );
@@ -721,7 +748,8 @@ epicsMutex & ca_client_context::mutexRef () const
 cacContext & ca_client_context::createNetworkContext (
     epicsMutex & mutexIn, epicsMutex & cbMutexIn )
 {
-    return * new cac ( mutexIn, cbMutexIn, *this );
+    return * new cac ( mutexIn, cbMutexIn, *this,
+        this->preemptiveCallbakIsEnabled () );
 }
 
 void ca_client_context::installDefaultService ( cacService & service )
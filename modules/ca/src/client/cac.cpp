@@ -48,6 +48,9 @@
 #include "udpiiu.h"
 #include "bhe.h"
 #include "net_convert.h"
+#include "caShm.h"
+#include "cacIoPool.h"
+#include "nameCache.h"
 #include "autoPtrFreeList.h"
 #include "noopiiu.h"
 
@@ -86,7 +89,8 @@ const cac::pProtoStubTCP cac::tcpJumpTableCAC [] =
     &cac::badTCPRespAction,
     &cac::badTCPRespAction,
     &cac::verifyAndDisconnectChan,
-    &cac::verifyAndDisconnectChan
+    &cac::verifyAndDisconnectChan,
+    &cac::shmRespAction
 };
 
 // TCP exception dispatch table
@@ -119,7 +123,8 @@ const cac::pExcepProtoStubTCP cac::tcpExcepJumpTableCAC [] =
     &cac::defaultExcep,     // REPEATER_REGISTER
     &cac::defaultExcep,     // CA_PROTO_SIGNAL
     &cac::defaultExcep,     // CA_PROTO_CREATE_CH_FAIL
-    &cac::defaultExcep      // CA_PROTO_SERVER_DISCONN
+    &cac::defaultExcep,     // CA_PROTO_SERVER_DISCONN
+    &cac::defaultExcep      // CA_PROTO_SHM
 };
 
 //
@@ -128,7 +133,7 @@ const cac::pExcepProtoStubTCP cac::tcpExcepJumpTableCAC [] =
 cac::cac (
     epicsMutex & mutualExclusionIn,
     epicsMutex & callbackControlIn,
-    cacContextNotify & notifyIn ) :
+    cacContextNotify & notifyIn, bool preemptiveCallback ) :
     _refLocalHostName ( localHostNameCache.getReference () ),
     programBeginTime ( epicsTime::getCurrent() ),
     connTMO ( CA_CONN_VERIFY_PERIOD ),
@@ -148,7 +153,11 @@ cac::cac (
     maxContigFrames ( contiguousMsgCountWhichTriggersFlowControl ),
     beaconAnomalyCount ( 0u ),
     iiuExistenceCount ( 0u ),
-    cacShutdownInProgress ( false )
+    cacShutdownInProgress ( false ),
+    shmEnabled ( false ),
+    pIoPool ( 0 ),
+    ioThreads ( 0u ),
+    pNameCache ( 0 )
 {
     if ( ! osiSockAttach () ) {
         throwWithLocation ( udpiiu :: noSocket () );
@@ -229,7 +238,26 @@ cac::cac (
                 throw std::bad_alloc ();
             }
         }
-        unsigned bufsPerArray = this->maxRecvBytesTCP / comBuf::capacityBytes ();
+        int useShm;
+        if ( envGetBoolConfigParam ( &EPICS_CA_USE_SHM, &useShm ) )
+            useShm = 0;
+        this->shmEnabled = useShm && caShmSupported ();
+
+        // the I/O pool threads must not wait for ca_pend_event()
+        long ioThreadsAsALong;
+        if ( preemptiveCallback &&
+                envGetLongConfigParam ( &EPICS_CA_IO_THREADS,
+                    &ioThreadsAsALong ) == 0 && ioThreadsAsALong > 0 ) {
+            this->ioThreads = ( unsigned ) ioThreadsAsALong;
+        }
+
+        const char * pCacheFile = envGetConfigParamPtr ( &EPICS_CA_NAME_CACHE );
+        if ( pCacheFile ) {
+            this->pNameCache = new nameCache ( pCacheFile );
+        }
+
+        unsigned bufsPerArray = this->maxRecvBytesTCP /
+            this->comBufMemMgr.capacityBytes ();
         if ( bufsPerArray > 1u ) {
             maxContigFrames = bufsPerArray *
                 contiguousMsgCountWhichTriggersFlowControl;
@@ -323,6 +351,14 @@ cac::~cac ()
         }
     }
 
+    delete this->pIoPool;
+
+    if ( this->pNameCache ) {
+        epicsGuard < epicsMutex > guard ( this->mutex );
+        this->pNameCache->save ( guard );
+    }
+    delete this->pNameCache;
+
     if ( this->pudpiiu ) {
         delete this->pudpiiu;
     }
@@ -360,6 +396,19 @@ cac::~cac ()
     // its his responsibility to clean them up.
 }
 
+// the shared I/O threads of the circuits, started with the first circuit
+cacIoPool * cac::ioPool ()
+{
+    if ( ! this->pIoPool && this->ioThreads ) {
+        this->pIoPool = cacIoPool::create ( *this, this->ioThreads,
+            highestPriorityLevelBelow ( this->initializingThreadsPriority ) );
+        if ( ! this->pIoPool ) {
+            this->ioThreads = 0u;
+        }
+    }
+    return this->pIoPool;
+}
+
 unsigned cac::lowestPriorityLevelAbove ( unsigned priority )
 {
     unsigned abovePriority;
@@ -418,6 +467,12 @@ void cac::show (
     if ( level > 0u ) {
         this->serverTable.show ( level - 1u );
         ::printf ( "\tconnection time out watchdog period %f\n", this->connTMO );
+        if ( this->pIoPool ) {
+            this->pIoPool->show ( level - 1u );
+        }
+        if ( this->pNameCache ) {
+            this->pNameCache->show ( guard, level - 1u );
+        }
     }
 
     if ( level > 1u ) {
@@ -452,7 +507,7 @@ void cac::show (
 /*
  *  cac::beaconNotify
  */
-void cac::beaconNotify ( const inetAddrID & addr, const epicsTime & currentTime,
+void cac::beaconNotify ( const struct sockaddr_in & addr, const epicsTime & currentTime,
                         ca_uint32_t beaconNumber, unsigned protocolRevision  )
 {
     epicsGuard < epicsMutex > guard ( this->mutex );
@@ -495,12 +550,16 @@ void cac::beaconNotify ( const inetAddrID & addr, const epicsTime & currentTime,
 
     this->beaconAnomalyCount++;
 
+    if ( this->pNameCache ) {
+        this->pNameCache->beaconAnomaly ( guard, addr );
+    }
+
     this->pudpiiu->beaconAnomalyNotify ( guard );
 
 #   ifdef DEBUG
     {
         char buf[128];
-        addr.name ( buf, sizeof ( buf ) );
+        ipAddrToDottedIP ( & addr, buf, sizeof ( buf ) );
         ::printf ( "New server available: %s\n", buf );
     }
 #   endif
@@ -533,6 +592,15 @@ cacChannel & cac::createChannel (
     return *pNetChan;
 }
 
+// grow the table once rather than doubling it many times over
+void cac::reserveChannels (
+    epicsGuard < epicsMutex > & guard, unsigned nChannels )
+{
+    guard.assertIdenticalMutex ( this->mutex );
+    this->chanTable.setTableSize (
+        this->chanTable.numEntriesInstalled () + nChannels );
+}
+
 bool cac::findOrCreateVirtCircuit (
     epicsGuard < epicsMutex > & guard, const osiSockAddr & addr,
     unsigned priority, tcpiiu *& piiu, unsigned minorVersionNumber,
@@ -589,7 +657,7 @@ void cac::transferChanToVirtCircuit (
     unsigned cid, unsigned sid,
     ca_uint16_t typeCode, arrayElementCount count,
     unsigned minorVersionNumber, const osiSockAddr & addr,
-    const epicsTime & currentTime )
+    const osiSockAddr * pSearchReplyAddr, const epicsTime & currentTime )
 {
     if ( addr.sa.sa_family != AF_INET ) {
         return;
@@ -651,12 +719,50 @@ void cac::transferChanToVirtCircuit (
         piiu->installChannel (
             guard, *pChan, sid, typeCode, count );
 
+        // the cache keeps where the server answered the search
+        if ( this->pNameCache && pSearchReplyAddr &&
+                pSearchReplyAddr->sa.sa_family == AF_INET ) {
+            this->pNameCache->update ( guard, pChan->pName ( guard ),
+                pSearchReplyAddr->ia );
+        }
+
         if ( newIIU ) {
             piiu->start ( guard );
         }
     }
 }
 
+bool cac::nameCacheLookup (
+    epicsGuard < epicsMutex > & guard, const char * pName,
+    bool firstTry, unsigned & epoch, osiSockAddr & addr )
+{
+    guard.assertIdenticalMutex ( this->mutex );
+    if ( ! this->pNameCache ) {
+        return false;
+    }
+    struct sockaddr_in ia;
+    if ( ! this->pNameCache->lookup ( guard, pName, firstTry, epoch, ia ) ) {
+        return false;
+    }
+    addr.ia = ia;
+    return true;
+}
+
+void cac::searchNotFound ( unsigned cid, const osiSockAddr & addr )
+{
+    if ( addr.sa.sa_family != AF_INET ) {
+        return;
+    }
+    epicsGuard < epicsMutex > guard ( this->mutex );
+    if ( ! this->pNameCache ) {
+        return;
+    }
+    nciu * pChan = this->chanTable.lookup ( cid );
+    if ( pChan ) {
+        this->pNameCache->notFound ( guard, pChan->pName ( guard ), addr.ia );
+    }
+}
+
 void cac::destroyChannel (
     epicsGuard < epicsMutex > & guard,
     nciu & chan )
@@ -834,6 +940,12 @@ bool cac::versionAction ( callbackManager &, tcpiiu & iiu,
     return true;
 }
 
+bool cac::shmRespAction ( callbackManager &, tcpiiu & iiu,
+    const epicsTime &, const caHdrLargeArray & hdr, void * pMsgBdy )
+{
+    return iiu.shmRespNotify ( hdr, static_cast < const char * > ( pMsgBdy ) );
+}
+
 bool cac::echoRespAction (
     callbackManager & mgr, tcpiiu & iiu,
     const epicsTime & /* current */, const caHdrLargeArray &, void * )
@@ -1298,14 +1410,61 @@ void cac::initiateConnect (
     this->pudpiiu->installNewChannel ( guard, chan, piiu );
 }
 
+// Buffers are carved from 2 MB chunks, which hold a few of the
+// largest and hundreds of the default size
+static const unsigned comBufMaxBytes = 0x100000;
+static const size_t comBufChunkBytes = 0x200000;
+
+cacComBufMemoryManager::cacComBufMemoryManager () :
+    pFreeList ( 0 ), bufBytes ( comBufSize )
+{
+    long bytesAsALong;
+    if ( envGetLongConfigParam ( &EPICS_CA_TCP_BLOCK_BYTES, &bytesAsALong ) ||
+            bytesAsALong <= 0 ) {
+        errlogPrintf ( "cac: EPICS_CA_TCP_BLOCK_BYTES was not a positive integer\n" );
+    }
+    else if ( bytesAsALong < (long) comBufSize ) {
+        errlogPrintf ( "cac: EPICS_CA_TCP_BLOCK_BYTES was rounded up to %u\n",
+            comBufSize );
+    }
+    else if ( bytesAsALong > (long) comBufMaxBytes ) {
+        this->bufBytes = comBufMaxBytes;
+        errlogPrintf ( "cac: EPICS_CA_TCP_BLOCK_BYTES was limited to %u\n",
+            comBufMaxBytes );
+    }
+    else {
+        // whole pages
+        this->bufBytes = ( ( (unsigned) bytesAsALong - 1u ) | 0xfff ) + 1u;
+    }
+
+    size_t blockBytes = sizeof ( comBuf ) + this->bufBytes;
+    freeListInitPvt ( &this->pFreeList, (int) blockBytes,
+        (int) ( comBufChunkBytes / blockBytes ) );
+}
+
+cacComBufMemoryManager::~cacComBufMemoryManager ()
+{
+    freeListCleanup ( this->pFreeList );
+}
+
 void *cacComBufMemoryManager::allocate ( size_t size )
 {
-    return this->freeList.allocate ( size );
+    assert ( size <= sizeof ( comBuf ) );
+    void * pBuf = freeListMalloc ( this->pFreeList );
+    if ( ! pBuf ) {
+        throw std::bad_alloc ();
+    }
+    return pBuf;
 }
 
 void cacComBufMemoryManager::release ( void * pCadaver )
 {
-    this->freeList.release ( pCadaver );
+    freeListFree ( this->pFreeList, pCadaver );
+}
+
+unsigned cacComBufMemoryManager::capacityBytes () const
+{
+    return this->bufBytes;
 }
 
 void cac::pvMultiplyDefinedNotify ( msgForMultiplyDefinedPV & mfmdpv,
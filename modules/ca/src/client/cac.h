@@ -68,11 +68,14 @@ struct caHdrLargeArray;
 class cacComBufMemoryManager : public comBufMemoryManager
 {
 public:
-    cacComBufMemoryManager () {}
+    cacComBufMemoryManager ();
+    ~cacComBufMemoryManager ();
     void * allocate ( size_t );
     void release ( void * );
+    unsigned capacityBytes () const;
 private:
-    tsFreeList < comBuf, 0x20 > freeList;
+    void * pFreeList;
+    unsigned bufBytes; // EPICS_CA_TCP_BLOCK_BYTES
     cacComBufMemoryManager ( const cacComBufMemoryManager & );
     cacComBufMemoryManager & operator = ( const cacComBufMemoryManager & );
 };
@@ -104,11 +107,11 @@ public:
     cac (
         epicsMutex & mutualExclusion,
         epicsMutex & callbackControl,
-        cacContextNotify & );
+        cacContextNotify &, bool preemptiveCallback );
     virtual ~cac ();
 
     // beacon management
-    void beaconNotify ( const inetAddrID & addr, const epicsTime & currentTime,
+    void beaconNotify ( const struct sockaddr_in & addr, const epicsTime & currentTime,
         ca_uint32_t beaconNumber, unsigned protocolRevision );
     unsigned beaconAnomaliesSinceProgramStart (
         epicsGuard < epicsMutex > & ) const;
@@ -123,10 +126,17 @@ public:
         unsigned cid, unsigned sid,
         ca_uint16_t typeCode, arrayElementCount count,
         unsigned minorVersionNumber, const osiSockAddr &,
+        const osiSockAddr * pSearchReplyAddr,
         const epicsTime & currentTime );
     cacChannel & createChannel (
         epicsGuard < epicsMutex > & guard, const char * pChannelName,
         cacChannelNotify &, cacChannel::priLev );
+    void reserveChannels (
+        epicsGuard < epicsMutex > &, unsigned nChannels );
+    bool nameCacheLookup (
+        epicsGuard < epicsMutex > &, const char * pName,
+        bool firstTry, unsigned & epoch, osiSockAddr & );
+    void searchNotFound ( unsigned cid, const osiSockAddr & );
     void destroyChannel (
         epicsGuard < epicsMutex > &, nciu & );
     void initiateConnect (
@@ -187,6 +197,8 @@ public:
     double connectionTimeout ( epicsGuard < epicsMutex > & );
 
     unsigned maxContiguousFrames ( epicsGuard < epicsMutex > & ) const;
+    bool sharedMemoryEnabled () const;
+    class cacIoPool * ioPool ();
 
     // misc
     const char * userNamePointer () const;
@@ -268,6 +280,12 @@ private:
     unsigned short _serverPort;
     unsigned iiuExistenceCount;
     bool cacShutdownInProgress;
+    bool shmEnabled;
+    // shared I/O threads, see cacIoPool.h
+    class cacIoPool * pIoPool;
+    unsigned ioThreads;
+    // servers where names were last found, see nameCache.h
+    class nameCache * pNameCache;
 
     void recycleReadNotifyIO (
         epicsGuard < epicsMutex > &, netReadNotifyIO &io );
@@ -313,6 +331,8 @@ private:
         const epicsTime & currentTime, const caHdrLargeArray &, void *pMsgBdy );
     bool verifyAndDisconnectChan ( callbackManager &, tcpiiu &,
         const epicsTime & currentTime, const caHdrLargeArray &, void *pMsgBdy );
+    bool shmRespAction ( callbackManager &, tcpiiu &,
+        const epicsTime & currentTime, const caHdrLargeArray &, void *pMsgBdy );
     bool badTCPRespAction ( callbackManager &, tcpiiu &,
         const epicsTime & currentTime, const caHdrLargeArray &, void *pMsgBdy );
 
@@ -417,6 +437,11 @@ inline unsigned cac ::
     return maxContigFrames;
 }
 
+inline bool cac :: sharedMemoryEnabled () const
+{
+    return shmEnabled;
+}
+
 inline double cac ::
     connectionTimeout ( epicsGuard < epicsMutex > & guard )
 {
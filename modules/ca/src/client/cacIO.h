@@ -276,6 +276,9 @@ public:
         epicsGuard < epicsMutex > &,
         const char * pChannelName, cacChannelNotify &,
         cacChannel::priLev = cacChannel::priorityDefault ) = 0;
+    // hint that nChannels more channels are about to be created
+    virtual void reserveChannels (
+        epicsGuard < epicsMutex > &, unsigned nChannels );
     virtual void flush (
         epicsGuard < epicsMutex > & ) = 0;
     virtual unsigned circuitCount (
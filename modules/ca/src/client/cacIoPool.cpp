@@ -0,0 +1,537 @@
+/*************************************************************************\
+* EPICS BASE is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+
+/*
+ * Shared I/O threads for the virtual circuits of a client context,
+ * see cacIoPool.h
+ */
+
+#include <string.h>
+#include <errno.h>
+
+#include "errlog.h"
+#include "osiSock.h"
+
+#include "iocinf.h"
+#include "cac.h"
+#include "virtualCircuit.h"
+#include "cacIoPool.h"
+
+#if defined(__linux__)
+#  include <sys/epoll.h>
+#  include <sys/eventfd.h>
+#  include <unistd.h>
+#  define CAC_HAVE_EPOLL
+#endif
+
+// events taken by a thread in one wait, few so that the
+// circuits ready at the same time spread over the threads
+static const int ioMaxEvents = 8;
+
+// how long the receive side of a circuit whose send side has
+// finished is given to shut down cleanly
+static const double ioCloseDelay = 30.0;
+
+cacIoPool * cacIoPool::create ( cac & cacIn,
+    unsigned nThreads, unsigned priority )
+{
+#ifdef CAC_HAVE_EPOLL
+    int epollFd = epoll_create1 ( EPOLL_CLOEXEC );
+    if ( epollFd < 0 ) {
+        char sockErrBuf[64];
+        epicsSocketConvertErrnoToString ( sockErrBuf, sizeof ( sockErrBuf ) );
+        errlogPrintf ( "CAC: unable to create the I/O pool because \"%s\"\n",
+            sockErrBuf );
+        return 0;
+    }
+    // each request for send labor wakes one thread
+    int wakeFd = eventfd ( 0, EFD_CLOEXEC | EFD_NONBLOCK | EFD_SEMAPHORE );
+    struct epoll_event ev;
+    memset ( & ev, 0, sizeof ( ev ) );
+    ev.events = EPOLLIN;
+    ev.data.ptr = 0;
+    if ( wakeFd < 0 ||
+            epoll_ctl ( epollFd, EPOLL_CTL_ADD, wakeFd, & ev ) < 0 ) {
+        char sockErrBuf[64];
+        epicsSocketConvertErrnoToString ( sockErrBuf, sizeof ( sockErrBuf ) );
+        errlogPrintf ( "CAC: unable to create the I/O pool because \"%s\"\n",
+            sockErrBuf );
+        if ( wakeFd >= 0 ) {
+            close ( wakeFd );
+        }
+        close ( epollFd );
+        return 0;
+    }
+
+    cacIoPool * pPool = new cacIoPool ( cacIn, epollFd, wakeFd );
+    try {
+        pPool->pThreads = new epicsThread * [ nThreads ];
+        while ( pPool->nThreads < nThreads ) {
+            epicsThread * pThread = new epicsThread ( *pPool, "CAC-TCP-io",
+                epicsThreadGetStackSize ( epicsThreadStackBig ), priority );
+            pPool->pThreads[pPool->nThreads++] = pThread;
+            pThread->start ();
+        }
+    }
+    catch ( ... ) {
+        errlogPrintf ( "CAC: I/O pool started %u of %u threads\n",
+            pPool->nThreads, nThreads );
+        if ( ! pPool->nThreads ) {
+            delete pPool;
+            return 0;
+        }
+    }
+    return pPool;
+#else
+    errlogPrintf ( "CAC: EPICS_CA_IO_THREADS is not supported "
+        "on this target\n" );
+    return 0;
+#endif
+}
+
+cacIoPool::cacIoPool ( cac & cacIn, int epollFdIn, int wakeFdIn ) :
+    cacRef ( cacIn ), pThreads ( 0 ), pSendHead ( 0 ), pSendTail ( 0 ),
+    pClosing ( 0 ), nThreads ( 0u ), nCircuits ( 0u ), nSendQueued ( 0u ),
+    epollFd ( epollFdIn ), wakeFd ( wakeFdIn ), exitFlag ( false )
+{
+}
+
+// the context has already waited for all circuits to be uninstalled
+cacIoPool::~cacIoPool ()
+{
+    {
+        epicsGuard < epicsMutex > guard ( this->mutex );
+        this->exitFlag = true;
+    }
+    for ( unsigned i = 0u; i < this->nThreads; i++ ) {
+        this->wakeup ();
+    }
+    for ( unsigned i = 0u; i < this->nThreads; i++ ) {
+        delete this->pThreads[i];
+    }
+    delete [] this->pThreads;
+#ifdef CAC_HAVE_EPOLL
+    close ( this->wakeFd );
+    close ( this->epollFd );
+#endif
+}
+
+// called with the circuit's lock by tcpiiu::start() in place of
+// starting its receive thread
+bool cacIoPool::connect ( epicsGuard < epicsMutex > & guard, tcpiiu & iiu )
+{
+    guard.assertIdenticalMutex ( iiu.mutex );
+#ifdef CAC_HAVE_EPOLL
+    // a fresh socket may report a hangup before connect() is
+    // called, ioConnectFinish() then waits for the real outcome
+    iiu.ioConnectPending = true;
+    iiu.ioConnectErrno = 0;
+    {
+        epicsGuard < epicsMutex > poolGuard ( this->mutex );
+        iiu.ioRecvArmed = true;
+        iiu.ioSendArmed = false;
+    }
+
+    struct epoll_event ev;
+    memset ( & ev, 0, sizeof ( ev ) );
+    ev.events = EPOLLOUT | EPOLLONESHOT;
+    ev.data.ptr = & iiu;
+    osiSockIoctl_t yes = true;
+    if ( socket_ioctl ( iiu.sock, FIONBIO, & yes ) < 0 ||
+            epoll_ctl ( this->epollFd, EPOLL_CTL_ADD, iiu.sock, & ev ) < 0 ) {
+        char sockErrBuf[64];
+        epicsSocketConvertErrnoToString ( sockErrBuf, sizeof ( sockErrBuf ) );
+        errlogPrintf ( "CAC: I/O pool unable to serve a circuit "
+            "because \"%s\"\n", sockErrBuf );
+        osiSockIoctl_t no = false;
+        socket_ioctl ( iiu.sock, FIONBIO, & no );
+        iiu.ioConnectPending = false;
+        return false;
+    }
+
+    osiSockAddr tmp = iiu.address ();
+    int status = ::connect ( iiu.sock, & tmp.sa, sizeof ( tmp.sa ) );
+    if ( status < 0 ) {
+        int errnoCpy = SOCKERRNO;
+        if ( errnoCpy != SOCK_EINPROGRESS && errnoCpy != SOCK_EINTR ) {
+            iiu.ioConnectErrno = errnoCpy;
+        }
+    }
+
+    epicsGuard < epicsMutex > poolGuard ( this->mutex );
+    this->nCircuits++;
+    return true;
+#else
+    return false;
+#endif
+}
+
+// called with the circuit's lock by tcpiiu::sendWakeup()
+void cacIoPool::sendRequest ( epicsGuard < epicsMutex > & guard, tcpiiu & iiu )
+{
+    guard.assertIdenticalMutex ( iiu.mutex );
+    if ( iiu.ioSendDone ) {
+        return;
+    }
+    {
+        epicsGuard < epicsMutex > poolGuard ( this->mutex );
+        if ( iiu.ioSendBusy ) {
+            // the thread doing it will queue it again
+            iiu.ioSendAgain = true;
+            return;
+        }
+        // queued when the socket is writable
+        if ( iiu.ioSendQueued || iiu.ioSendArmed ) {
+            return;
+        }
+        this->sendQueAdd ( iiu );
+    }
+    this->wakeup ();
+}
+
+void cacIoPool::run ()
+{
+#ifdef CAC_HAVE_EPOLL
+    struct epoll_event events[ioMaxEvents];
+
+    this->cacRef.attachToClientCtx ();
+
+    while ( true ) {
+        int timeout = -1;
+        {
+            epicsGuard < epicsMutex > guard ( this->mutex );
+            if ( this->exitFlag ) {
+                break;
+            }
+            // poll the shutdown deadlines
+            if ( this->pClosing ) {
+                timeout = 1000;
+            }
+        }
+
+        int n = epoll_wait ( this->epollFd, events, ioMaxEvents, timeout );
+        if ( n < 0 ) {
+            if ( errno != EINTR ) {
+                char sockErrBuf[64];
+                epicsSocketConvertErrnoToString (
+                    sockErrBuf, sizeof ( sockErrBuf ) );
+                errlogPrintf ( "CAC: I/O pool wait failed because \"%s\"\n",
+                    sockErrBuf );
+                epicsThreadSleep ( 1.0 );
+            }
+            continue;
+        }
+
+        for ( int i = 0; i < n; i++ ) {
+            tcpiiu * piiu = static_cast < tcpiiu * > ( events[i].data.ptr );
+            if ( piiu ) {
+                this->dispatch ( *piiu, events[i].events );
+            }
+            else {
+                epicsUInt64 count;
+                if ( read ( this->wakeFd, & count, sizeof ( count ) ) ) {
+                    // taken by another thread if it failed
+                }
+            }
+        }
+
+        this->sendLabor ();
+        this->closeExpired ();
+    }
+#endif
+}
+
+// hand an event on the socket of a circuit to the sides armed for
+// it, EPOLLONESHOT has disarmed the registration for both of them.
+// A side is armed only while it waits, so the circuit can't be
+// uninstalled before this returns.
+void cacIoPool::dispatch ( tcpiiu & iiu, unsigned events )
+{
+#ifdef CAC_HAVE_EPOLL
+    bool recv = false;
+    bool send = false;
+    {
+        epicsGuard < epicsMutex > guard ( this->mutex );
+        const unsigned hangup = EPOLLERR | EPOLLHUP;
+        const unsigned recvEvents = hangup |
+            ( iiu.ioConnectPending ? EPOLLOUT : EPOLLIN );
+        if ( iiu.ioSendArmed && ( events & ( EPOLLOUT | hangup ) ) ) {
+            iiu.ioSendArmed = false;
+            this->sendQueAdd ( iiu );
+            send = true;
+        }
+        if ( iiu.ioRecvArmed && ( events & recvEvents ) ) {
+            iiu.ioRecvArmed = false;
+            recv = true;
+        }
+        // re-arm the side still waiting
+        this->arm ( iiu );
+    }
+    if ( send ) {
+        this->wakeup ();
+    }
+    if ( recv ) {
+        this->service ( iiu );
+    }
+#endif
+}
+
+// set the events of the circuit's registration to those its sides
+// wait for, with the pool's lock
+bool cacIoPool::arm ( tcpiiu & iiu )
+{
+#ifdef CAC_HAVE_EPOLL
+    struct epoll_event ev;
+    memset ( & ev, 0, sizeof ( ev ) );
+    if ( iiu.ioRecvArmed ) {
+        ev.events |= iiu.ioConnectPending ? EPOLLOUT : EPOLLIN;
+    }
+    if ( iiu.ioSendArmed ) {
+        ev.events |= EPOLLOUT;
+    }
+    if ( ! ev.events ) {
+        return true;
+    }
+    ev.events |= EPOLLONESHOT;
+    ev.data.ptr = & iiu;
+    if ( epoll_ctl ( this->epollFd, EPOLL_CTL_MOD, iiu.sock, & ev ) == 0 ) {
+        return true;
+    }
+    char sockErrBuf[64];
+    epicsSocketConvertErrnoToString ( sockErrBuf, sizeof ( sockErrBuf ) );
+    errlogPrintf ( "CAC: I/O pool unable to re-arm a circuit "
+        "because \"%s\"\n", sockErrBuf );
+#endif
+    return false;
+}
+
+// the socket of a circuit is ready for its receive side, no other
+// thread receives from it until it is re-armed
+void cacIoPool::service ( tcpiiu & iiu )
+{
+#ifdef CAC_HAVE_EPOLL
+    bool more;
+    if ( iiu.ioConnectPending ) {
+        more = iiu.ioConnectFinish ();
+    }
+    else {
+        more = iiu.ioRecv ();
+    }
+
+    if ( more ) {
+        {
+            epicsGuard < epicsMutex > guard ( this->mutex );
+            iiu.ioRecvArmed = true;
+            if ( this->arm ( iiu ) ) {
+                return;
+            }
+            iiu.ioRecvArmed = false;
+        }
+        errlogPrintf ( "CAC: I/O pool disconnecting a circuit "
+            "it can't re-arm\n" );
+        epicsGuard < epicsMutex > guard ( iiu.mutex );
+        iiu.initiateAbortShutdown ( guard );
+    }
+    this->recvFinished ( iiu );
+#endif
+}
+
+// run the send labor queued when this thread last looked, the labor
+// queued meanwhile wakes another thread
+void cacIoPool::sendLabor ()
+{
+    epicsGuard < epicsMutex > guard ( this->mutex );
+    unsigned nLabor = this->nSendQueued;
+    while ( nLabor-- > 0u && this->pSendHead ) {
+        tcpiiu & iiu = *this->pSendHead;
+        this->sendQueUnlink ( iiu );
+        iiu.ioSendBusy = true;
+        bool finished;
+        {
+            epicsGuardRelease < epicsMutex > unguard ( guard );
+            finished = iiu.ioSend ();
+        }
+        iiu.ioSendBusy = false;
+        iiu.ioSendIdle.signal ();
+        if ( finished ) {
+            iiu.ioSendAgain = false;
+            epicsGuardRelease < epicsMutex > unguard ( guard );
+            this->sendFinished ( iiu );
+        }
+        else if ( iiu.ioSendBlocked ) {
+            // the labor requested meanwhile waits for it too
+            iiu.ioSendAgain = false;
+            iiu.ioSendArmed = true;
+            if ( ! this->arm ( iiu ) ) {
+                iiu.ioSendArmed = false;
+                this->sendQueAdd ( iiu );
+            }
+        }
+        else if ( iiu.ioSendAgain ) {
+            iiu.ioSendAgain = false;
+            this->sendQueAdd ( iiu );
+        }
+    }
+}
+
+// abort the circuits which have not shut down cleanly in time
+void cacIoPool::closeExpired ()
+{
+    epicsTime current = epicsTime::getCurrent ();
+    epicsGuard < epicsMutex > guard ( this->mutex );
+    tcpiiu * piiu = this->pClosing;
+    while ( piiu ) {
+        if ( piiu->ioSendBusy || current < piiu->ioCloseDeadline ) {
+            piiu = piiu->pIoCloseNext;
+            continue;
+        }
+        tcpiiu & iiu = *piiu;
+        this->closingUnlink ( iiu );
+        // keeps the circuit installed while its lock is taken
+        iiu.ioSendBusy = true;
+        {
+            epicsGuardRelease < epicsMutex > unguard ( guard );
+            // it is possible to get here if the user calls
+            // ca_context_destroy() when a circuit isnt known to
+            // be unresponsive, but is
+            epicsGuard < epicsMutex > iiuGuard ( iiu.mutex );
+            iiu.initiateAbortShutdown ( iiuGuard );
+        }
+        iiu.ioSendBusy = false;
+        iiu.ioSendIdle.signal ();
+        piiu = this->pClosing;
+    }
+}
+
+void cacIoPool::recvFinished ( tcpiiu & iiu )
+{
+    {
+        epicsGuard < epicsMutex > guard ( iiu.mutex );
+        iiu.ioRecvDone = true;
+        if ( ! iiu.ioSendDone ) {
+            return;
+        }
+    }
+    this->uninstall ( iiu );
+}
+
+void cacIoPool::sendFinished ( tcpiiu & iiu )
+{
+    {
+        epicsGuard < epicsMutex > guard ( iiu.mutex );
+        iiu.ioSendDone = true;
+        if ( ! iiu.ioRecvDone ) {
+            // as the send thread waits for the receive thread
+            epicsGuard < epicsMutex > poolGuard ( this->mutex );
+            iiu.ioCloseDeadline = epicsTime::getCurrent () + ioCloseDelay;
+            iiu.ioClosing = true;
+            iiu.pIoCloseNext = this->pClosing;
+            this->pClosing = & iiu;
+            return;
+        }
+    }
+    this->uninstall ( iiu );
+}
+
+// both sides of the circuit have finished, so it is queued again
+// only by a thread already busy with it
+void cacIoPool::uninstall ( tcpiiu & iiu )
+{
+    {
+        epicsGuard < epicsMutex > guard ( this->mutex );
+        while ( iiu.ioSendBusy ) {
+            epicsGuardRelease < epicsMutex > unguard ( guard );
+            iiu.ioSendIdle.wait ();
+        }
+#ifdef CAC_HAVE_EPOLL
+        // neither side is armed, so no event refers to it
+        epoll_ctl ( this->epollFd, EPOLL_CTL_DEL, iiu.sock, 0 );
+#endif
+        this->sendQueUnlink ( iiu );
+        this->closingUnlink ( iiu );
+        this->nCircuits--;
+    }
+    iiu.uninstall ();
+}
+
+void cacIoPool::sendQueAdd ( tcpiiu & iiu )
+{
+    iiu.pIoSendNext = 0;
+    if ( this->pSendTail ) {
+        this->pSendTail->pIoSendNext = & iiu;
+    }
+    else {
+        this->pSendHead = & iiu;
+    }
+    this->pSendTail = & iiu;
+    iiu.ioSendQueued = true;
+    this->nSendQueued++;
+}
+
+void cacIoPool::sendQueUnlink ( tcpiiu & iiu )
+{
+    if ( ! iiu.ioSendQueued ) {
+        return;
+    }
+    tcpiiu * pPrev = 0;
+    tcpiiu * piiu = this->pSendHead;
+    while ( piiu != & iiu ) {
+        pPrev = piiu;
+        piiu = piiu->pIoSendNext;
+    }
+    if ( pPrev ) {
+        pPrev->pIoSendNext = iiu.pIoSendNext;
+    }
+    else {
+        this->pSendHead = iiu.pIoSendNext;
+    }
+    if ( this->pSendTail == & iiu ) {
+        this->pSendTail = pPrev;
+    }
+    iiu.pIoSendNext = 0;
+    iiu.ioSendQueued = false;
+    this->nSendQueued--;
+}
+
+void cacIoPool::closingUnlink ( tcpiiu & iiu )
+{
+    if ( ! iiu.ioClosing ) {
+        return;
+    }
+    tcpiiu ** ppiiu = & this->pClosing;
+    while ( *ppiiu != & iiu ) {
+        ppiiu = & ( *ppiiu )->pIoCloseNext;
+    }
+    *ppiiu = iiu.pIoCloseNext;
+    iiu.pIoCloseNext = 0;
+    iiu.ioClosing = false;
+}
+
+void cacIoPool::wakeup ()
+{
+#ifdef CAC_HAVE_EPOLL
+    epicsUInt64 one = 1u;
+    if ( write ( this->wakeFd, & one, sizeof ( one ) ) ) {
+        // the counter cant overflow in practice
+    }
+#endif
+}
+
+void cacIoPool::show ( unsigned level ) const
+{
+    epicsGuard < epicsMutex > guard ( this->mutex );
+    ::printf ( "I/O pool of %u threads serving %u virtual circuits\n",
+        this->nThreads, this->nCircuits );
+    if ( level > 0u ) {
+        ::printf ( "\t%u circuits with queued send labor, "
+            "%s shutting down\n", this->nSendQueued,
+            this->pClosing ? "some" : "none" );
+    }
+    if ( level > 1u ) {
+        for ( unsigned i = 0u; i < this->nThreads; i++ ) {
+            this->pThreads[i]->show ( level - 2u );
+        }
+    }
+}
@@ -0,0 +1,80 @@
+/*************************************************************************\
+* EPICS BASE is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+
+/*
+ * Shared I/O threads for the virtual circuits of a client context
+ *
+ * When EPICS_CA_IO_THREADS is set, the sockets of all circuits are
+ * watched by one epoll set instead of each circuit having a receive
+ * and a send thread. A fixed number of threads wait on that set, and
+ * each socket is registered with EPOLLONESHOT so only one of them at
+ * a time receives from a circuit. The send labor of a circuit is
+ * queued to the pool when the send thread would have been woken.
+ *
+ * The circuit's socket stays non-blocking. Its connect() does not
+ * block, the receive labor only consumes the bytes already pending,
+ * and the send labor stops when the socket is full and runs again
+ * once it is writable. The single EPOLLONESHOT registration of the
+ * socket carries EPOLLIN for the receive side and EPOLLOUT for a
+ * waiting send side, and each event goes to the side armed for it.
+ *
+ * Only contexts with preemptive callback enabled use the pool, since
+ * its threads would otherwise wait for ca_pend_event() while a flush
+ * waits for them. Circuits to the servers in EPICS_CA_NAME_SERVERS
+ * keep their threads.
+ */
+
+#ifndef INC_cacIoPool_H
+#define INC_cacIoPool_H
+
+#include "epicsMutex.h"
+#include "epicsGuard.h"
+#include "epicsThread.h"
+
+class cac;
+class tcpiiu;
+
+class cacIoPool : private epicsThreadRunable {
+public:
+    // zero if the target has no epoll or the pool cant be created
+    static cacIoPool * create ( cac &, unsigned nThreads, unsigned priority );
+    ~cacIoPool ();
+    // false if the circuit must run its own threads instead
+    bool connect ( epicsGuard < epicsMutex > &, tcpiiu & );
+    void sendRequest ( epicsGuard < epicsMutex > &, tcpiiu & );
+    void show ( unsigned level ) const;
+private:
+    mutable epicsMutex mutex;
+    cac & cacRef;
+    epicsThread ** pThreads;
+    tcpiiu * pSendHead; // circuits with queued send labor
+    tcpiiu * pSendTail;
+    tcpiiu * pClosing; // send side finished, receive side still open
+    unsigned nThreads;
+    unsigned nCircuits;
+    unsigned nSendQueued;
+    int epollFd;
+    int wakeFd;
+    bool exitFlag;
+
+    cacIoPool ( cac &, int epollFd, int wakeFd );
+    void run ();
+    void dispatch ( tcpiiu &, unsigned events );
+    bool arm ( tcpiiu & );
+    void service ( tcpiiu & );
+    void sendLabor ();
+    void closeExpired ();
+    void recvFinished ( tcpiiu & );
+    void sendFinished ( tcpiiu & );
+    void uninstall ( tcpiiu & );
+    void sendQueAdd ( tcpiiu & );
+    void sendQueUnlink ( tcpiiu & );
+    void closingUnlink ( tcpiiu & );
+    void wakeup ();
+    cacIoPool ( const cacIoPool & );
+    cacIoPool & operator = ( const cacIoPool & );
+};
+
+#endif // ifndef INC_cacIoPool_H
@@ -217,6 +217,31 @@ LIBCA_API int epicsStdCall ca_create_channel
      chid           *pChanID
 );
 
+/*
+ * ca_create_channels ()
+ *
+ * Creates count channels holding the client library's lock once. Either all
+ * of the channels are created or none of them are.
+ *
+ * count                R   number of channels to create
+ * pChanNames           R   array of count channel name strings
+ * pConnStateCallback   R   address of connection state change
+ *                          callback function used for all of the channels
+ * pUserPrivates        R   array of count pointers placed in the channels'
+ *                          user private fields, or NULL for all NULL
+ * priority             R   priority level in the server 0 - 100
+ * pChanIDs             RW  array of count channel ids written here
+ */
+LIBCA_API int epicsStdCall ca_create_channels
+(
+     unsigned       count,
+     const char     * const *pChanNames,
+     caCh           *pConnStateCallback,
+     void           * const *pUserPrivates,
+     capri          priority,
+     chid           *pChanIDs
+);
+
 /*
  * ca_change_connection_event()
  *
@@ -34,7 +34,7 @@ bool comBuf::flushToWire ( wireSendAdapter & wire, const epicsTime & currentTime
     unsigned finalIndex = this->commitIndex;
     while ( index < finalIndex ) {
         unsigned nBytes = wire.sendBytes (
-            &this->buf[index], finalIndex - index, currentTime );
+            &this->buf()[index], finalIndex - index, currentTime );
         if ( nBytes == 0u ) {
             this->nextReadIndex = index;
             return false;
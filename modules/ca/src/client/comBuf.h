@@ -34,6 +34,7 @@
 #include "osiWireFormat.h"
 #include "compilerDependencies.h"
 
+// default, and smallest, capacity of a buffer
 static const unsigned comBufSize = 0x4000;
 
 // this wrapper avoids Tornado 2.0.1 compiler bugs
@@ -42,6 +43,9 @@ public:
     virtual ~comBufMemoryManager ();
     virtual void * allocate ( size_t ) = 0;
     virtual void release ( void * ) = 0;
+    // the bytes allocated for each buffer include this
+    // many following the comBuf object itself
+    virtual unsigned capacityBytes () const = 0;
 };
 
 class wireSendAdapter {
@@ -76,11 +80,11 @@ protected:
 class comBuf : public tsDLNode < comBuf > {
 public:
     class insufficentBytesAvailable {};
-    comBuf ();
+    comBuf ( unsigned capacity );
     unsigned unoccupiedBytes () const;
     unsigned occupiedBytes () const;
     unsigned uncommittedBytes () const;
-    static unsigned capacityBytes ();
+    unsigned capacityBytes () const;
     void clear ();
     unsigned copyInBytes ( const void *pBuf, unsigned nBytes );
     unsigned push ( comBuf & );
@@ -113,7 +117,9 @@ private:
     unsigned commitIndex;
     unsigned nextWriteIndex;
     unsigned nextReadIndex;
-    epicsUInt8 buf [ comBufSize ];
+    unsigned capacity;
+    epicsUInt8 * buf ();
+    const epicsUInt8 * buf () const;
     void operator delete ( void * );
     template < class T >
     bool push ( const T * ); // disabled
@@ -133,11 +139,22 @@ inline void comBuf::operator delete ( void * pCadaver,
 }
 #endif
 
-inline comBuf::comBuf () : commitIndex ( 0u ),
-    nextWriteIndex ( 0u ), nextReadIndex ( 0u )
+inline comBuf::comBuf ( unsigned capacityIn ) : commitIndex ( 0u ),
+    nextWriteIndex ( 0u ), nextReadIndex ( 0u ), capacity ( capacityIn )
 {
 }
 
+// the bytes are allocated with the object, immediately following it
+inline epicsUInt8 * comBuf :: buf ()
+{
+    return reinterpret_cast < epicsUInt8 * > ( this + 1 );
+}
+
+inline const epicsUInt8 * comBuf :: buf () const
+{
+    return reinterpret_cast < const epicsUInt8 * > ( this + 1 );
+}
+
 inline void comBuf :: clear ()
 {
     this->commitIndex = 0u;
@@ -147,7 +164,7 @@ inline void comBuf :: clear ()
 
 inline unsigned comBuf :: unoccupiedBytes () const
 {
-    return sizeof ( this->buf ) - this->nextWriteIndex;
+    return this->capacity - this->nextWriteIndex;
 }
 
 inline unsigned comBuf :: occupiedBytes () const
@@ -163,23 +180,23 @@ inline unsigned comBuf :: uncommittedBytes () const
 inline unsigned comBuf :: push ( comBuf & bufIn )
 {
     unsigned nBytes = this->copyInBytes (
-        & bufIn.buf[ bufIn.nextReadIndex ],
+        & bufIn.buf()[ bufIn.nextReadIndex ],
         bufIn.commitIndex - bufIn.nextReadIndex );
     bufIn.nextReadIndex += nBytes;
     return nBytes;
 }
 
-inline unsigned comBuf :: capacityBytes ()
+inline unsigned comBuf :: capacityBytes () const
 {
-    return comBufSize;
+    return this->capacity;
 }
 
 inline void comBuf :: fillFromWire (
     wireRecvAdapter & wire, statusWireIO & stat )
 {
     wire.recvBytes (
-        & this->buf[this->nextWriteIndex],
-        sizeof ( this->buf ) - this->nextWriteIndex, stat );
+        & this->buf()[this->nextWriteIndex],
+        this->capacity - this->nextWriteIndex, stat );
     if ( stat.circuitState == swioConnected ) {
         this->nextWriteIndex += stat.bytesCopied;
     }
@@ -189,11 +206,11 @@ template < class T >
 inline bool comBuf :: push ( const T & value )
 {
     unsigned index = this->nextWriteIndex;
-    unsigned available = sizeof ( this->buf ) - index;
+    unsigned available = this->capacity - index;
     if ( sizeof ( value ) > available ) {
         return false;
     }
-    WireSet ( value, & this->buf[index] );
+    WireSet ( value, & this->buf()[index] );
     this->nextWriteIndex = index + sizeof ( value );
     return true;
 }
@@ -211,13 +228,13 @@ inline unsigned comBuf :: push ( const epicsUInt8 *pValue, unsigned nElem )
 inline unsigned comBuf :: push ( const epicsOldString * pValue, unsigned nElem )
 {
     unsigned index = this->nextWriteIndex;
-    unsigned available = sizeof ( this->buf ) - index;
+    unsigned available = this->capacity - index;
     unsigned nBytes = sizeof ( *pValue ) * nElem;
     if ( nBytes > available ) {
         nElem = available / sizeof ( *pValue );
         nBytes = nElem * sizeof ( *pValue );
     }
-    memcpy ( &this->buf[ index ], pValue, nBytes );
+    memcpy ( &this->buf()[ index ], pValue, nBytes );
     this->nextWriteIndex = index + nBytes;
     return nElem;
 }
@@ -226,14 +243,14 @@ template < class T >
 unsigned comBuf :: push ( const T * pValue, unsigned nElem )
 {
     unsigned index = this->nextWriteIndex;
-    unsigned available = sizeof ( this->buf ) - index;
+    unsigned available = this->capacity - index;
     unsigned nBytes = sizeof ( *pValue ) * nElem;
     if ( nBytes > available ) {
         nElem = available / sizeof ( *pValue );
     }
     for ( unsigned i = 0u; i < nElem; i++ ) {
         // allow native floating point formats to be converted to IEEE
-        WireSet( pValue[i], &this->buf[index] );
+        WireSet( pValue[i], &this->buf()[index] );
         index += sizeof ( *pValue );
     }
     this->nextWriteIndex = index;
@@ -253,9 +270,9 @@ inline void comBuf :: clearUncommittedIncomming ()
 inline bool comBuf :: copyInAllBytes ( const void *pBuf, unsigned nBytes )
 {
     unsigned index = this->nextWriteIndex;
-    unsigned available = sizeof ( this->buf ) - index;
+    unsigned available = this->capacity - index;
     if ( nBytes <= available ) {
-        memcpy ( & this->buf[index], pBuf, nBytes );
+        memcpy ( & this->buf()[index], pBuf, nBytes );
         this->nextWriteIndex = index + nBytes;
         return true;
     }
@@ -265,11 +282,11 @@ inline bool comBuf :: copyInAllBytes ( const void *pBuf, unsigned nBytes )
 inline unsigned comBuf :: copyInBytes ( const void * pBuf, unsigned nBytes )
 {
     unsigned index = this->nextWriteIndex;
-    unsigned available = sizeof ( this->buf ) - index;
+    unsigned available = this->capacity - index;
     if ( nBytes > available ) {
         nBytes = available;
     }
-    memcpy ( & this->buf[index], pBuf, nBytes );
+    memcpy ( & this->buf()[index], pBuf, nBytes );
     this->nextWriteIndex = index + nBytes;
     return nBytes;
 }
@@ -279,7 +296,7 @@ inline bool comBuf :: copyOutAllBytes ( void * pBuf, unsigned nBytes )
     unsigned index = this->nextReadIndex;
     unsigned occupied = this->commitIndex - index;
     if ( nBytes <= occupied ) {
-        memcpy ( pBuf, &this->buf[index], nBytes);
+        memcpy ( pBuf, &this->buf()[index], nBytes);
         this->nextReadIndex = index + nBytes;
         return true;
     }
@@ -293,7 +310,7 @@ inline unsigned comBuf :: copyOutBytes ( void *pBuf, unsigned nBytes )
     if ( nBytes > occupied ) {
         nBytes = occupied;
     }
-    memcpy ( pBuf, &this->buf[index], nBytes);
+    memcpy ( pBuf, &this->buf()[index], nBytes);
     this->nextReadIndex = index + nBytes;
     return nBytes;
 }
@@ -327,7 +344,7 @@ comBuf :: popStatus comBuf :: pop ( T & returnVal )
             return status;
         }
     }
-    WireGet ( & this->buf[ nrIndex ], returnVal );
+    WireGet ( & this->buf()[ nrIndex ], returnVal );
     this->nextReadIndex = popIndex;
     return status;
 }
@@ -221,18 +221,21 @@ inline unsigned comQueSend::occupiedBytes () const
 
 inline bool comQueSend::flushBlockThreshold () const
 {
-    return ( this->nBytesPending > 16 * comBuf::capacityBytes () );
+    return ( this->nBytesPending >
+        16 * this->comBufMemMgr.capacityBytes () );
 }
 
 inline bool comQueSend::flushEarlyThreshold ( unsigned nBytesThisMsg ) const
 {
-    return ( this->nBytesPending + nBytesThisMsg > 4 * comBuf::capacityBytes () );
+    return ( this->nBytesPending + nBytesThisMsg >
+        4 * this->comBufMemMgr.capacityBytes () );
 }
 
 // wrapping this with a function avoids WRS T2.2 Cygnus GNU compiler bugs
 inline comBuf * comQueSend::newComBuf ()
 {
-    return new ( this->comBufMemMgr ) comBuf;
+    return new ( this->comBufMemMgr )
+        comBuf ( this->comBufMemMgr.capacityBytes () );
 }
 
 #endif // ifndef INC_comQueSend_H
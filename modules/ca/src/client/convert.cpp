@@ -30,6 +30,7 @@
 #include "osiWireFormat.h"
 
 #include "net_convert.h"
+#include "caSwapKernels.h"
 #include "iocinf.h"
 #include "caProto.h"
 #include "caerr.h"
@@ -97,6 +98,45 @@ inline epicsUInt32 dbr_htonl ( const epicsUInt32 & host )
     return tmp;
 }
 
+/*
+ * The best kernels known at compile time are used until the CPU
+ * has been checked for better ones when the library is loaded,
+ * they are not changed after that
+ */
+static const cacSwapKernels * pSwapKernels =
+#if defined ( CA_SWAP_SSE2 )
+    & swapSSE2;
+#elif defined ( CA_SWAP_NEON )
+    & swapNEON;
+#else
+    & swapScalar;
+#endif
+
+static struct cacSwapKernelsInit {
+    cacSwapKernelsInit () { pSwapKernels = bestSwapKernels (); }
+} swapKernelsInit;
+
+/* not worth an indirect call for scalars and short arrays */
+static const arrayElementCount bulkSwapMin = 16u;
+
+inline arrayElementCount bulkSwap16 (
+    const void *pSrc, void *pDest, arrayElementCount num )
+{
+    return num < bulkSwapMin ? 0u : pSwapKernels->swap16 ( pSrc, pDest, num );
+}
+
+inline arrayElementCount bulkSwap32 (
+    const void *pSrc, void *pDest, arrayElementCount num )
+{
+    return num < bulkSwapMin ? 0u : pSwapKernels->swap32 ( pSrc, pDest, num );
+}
+
+inline arrayElementCount bulkSwap64 (
+    const void *pSrc, void *pDest, arrayElementCount num )
+{
+    return num < bulkSwapMin ? 0u : pSwapKernels->swap64 ( pSrc, pDest, num );
+}
+
 /*
  * if hton is true then it is a host to network conversion
  * otherwise vise-versa
@@ -137,13 +177,15 @@ arrayElementCount   num         /* number of values     */
     dbr_short_t         *pSrc = (dbr_short_t *) s;
     dbr_short_t         *pDest = (dbr_short_t *) d;
 
+    arrayElementCount i = bulkSwap16 ( pSrc, pDest, num );
+
     if(encode){
-        for(arrayElementCount i=0; i<num; i++){
+        for( ; i<num; i++){
             pDest[i] = dbr_htons( pSrc[i] );
         }
     }
     else {
-        for(arrayElementCount i=0; i<num; i++){
+        for( ; i<num; i++){
             pDest[i] = dbr_ntohs( pSrc[i] );
         }
     }
@@ -187,13 +229,15 @@ arrayElementCount   num         /* number of values     */
     dbr_long_t          *pSrc = (dbr_long_t *) s;
     dbr_long_t          *pDest = (dbr_long_t *) d;
 
+    arrayElementCount i = bulkSwap32 ( pSrc, pDest, num );
+
     if(encode){
-        for(arrayElementCount i=0; i<num; i++){
+        for( ; i<num; i++){
             pDest[i] = dbr_htonl( pSrc[i] );
         }
     }
     else {
-        for(arrayElementCount i=0; i<num; i++){
+        for( ; i<num; i++){
             pDest[i] = dbr_ntohl( pSrc[i] );
         }
     }
@@ -216,13 +260,15 @@ arrayElementCount   num         /* number of values     */
     dbr_enum_t          *pSrc = (dbr_enum_t *) s;
     dbr_enum_t          *pDest = (dbr_enum_t *) d;
 
+    arrayElementCount i = bulkSwap16 ( pSrc, pDest, num );
+
     if(encode){
-        for(arrayElementCount i=0; i<num; i++){
+        for( ; i<num; i++){
             pDest[i] = dbr_htons ( pSrc[i] );
         }
     }
     else {
-        for(arrayElementCount i=0; i<num; i++){
+        for( ; i<num; i++){
             pDest[i] = dbr_ntohs ( pSrc[i] );
         }
     }
@@ -247,13 +293,15 @@ arrayElementCount   num         /* number of values     */
     const dbr_float_t   *pSrc = (const dbr_float_t *) s;
     dbr_float_t         *pDest = (dbr_float_t *) d;
 
+    arrayElementCount i = bulkSwap32 ( pSrc, pDest, num );
+
     if(encode){
-        for(arrayElementCount i=0; i<num; i++){
+        for( ; i<num; i++){
             dbr_htonf ( &pSrc[i], &pDest[i] );
         }
     }
     else{
-        for(arrayElementCount i=0; i<num; i++){
+        for( ; i<num; i++){
             dbr_ntohf ( &pSrc[i], &pDest[i] );
         }
     }
@@ -272,13 +320,15 @@ arrayElementCount   num         /* number of values     */
     dbr_double_t        *pSrc = (dbr_double_t *) s;
     dbr_double_t        *pDest = (dbr_double_t *) d;
 
+    arrayElementCount i = bulkSwap64 ( pSrc, pDest, num );
+
     if(encode){
-        for(arrayElementCount i=0; i<num; i++){
+        for( ; i<num; i++){
             dbr_htond ( &pSrc[i], &pDest[i] );
         }
     }
     else{
-        for(arrayElementCount i=0; i<num; i++){
+        for( ; i<num; i++){
             dbr_ntohd( &pSrc[i], &pDest[i] );
         }
     }
@@ -1080,7 +1130,7 @@ arrayElementCount   num         /* number of values     */
         pDest->value = dbr_ntohl(pSrc->value);
     else        /* array chan-- multiple pts */
     {
-        cvrt_long(&pDest->value, &pSrc->value, encode, num);
+        cvrt_long(&pSrc->value, &pDest->value, encode, num);
     }
 }
 
@@ -1300,7 +1350,7 @@ arrayElementCount   num         /* number of values     */
         pDest->value = dbr_ntohl(pSrc->value);
     else        /* array chan-- multiple pts */
     {
-        cvrt_long(&pDest->value, &pSrc->value, encode, num);
+        cvrt_long(&pSrc->value, &pDest->value, encode, num);
     }
 }
 
@@ -0,0 +1,291 @@
+/*************************************************************************\
+* EPICS BASE is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+
+/*
+ * Persistent cache of the servers where channel names were last found,
+ * see nameCache.h
+ *
+ * The file has one line for each name, the address the server replied
+ * to the search from followed by a space and the name:
+ *
+ *     10.0.0.5:5064 XXX:YYY:ZZZ
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+
+#include "errlog.h"
+#include "osiSock.h"
+
+#include "iocinf.h"
+#include "caProto.h"
+#include "nameCache.h"
+
+// longest line read back, names can't exceed a search datagram
+static const unsigned nameCacheMaxLine = MAX_UDP_SEND + 32u;
+
+nameCacheServer::nameCacheServer ( const struct sockaddr_in & addrIn ) :
+    inetAddrID ( addrIn ), serverAddr ( addrIn ),
+    anomalies ( 0u ), nNames ( 0u )
+{
+}
+
+void nameCacheServer::operator delete ( void * )
+{
+    // Visual C++ .net appears to require operator delete if
+    // placement operator delete is defined? I smell a ms rat
+    // because if I declare placement new and delete, but
+    // comment out the placement delete definition there are
+    // no undefined symbols.
+    errlogPrintf ( "%s:%d this compiler is confused about placement delete - memory was probably leaked",
+        __FILE__, __LINE__ );
+}
+
+nameCacheEntry::nameCacheEntry ( const char * pName,
+        nameCacheServer & server ) :
+    stringId ( pName ), pServer ( & server )
+{
+    server.nNames++;
+}
+
+void nameCacheEntry::operator delete ( void * )
+{
+    // Visual C++ .net appears to require operator delete if
+    // placement operator delete is defined? I smell a ms rat
+    // because if I declare placement new and delete, but
+    // comment out the placement delete definition there are
+    // no undefined symbols.
+    errlogPrintf ( "%s:%d this compiler is confused about placement delete - memory was probably leaked",
+        __FILE__, __LINE__ );
+}
+
+nameCache::nameCache ( const char * pFileName ) :
+    fileName ( pFileName ), nHits ( 0u ), nMisses ( 0u ), nDropped ( 0u )
+{
+    this->load ();
+}
+
+nameCache::~nameCache ()
+{
+    tsSLList < nameCacheEntry > entries;
+    this->names.removeAll ( entries );
+    while ( nameCacheEntry * pEntry = entries.get () ) {
+        pEntry->~nameCacheEntry ();
+        this->entryFreeList.release ( pEntry );
+    }
+    tsSLList < nameCacheServer > serverList;
+    this->servers.removeAll ( serverList );
+    while ( nameCacheServer * pServer = serverList.get () ) {
+        pServer->~nameCacheServer ();
+        this->serverFreeList.release ( pServer );
+    }
+}
+
+nameCacheServer & nameCache::findOrCreateServer (
+    const struct sockaddr_in & addr )
+{
+    nameCacheServer * pServer = this->servers.lookup ( addr );
+    if ( ! pServer ) {
+        pServer = new ( this->serverFreeList ) nameCacheServer ( addr );
+        this->servers.add ( *pServer );
+    }
+    return *pServer;
+}
+
+void nameCache::destroyEntry ( nameCacheEntry & entry )
+{
+    this->names.remove ( entry );
+    entry.pServer->nNames--;
+    entry.~nameCacheEntry ();
+    this->entryFreeList.release ( & entry );
+}
+
+void nameCache::load ()
+{
+    FILE * pFile = fopen ( this->fileName.c_str (), "r" );
+    if ( ! pFile ) {
+        if ( errno != ENOENT ) {
+            errlogPrintf ( "CAC: unable to read name cache \"%s\" because "
+                "\"%s\"\n", this->fileName.c_str (), strerror ( errno ) );
+        }
+        return;
+    }
+
+    char line [nameCacheMaxLine];
+    unsigned nBad = 0u;
+    while ( fgets ( line, sizeof ( line ), pFile ) ) {
+        size_t len = strlen ( line );
+        if ( len == 0u || line[len - 1u] != '\n' ) {
+            // skip the remainder of a line that is too long
+            int c;
+            do {
+                c = getc ( pFile );
+            } while ( c != '\n' && c != EOF );
+            nBad++;
+            continue;
+        }
+        line[--len] = '\0';
+        if ( len > 0u && line[len - 1u] == '\r' ) {
+            line[--len] = '\0';
+        }
+        char * pName = strchr ( line, ' ' );
+        if ( ! pName || pName[1] == '\0' ) {
+            nBad++;
+            continue;
+        }
+        *pName++ = '\0';
+        struct sockaddr_in addr;
+        if ( aToIPAddr ( line, CA_SERVER_PORT, & addr ) ) {
+            nBad++;
+            continue;
+        }
+        if ( this->names.lookup ( stringId ( pName, stringId::refString ) ) ) {
+            continue;
+        }
+        nameCacheEntry * pEntry = new ( this->entryFreeList )
+            nameCacheEntry ( pName, this->findOrCreateServer ( addr ) );
+        this->names.add ( *pEntry );
+    }
+    fclose ( pFile );
+
+    if ( nBad ) {
+        errlogPrintf ( "CAC: ignored %u malformed lines in name cache \"%s\"\n",
+            nBad, this->fileName.c_str () );
+    }
+}
+
+bool nameCache::lookup ( epicsGuard < epicsMutex > &, const char * pName,
+    bool firstTry, unsigned & epoch, struct sockaddr_in & addr )
+{
+    nameCacheEntry * pEntry =
+        this->names.lookup ( stringId ( pName, stringId::refString ) );
+    if ( ! pEntry ) {
+        if ( firstTry ) {
+            this->nMisses++;
+        }
+        return false;
+    }
+    // after the first try only a beacon anomaly from the
+    // server justifies trying it again before the broadcast
+    if ( ! firstTry && epoch == pEntry->pServer->anomalies ) {
+        return false;
+    }
+    this->nHits++;
+    epoch = pEntry->pServer->anomalies;
+    addr = pEntry->pServer->serverAddr;
+    return true;
+}
+
+void nameCache::update ( epicsGuard < epicsMutex > &, const char * pName,
+    const struct sockaddr_in & addr )
+{
+    nameCacheEntry * pEntry =
+        this->names.lookup ( stringId ( pName, stringId::refString ) );
+    if ( pEntry ) {
+        if ( * pEntry->pServer == inetAddrID ( addr ) ) {
+            return;
+        }
+        pEntry->pServer->nNames--;
+        pEntry->pServer = & this->findOrCreateServer ( addr );
+        pEntry->pServer->nNames++;
+        return;
+    }
+    pEntry = new ( this->entryFreeList )
+        nameCacheEntry ( pName, this->findOrCreateServer ( addr ) );
+    this->names.add ( *pEntry );
+}
+
+void nameCache::notFound ( epicsGuard < epicsMutex > &, const char * pName,
+    const struct sockaddr_in & addr )
+{
+    nameCacheEntry * pEntry =
+        this->names.lookup ( stringId ( pName, stringId::refString ) );
+    if ( pEntry && * pEntry->pServer == inetAddrID ( addr ) ) {
+        this->destroyEntry ( *pEntry );
+        this->nDropped++;
+    }
+}
+
+// beacons carry the port of the server's circuit, which need not
+// be the one it receives searches on, so only the host is compared
+void nameCache::beaconAnomaly ( epicsGuard < epicsMutex > &,
+    const struct sockaddr_in & addr )
+{
+    resTableIter < nameCacheServer, inetAddrID > pServer =
+        this->servers.firstIter ();
+    while ( pServer.valid () ) {
+        if ( pServer->serverAddr.sin_addr.s_addr ==
+                addr.sin_addr.s_addr ) {
+            pServer->anomalies++;
+        }
+        pServer++;
+    }
+}
+
+void nameCache::save ( epicsGuard < epicsMutex > & ) const
+{
+    std::string tmpName ( this->fileName );
+    tmpName += ".tmp";
+    FILE * pFile = fopen ( tmpName.c_str (), "w" );
+    if ( ! pFile ) {
+        errlogPrintf ( "CAC: unable to write name cache \"%s\" because "
+            "\"%s\"\n", tmpName.c_str (), strerror ( errno ) );
+        return;
+    }
+
+    bool ok = true;
+    char addrBuf[64];
+    resTableIterConst < nameCacheEntry, stringId > pEntry =
+        this->names.firstIter ();
+    while ( ok && pEntry.valid () ) {
+        ipAddrToDottedIP ( & pEntry->pServer->serverAddr,
+            addrBuf, sizeof ( addrBuf ) );
+        ok = fprintf ( pFile, "%s %s\n", addrBuf,
+            pEntry->resourceName () ) > 0;
+        pEntry++;
+    }
+    if ( fclose ( pFile ) ) {
+        ok = false;
+    }
+    if ( ! ok ) {
+        errlogPrintf ( "CAC: unable to write name cache \"%s\"\n",
+            tmpName.c_str () );
+        remove ( tmpName.c_str () );
+        return;
+    }
+    // WIN32 wont rename over an existing file
+    if ( rename ( tmpName.c_str (), this->fileName.c_str () ) ) {
+        remove ( this->fileName.c_str () );
+        if ( rename ( tmpName.c_str (), this->fileName.c_str () ) ) {
+            errlogPrintf ( "CAC: unable to replace name cache \"%s\" "
+                "because \"%s\"\n", this->fileName.c_str (),
+                strerror ( errno ) );
+        }
+    }
+}
+
+void nameCache::show ( epicsGuard < epicsMutex > &, unsigned level ) const
+{
+    ::printf ( "Name cache \"%s\" with %u names at %u servers\n",
+        this->fileName.c_str (), this->names.numEntriesInstalled (),
+        this->servers.numEntriesInstalled () );
+    if ( level > 0u ) {
+        ::printf ( "\t%u searches sent to a cached server, %u names not "
+            "cached, %u entries dropped\n", this->nHits, this->nMisses,
+            this->nDropped );
+    }
+    if ( level > 1u ) {
+        resTableIterConst < nameCacheServer, inetAddrID > pServer =
+            this->servers.firstIter ();
+        while ( pServer.valid () ) {
+            char buf[64];
+            pServer->name ( buf, sizeof ( buf ) );
+            ::printf ( "\t%s with %u names, %u beacon anomalies\n",
+                buf, pServer->nNames, pServer->anomalies );
+            pServer++;
+        }
+    }
+}
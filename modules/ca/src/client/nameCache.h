@@ -0,0 +1,127 @@
+/*************************************************************************\
+* EPICS BASE is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+
+/*
+ * Persistent cache of the servers where channel names were last found
+ *
+ * When EPICS_CA_NAME_CACHE names a file, the first search for a channel
+ * is sent only to the server that the cache remembers for its name, and
+ * the broadcast to EPICS_CA_ADDR_LIST follows at the next search period
+ * if that server doesnt reply. The file is read when the context is
+ * created and written back when it is destroyed.
+ *
+ * The cache keeps the address each search reply came from, which is
+ * where the server receives searches, rather than the address of its
+ * circuit. A beacon anomaly (a server restarted, or reappeared) from a
+ * host lets the channels still searching try the cached servers on
+ * that host once more before the broadcast resumes. An entry is
+ * dropped when its server replies that it doesnt have the channel.
+ */
+
+#ifndef INC_nameCache_H
+#define INC_nameCache_H
+
+#include <string>
+
+#include "tsSLList.h"
+#include "tsFreeList.h"
+#include "resourceLib.h"
+#include "epicsGuard.h"
+#include "epicsMutex.h"
+#include "compilerDependencies.h"
+
+#include "inetAddrID.h"
+
+class nameCacheServer :
+    public tsSLNode < nameCacheServer >,
+    public inetAddrID {
+public:
+    nameCacheServer ( const struct sockaddr_in & );
+    struct sockaddr_in serverAddr;
+    unsigned anomalies; // beacon anomalies seen from the server
+    unsigned nNames;
+    void * operator new ( size_t size,
+        tsFreeList < nameCacheServer, 0x20, epicsMutexNOOP > & );
+    epicsPlacementDeleteOperator (( void *,
+        tsFreeList < nameCacheServer, 0x20, epicsMutexNOOP > & ))
+private:
+    void operator delete ( void * );
+};
+
+class nameCacheEntry :
+    public tsSLNode < nameCacheEntry >,
+    public stringId {
+public:
+    nameCacheEntry ( const char * pName, nameCacheServer & );
+    nameCacheServer * pServer;
+    void * operator new ( size_t size,
+        tsFreeList < nameCacheEntry, 1024, epicsMutexNOOP > & );
+    epicsPlacementDeleteOperator (( void *,
+        tsFreeList < nameCacheEntry, 1024, epicsMutexNOOP > & ))
+private:
+    void operator delete ( void * );
+};
+
+class nameCache {
+public:
+    nameCache ( const char * pFileName );
+    ~nameCache ();
+    // true if a search for the name should be sent to addr, epoch is
+    // the server's anomaly count when it was last tried for the channel
+    bool lookup ( epicsGuard < epicsMutex > &, const char * pName,
+        bool firstTry, unsigned & epoch, struct sockaddr_in & addr );
+    void update ( epicsGuard < epicsMutex > &, const char * pName,
+        const struct sockaddr_in & );
+    void notFound ( epicsGuard < epicsMutex > &, const char * pName,
+        const struct sockaddr_in & );
+    void beaconAnomaly ( epicsGuard < epicsMutex > &,
+        const struct sockaddr_in & );
+    void save ( epicsGuard < epicsMutex > & ) const;
+    void show ( epicsGuard < epicsMutex > &, unsigned level ) const;
+private:
+    resTable < nameCacheEntry, stringId > names;
+    resTable < nameCacheServer, inetAddrID > servers;
+    tsFreeList < nameCacheEntry, 1024, epicsMutexNOOP > entryFreeList;
+    tsFreeList < nameCacheServer, 0x20, epicsMutexNOOP > serverFreeList;
+    std::string fileName;
+    unsigned nHits;
+    unsigned nMisses;
+    unsigned nDropped;
+    nameCacheServer & findOrCreateServer ( const struct sockaddr_in & );
+    void load ();
+    void destroyEntry ( nameCacheEntry & );
+    nameCache ( const nameCache & );
+    nameCache & operator = ( const nameCache & );
+};
+
+inline void * nameCacheServer::operator new ( size_t size,
+    tsFreeList < nameCacheServer, 0x20, epicsMutexNOOP > & freeList )
+{
+    return freeList.allocate ( size );
+}
+
+#ifdef CXX_PLACEMENT_DELETE
+inline void nameCacheServer::operator delete ( void * pCadaver,
+    tsFreeList < nameCacheServer, 0x20, epicsMutexNOOP > & freeList )
+{
+    freeList.release ( pCadaver, sizeof ( nameCacheServer ) );
+}
+#endif
+
+inline void * nameCacheEntry::operator new ( size_t size,
+    tsFreeList < nameCacheEntry, 1024, epicsMutexNOOP > & freeList )
+{
+    return freeList.allocate ( size );
+}
+
+#ifdef CXX_PLACEMENT_DELETE
+inline void nameCacheEntry::operator delete ( void * pCadaver,
+    tsFreeList < nameCacheEntry, 1024, epicsMutexNOOP > & freeList )
+{
+    freeList.release ( pCadaver, sizeof ( nameCacheEntry ) );
+}
+#endif
+
+#endif // ifndef INC_nameCache_H
@@ -46,6 +46,7 @@ nciu::nciu ( cac & cacIn, netiiu & iiuIn, cacChannelNotify & chanIn,
     sid ( UINT_MAX ),
     count ( 0 ),
     retry ( 0u ),
+    nameCacheEpoch ( 0u ),
     nameLength ( 0u ),
     typeCode ( USHRT_MAX ),
     priority ( static_cast <ca_uint8_t> ( pri ) )
@@ -214,12 +215,18 @@ void nciu::accessRightsStateChange (
  */
 bool nciu::searchMsg ( epicsGuard < epicsMutex > & guard )
 {
+   osiSockAddr cachedAddr;
+   unsigned epoch = this->nameCacheEpoch;
+   bool cached = this->cacCtx.nameCacheLookup ( guard,
+        this->pNameStr, this->retry == 0u, epoch, cachedAddr );
    bool success = this->piiu->searchMsg (
-        guard, this->getId (), this->pNameStr, this->nameLength );
+        guard, this->getId (), this->pNameStr, this->nameLength,
+        cached ? & cachedAddr : 0 );
    if ( success ) {
         if ( this->retry < UINT_MAX ) {
             this->retry++;
         }
+        this->nameCacheEpoch = epoch;
    }
    return success;
 }
@@ -33,7 +33,7 @@
 
 #include "libCaAPI.h"
 
-#define CA_MINOR_PROTOCOL_REVISION 13
+#define CA_MINOR_PROTOCOL_REVISION 14
 #include "caProto.h"
 
 #include "cacIO.h"
@@ -209,6 +209,7 @@ private:
     ca_uint32_t sid; // server id
     unsigned count;
     unsigned retry; // search retry number
+    unsigned nameCacheEpoch; // see nameCache::lookup ()
     unsigned short nameLength; // channel name length
     ca_uint16_t typeCode;
     ca_uint8_t priority;
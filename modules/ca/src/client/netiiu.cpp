@@ -166,7 +166,8 @@ void netiiu::uninstallChanDueToSuccessfulSearchResponse (
 
 bool netiiu::searchMsg (
     epicsGuard < epicsMutex > &, ca_uint32_t /* id */,
-    const char * /* pName */, unsigned /* nameLength */ )
+    const char * /* pName */, unsigned /* nameLength */,
+    const osiSockAddr * /* pCachedServer */ )
 {
     return false;
 }
@@ -161,9 +161,10 @@ void noopiiu::uninstallChanDueToSuccessfulSearchResponse (
 
 bool noopiiu::searchMsg (
     epicsGuard < epicsMutex > & guard, ca_uint32_t id,
-        const char * pName, unsigned nameLength )
+        const char * pName, unsigned nameLength,
+        const osiSockAddr * pCachedServer )
 {
     return netiiu::searchMsg (
-        guard, id, pName, nameLength );
+        guard, id, pName, nameLength, pCachedServer );
 }
 
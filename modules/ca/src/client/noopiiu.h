@@ -84,7 +84,8 @@ public:
         epicsGuard < epicsMutex > & ) const;
     bool searchMsg (
         epicsGuard < epicsMutex > &, ca_uint32_t id,
-            const char * pName, unsigned nameLength );
+            const char * pName, unsigned nameLength,
+            const osiSockAddr * pCachedServer );
 };
 
 extern noopiiu noopIIU;
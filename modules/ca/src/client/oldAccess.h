@@ -301,10 +301,13 @@ public:
         caExceptionHandler * pfunc, void * arg );
     void registerForFileDescriptorCallBack (
         CAFDHANDLER * pFunc, void * pArg );
+    void fdRegFuncCall ();
     void replaceErrLogHandler ( caPrintfFunc * ca_printf_func );
     cacChannel & createChannel (
         epicsGuard < epicsMutex > &, const char * pChannelName,
         cacChannelNotify &, cacChannel::priLev pri );
+    void reserveChannels (
+        epicsGuard < epicsMutex > &, unsigned nChannels );
     void flush ( epicsGuard < epicsMutex > & );
     void eliminateExcessiveSendBacklog (
         epicsGuard < epicsMutex > &, cacChannel & );
@@ -355,6 +358,9 @@ public:
     friend int epicsStdCall ca_create_channel (
         const char * name_str, caCh * conn_func, void * puser,
         capri priority, chid * chanptr );
+    friend int epicsStdCall ca_create_channels (
+        unsigned count, const char * const * names, caCh * conn_func,
+        void * const * pusers, capri priority, chid * chanptrs );
     friend int epicsStdCall ca_clear_channel ( chid pChan );
     friend int epicsStdCall ca_array_get ( chtype type,
         arrayElementCount count, chid pChan, void * pValue );
@@ -43,6 +43,8 @@
 #include "bhe.h"
 #include "epicsSignal.h"
 #include "caerr.h"
+#include "caShm.h"
+#include "cacIoPool.h"
 #include "udpiiu.h"
 
 using namespace std;
@@ -91,97 +93,11 @@ void tcpSendThread::run ()
                 break;
             }
 
-            laborPending = false;
-            bool flowControlLaborNeeded =
-                this->iiu.busyStateDetected != this->iiu.flowControlActive;
-            bool echoLaborNeeded = this->iiu.echoRequestPending;
-            this->iiu.echoRequestPending = false;
-
-            if ( flowControlLaborNeeded ) {
-                if ( this->iiu.flowControlActive ) {
-                    this->iiu.disableFlowControlRequest ( guard );
-                    this->iiu.flowControlActive = false;
-                    debugPrintf ( ( "fc off\n" ) );
-                }
-                else {
-                    this->iiu.enableFlowControlRequest ( guard );
-                    this->iiu.flowControlActive = true;
-                    debugPrintf ( ( "fc on\n" ) );
-                }
-            }
-
-            if ( echoLaborNeeded ) {
-                this->iiu.echoRequest ( guard );
-            }
-
-            while ( nciu * pChan = this->iiu.createReqPend.get () ) {
-                this->iiu.createChannelRequest ( *pChan, guard );
-
-                if ( CA_V42 ( this->iiu.minorProtocolVersion ) ) {
-                    this->iiu.createRespPend.add ( *pChan );
-                    pChan->channelNode::listMember =
-                        channelNode::cs_createRespPend;
-                }
-                else {
-                    // This wakes up the resp thread so that it can call
-                    // the connect callback. This isnt maximally efficent
-                    // but it has the excellent side effect of not requiring
-                    // that the UDP thread take the callback lock. There are
-                    // almost no V42 servers left at this point.
-                    this->iiu.v42ConnCallbackPend.add ( *pChan );
-                    pChan->channelNode::listMember =
-                        channelNode::cs_v42ConnCallbackPend;
-                    this->iiu.echoRequestPending = true;
-                    laborPending = true;
-                }
-
-                if ( this->iiu.sendQue.flushBlockThreshold () ) {
-                    laborPending = true;
-                    break;
-                }
-            }
-
-            while ( nciu * pChan = this->iiu.subscripReqPend.get () ) {
-                // this installs any subscriptions as needed
-                pChan->resubscribe ( guard );
-                this->iiu.connectedList.add ( *pChan );
-                pChan->channelNode::listMember =
-                    channelNode::cs_connected;
-                if ( this->iiu.sendQue.flushBlockThreshold () ) {
-                    laborPending = true;
-                    break;
-                }
-            }
-
-            while ( nciu * pChan = this->iiu.subscripUpdateReqPend.get () ) {
-                // this updates any subscriptions as needed
-                pChan->sendSubscriptionUpdateRequests ( guard );
-                this->iiu.connectedList.add ( *pChan );
-                pChan->channelNode::listMember =
-                    channelNode::cs_connected;
-                if ( this->iiu.sendQue.flushBlockThreshold () ) {
-                    laborPending = true;
-                    break;
-                }
-            }
-
-            if ( ! this->iiu.sendThreadFlush ( guard ) ) {
+            if ( ! this->iiu.sendLabor ( guard, laborPending ) ) {
                 break;
             }
         }
-        if ( this->iiu.state == tcpiiu::iiucs_clean_shutdown ) {
-            this->iiu.sendThreadFlush ( guard );
-            // this should cause the server to disconnect from
-            // the client
-            int status = ::shutdown ( this->iiu.sock, SHUT_WR );
-            if ( status ) {
-                char sockErrBuf[64];
-                epicsSocketConvertErrnoToString (
-                    sockErrBuf, sizeof ( sockErrBuf ) );
-                errlogPrintf ("CAC TCP clean socket shutdown error was %s\n",
-                    sockErrBuf );
-            }
-        }
+        this->iiu.sendShutdown ( guard );
     }
     catch ( ... ) {
         errlogPrintf (
@@ -189,20 +105,13 @@ void tcpSendThread::run ()
             "- disconnecting\n");
         // this should cause the server to disconnect from
         // the client
-        int status = ::shutdown ( this->iiu.sock, SHUT_WR );
-        if ( status ) {
-            char sockErrBuf[64];
-            epicsSocketConvertErrnoToString (
-                sockErrBuf, sizeof ( sockErrBuf ) );
-            errlogPrintf ("CAC TCP clean socket shutdown error was %s\n",
-                sockErrBuf );
-        }
+        this->iiu.socketShutdownSend ();
     }
 
     this->iiu.sendDog.cancel ();
     this->iiu.recvDog.shutdown ();
 
-    while ( ! this->iiu.recvThread.exitWait ( 30.0 ) ) {
+    while ( ! this->iiu.pRecvThread->exitWait ( 30.0 ) ) {
         // it is possible to get stuck here if the user calls
         // ca_context_destroy() when a circuit isnt known to
         // be unresponsive, but is. That situation is probably
@@ -214,29 +123,350 @@ void tcpSendThread::run ()
         this->iiu.initiateAbortShutdown ( guard );
     }
 
+    this->iiu.uninstall ();
+}
+
+// one round of the send labor, shared by the send thread and the
+// I/O pool, returns false if the circuit can no longer send
+bool tcpiiu::sendLabor (
+    epicsGuard < epicsMutex > & guard, bool & laborPending )
+{
+    guard.assertIdenticalMutex ( this->mutex );
+
+    laborPending = false;
+    bool flowControlLaborNeeded =
+        this->busyStateDetected != this->flowControlActive;
+    bool echoLaborNeeded = this->echoRequestPending;
+    this->echoRequestPending = false;
+
+    if ( flowControlLaborNeeded ) {
+        if ( this->flowControlActive ) {
+            this->disableFlowControlRequest ( guard );
+            this->flowControlActive = false;
+            debugPrintf ( ( "fc off\n" ) );
+        }
+        else {
+            this->enableFlowControlRequest ( guard );
+            this->flowControlActive = true;
+            debugPrintf ( ( "fc on\n" ) );
+        }
+    }
+
+    if ( echoLaborNeeded ) {
+        this->echoRequest ( guard );
+    }
+
+    if ( this->shmAckPending ) {
+        this->shmAckRequest ( guard );
+    }
+
+    while ( nciu * pChan = this->createReqPend.get () ) {
+        this->createChannelRequest ( *pChan, guard );
+
+        if ( CA_V42 ( this->minorProtocolVersion ) ) {
+            this->createRespPend.add ( *pChan );
+            pChan->channelNode::listMember =
+                channelNode::cs_createRespPend;
+        }
+        else {
+            // This wakes up the resp thread so that it can call
+            // the connect callback. This isnt maximally efficent
+            // but it has the excellent side effect of not requiring
+            // that the UDP thread take the callback lock. There are
+            // almost no V42 servers left at this point.
+            this->v42ConnCallbackPend.add ( *pChan );
+            pChan->channelNode::listMember =
+                channelNode::cs_v42ConnCallbackPend;
+            this->echoRequestPending = true;
+            laborPending = true;
+        }
+
+        if ( this->sendQue.flushBlockThreshold () ) {
+            laborPending = true;
+            break;
+        }
+    }
+
+    while ( nciu * pChan = this->subscripReqPend.get () ) {
+        // this installs any subscriptions as needed
+        pChan->resubscribe ( guard );
+        this->connectedList.add ( *pChan );
+        pChan->channelNode::listMember =
+            channelNode::cs_connected;
+        if ( this->sendQue.flushBlockThreshold () ) {
+            laborPending = true;
+            break;
+        }
+    }
+
+    while ( nciu * pChan = this->subscripUpdateReqPend.get () ) {
+        // this updates any subscriptions as needed
+        pChan->sendSubscriptionUpdateRequests ( guard );
+        this->connectedList.add ( *pChan );
+        pChan->channelNode::listMember =
+            channelNode::cs_connected;
+        if ( this->sendQue.flushBlockThreshold () ) {
+            laborPending = true;
+            break;
+        }
+    }
+
+    return this->sendThreadFlush ( guard );
+}
+
+// the send labor has ended, flush what is left of a clean shutdown
+void tcpiiu::sendShutdown (
+    epicsGuard < epicsMutex > & guard )
+{
+    guard.assertIdenticalMutex ( this->mutex );
+
+    if ( this->state == iiucs_clean_shutdown ) {
+        this->sendThreadFlush ( guard );
+        // the I/O pool calls again once the socket is writable
+        if ( this->ioSendBlocked ) {
+            return;
+        }
+        // this should cause the server to disconnect from
+        // the client
+        this->socketShutdownSend ();
+    }
+}
+
+void tcpiiu::socketShutdownSend ()
+{
+    int status = ::shutdown ( this->sock, SHUT_WR );
+    if ( status ) {
+        char sockErrBuf[64];
+        epicsSocketConvertErrnoToString (
+            sockErrBuf, sizeof ( sockErrBuf ) );
+        errlogPrintf ("CAC TCP clean socket shutdown error was %s\n",
+            sockErrBuf );
+    }
+}
+
+// both the send and the receive labor of the circuit have ended
+void tcpiiu::uninstall ()
+{
     // user threads blocking for send backlog to be reduced
     // will abort their attempt to get space if
     // the state of the tcpiiu changes from connected to a
     // disconnecting state. Nevertheless, we need to wait
     // for them to finish prior to destroying the IIU.
     {
-        epicsGuard < epicsMutex > guard ( this->iiu.mutex );
-        while ( this->iiu.blockingForFlush ) {
+        epicsGuard < epicsMutex > guard ( this->mutex );
+        while ( this->blockingForFlush ) {
             epicsGuardRelease < epicsMutex > unguard ( guard );
             epicsThreadSleep ( 0.1 );
         }
     }
-    this->iiu.cacRef.destroyIIU ( this->iiu );
+    this->cacRef.destroyIIU ( *this );
+}
+
+// the I/O pool found the socket of a connecting circuit ready,
+// returns false if the circuit will not connect
+bool tcpiiu::ioConnectFinish ()
+{
+    {
+        epicsGuard < epicsMutex > guard ( this->mutex );
+        if ( this->state == iiucs_connecting ) {
+            int errnoCpy = this->ioConnectErrno;
+            if ( errnoCpy == 0 ) {
+                osiSocklen_t len = sizeof ( errnoCpy );
+                if ( getsockopt ( this->sock, SOL_SOCKET, SO_ERROR,
+                        ( char * ) & errnoCpy, & len ) < 0 ) {
+                    errnoCpy = SOCKERRNO;
+                }
+            }
+            if ( errnoCpy == 0 ) {
+                osiSockAddr tmp;
+                osiSocklen_t len = sizeof ( tmp );
+                if ( getpeername ( this->sock, & tmp.sa, & len ) < 0 ) {
+                    errnoCpy = SOCKERRNO;
+                    if ( errnoCpy == SOCK_ENOTCONN ) {
+                        // woken before the connect completed
+                        return true;
+                    }
+                }
+            }
+            if ( errnoCpy == 0 ) {
+                // the socket stays non-blocking, a full socket
+                // ends the send labor until it is writable again
+                this->ioConnectPending = false;
+                // put the iiu into the connected state
+                this->state = iiucs_connected;
+                this->recvDog.connectNotify ( guard );
+                this->sendWakeup ( guard );
+                return true;
+            }
+            char sockErrBuf[64];
+            epicsSocketConvertErrorToString (
+                sockErrBuf, sizeof ( sockErrBuf ), errnoCpy );
+            errlogPrintf ( "CAC: Unable to connect because \"%s\"\n",
+                sockErrBuf );
+            this->disconnectNotify ( guard );
+        }
+        // there is no send labor for a circuit that never connected
+        this->ioConnectPending = false;
+        this->ioSendDone = true;
+    }
+    this->recvDog.shutdown ();
+    return false;
+}
+
+// receive labor for the I/O pool, returns false once the circuit
+// can no longer receive
+bool tcpiiu::ioRecv ()
+{
+    bool more = false;
+    comBuf * pComBuf = 0;
+
+    epicsThreadPrivateSet ( caClientCallbackThreadId, this );
+    try {
+        more = this->recvLabor ( pComBuf );
+    }
+    catch ( std::exception & except ) {
+        errlogPrintf (
+            "CA client library I/O thread stopped receiving "
+            "from a circuit due to C++ exception \"%s\"\n",
+            except.what () );
+        epicsGuard < epicsMutex > guard ( this->mutex );
+        this->initiateCleanShutdown ( guard );
+    }
+    catch ( ... ) {
+        errlogPrintf (
+            "CA client library I/O thread stopped receiving "
+            "from a circuit due to a non-standard C++ exception\n" );
+        epicsGuard < epicsMutex > guard ( this->mutex );
+        this->initiateCleanShutdown ( guard );
+    }
+    epicsThreadPrivateSet ( caClientCallbackThreadId, 0 );
+
+    if ( pComBuf ) {
+        pComBuf->~comBuf ();
+        this->comBufMemMgr.release ( pComBuf );
+    }
+    return more;
+}
+
+// send labor for the I/O pool, returns true when the send side of
+// the circuit has just finished. If the socket is full it returns
+// false with ioSendBlocked set, and is called again once the socket
+// is writable.
+bool tcpiiu::ioSend ()
+{
+    bool finished = false;
+    try {
+        epicsGuard < epicsMutex > guard ( this->mutex );
+
+        this->ioSendBlocked = false;
+
+        // labor requested before the circuit connected waits for it
+        if ( this->ioSendDone || this->state == iiucs_connecting ) {
+            return false;
+        }
+
+        bool laborPending = true;
+        while ( laborPending ) {
+            if ( this->state != iiucs_connected ||
+                    ! this->sendLabor ( guard, laborPending ) ) {
+                finished = true;
+                break;
+            }
+            if ( this->ioSendBlocked ) {
+                return false;
+            }
+        }
+        if ( finished ) {
+            // a clean shutdown flushes what is left first
+            this->sendShutdown ( guard );
+            if ( this->ioSendBlocked ) {
+                return false;
+            }
+        }
+    }
+    catch ( ... ) {
+        errlogPrintf (
+            "cac: tcp I/O thread received an unexpected exception "
+            "- disconnecting\n");
+        // this should cause the server to disconnect from
+        // the client
+        this->socketShutdownSend ();
+        finished = true;
+    }
+
+    if ( finished ) {
+        this->sendDog.cancel ();
+        this->recvDog.shutdown ();
+    }
+    return finished;
 }
 
 unsigned tcpiiu::sendBytes ( const void *pBuf,
     unsigned nBytesInBuf, const epicsTime & currentTime )
 {
-    unsigned nBytes = 0u;
+    unsigned nBytes;
     assert ( nBytesInBuf <= INT_MAX );
 
     this->sendDog.start ( currentTime );
 
+    if ( this->shmSend ) {
+        nBytes = this->shmSendBytes ( pBuf, nBytesInBuf );
+    }
+    else {
+        // the shared memory acknowledgement is the last message sent
+        // over TCP, see shmAckRequest()
+        if ( this->shmSwitchPending &&
+                nBytesInBuf > this->shmSwitchBytes ) {
+            nBytesInBuf = this->shmSwitchBytes;
+        }
+        nBytes = this->sockSendBytes ( pBuf, nBytesInBuf );
+        if ( this->shmSwitchPending ) {
+            this->shmSwitchBytes -= nBytes;
+            if ( this->shmSwitchBytes == 0u ) {
+                this->shmSwitchPending = false;
+                this->shmSend = true;
+            }
+        }
+    }
+
+    // still watching a circuit the I/O pool waits to send on
+    if ( ! this->ioSendBlocked ) {
+        this->sendDog.cancel ();
+    }
+
+    return nBytes;
+}
+
+// copy into the shared memory ring, waiting while it is full
+unsigned tcpiiu::shmSendBytes ( const void *pBuf, unsigned nBytesInBuf )
+{
+    unsigned attempt = 0u;
+
+    while ( true ) {
+        int wakeup;
+        unsigned nBytes = caShmWrite ( this->pShm, pBuf,
+            nBytesInBuf, & wakeup );
+        if ( nBytes > 0u ) {
+            if ( wakeup && this->sockSendBytes ( "", 1u ) == 0u ) {
+                return 0u;
+            }
+            return nBytes;
+        }
+        {
+            epicsGuard < epicsMutex > guard ( this->mutex );
+            if ( this->state != iiucs_connected &&
+                this->state != iiucs_clean_shutdown ) {
+                return 0u;
+            }
+        }
+        caShmBackoff ( attempt++ );
+    }
+}
+
+unsigned tcpiiu::sockSendBytes ( const void *pBuf, unsigned nBytesInBuf )
+{
+    unsigned nBytes = 0u;
+
     while ( true ) {
         int status = ::send ( this->sock,
             static_cast < const char * > (pBuf), (int) nBytesInBuf, 0 );
@@ -263,6 +493,12 @@ unsigned tcpiiu::sendBytes ( const void *pBuf,
                 continue;
             }
 
+            // the I/O pool waits for the socket to be writable
+            if ( this->pIoPool && localError == SOCK_EWOULDBLOCK ) {
+                this->ioSendBlocked = true;
+                break;
+            }
+
             if ( localError == SOCK_ENOBUFS ) {
                 errlogPrintf (
                     "CAC: system low on network buffers "
@@ -292,8 +528,6 @@ unsigned tcpiiu::sendBytes ( const void *pBuf,
         }
     }
 
-    this->sendDog.cancel ();
-
     return nBytes;
 }
 
@@ -302,9 +536,43 @@ void tcpiiu::recvBytes (
 {
     assert ( nBytesInBuf <= INT_MAX );
 
+    if ( ! this->shmRecv ) {
+        this->sockRecvBytes ( pBuf, nBytesInBuf, stat );
+        return;
+    }
+
+    // read the shared memory ring, the socket only brings wakeups
+    while ( true ) {
+        unsigned nBytes = caShmRead ( this->pShm, pBuf, nBytesInBuf );
+        if ( nBytes > 0u ) {
+            stat.bytesCopied = nBytes;
+            stat.circuitState = swioConnected;
+            return;
+        }
+        if ( caShmWaitArm ( this->pShm ) ) {
+            continue;
+        }
+        char wakeup[64];
+        this->sockRecvBytes ( wakeup, sizeof ( wakeup ), stat );
+        if ( stat.circuitState != swioConnected ) {
+            return;
+        }
+    }
+}
+
+void tcpiiu::sockRecvBytes (
+        void * pBuf, unsigned nBytesInBuf, statusWireIO & stat )
+{
+    // the I/O pool only takes the bytes already pending
+#ifdef MSG_DONTWAIT
+    int flags = this->pIoPool ? MSG_DONTWAIT : 0;
+#else
+    int flags = 0;
+#endif
+
     while ( true ) {
         int status = ::recv ( this->sock, static_cast <char *> ( pBuf ),
-            static_cast <int> ( nBytesInBuf ), 0 );
+            static_cast <int> ( nBytesInBuf ), flags );
 
         if ( status > 0 ) {
             stat.bytesCopied = static_cast <unsigned> ( status );
@@ -343,6 +611,12 @@ void tcpiiu::recvBytes (
                 continue;
             }
 
+            if ( flags && localErrno == SOCK_EWOULDBLOCK ) {
+                stat.bytesCopied = 0u;
+                stat.circuitState = swioConnected;
+                return;
+            }
+
             if ( localErrno == SOCK_ENOBUFS ) {
                 errlogPrintf (
                     "CAC: system low on network buffers "
@@ -377,12 +651,10 @@ void tcpiiu::recvBytes (
 }
 
 tcpRecvThread::tcpRecvThread (
-    class tcpiiu & iiuIn, class epicsMutex & cbMutexIn,
-    cacContextNotify & ctxNotifyIn, const char * pName,
+    class tcpiiu & iiuIn, const char * pName,
     unsigned int stackSize, unsigned int priority  ) :
     thread ( *this, pName, stackSize, priority ),
-        iiu ( iiuIn ), cbMutex ( cbMutexIn ),
-        ctxNotify ( ctxNotifyIn ) {}
+        iiu ( iiuIn ) {}
 
 tcpRecvThread::~tcpRecvThread ()
 {
@@ -407,11 +679,11 @@ void tcpRecvThread::exitWait ()
     this->thread.exitWait ();
 }
 
-bool tcpRecvThread::validFillStatus (
+bool tcpiiu::validFillStatus (
     epicsGuard < epicsMutex > & guard, const statusWireIO & stat )
 {
-    if ( this->iiu.state != tcpiiu::iiucs_connected &&
-        this->iiu.state != tcpiiu::iiucs_clean_shutdown ) {
+    if ( this->state != iiucs_connected &&
+        this->state != iiucs_clean_shutdown ) {
         return false;
     }
     if ( stat.circuitState == swioConnected ) {
@@ -419,17 +691,17 @@ bool tcpRecvThread::validFillStatus (
     }
     if ( stat.circuitState == swioPeerHangup ||
         stat.circuitState == swioPeerAbort ) {
-        this->iiu.disconnectNotify ( guard );
+        this->disconnectNotify ( guard );
     }
     else if ( stat.circuitState == swioLinkFailure ) {
-        this->iiu.initiateAbortShutdown ( guard );
+        this->initiateAbortShutdown ( guard );
     }
     else if ( stat.circuitState == swioLocalAbort ) {
         // state change already occurred
     }
     else {
         errlogMessage ( "cac: invalid fill status - disconnecting" );
-        this->iiu.disconnectNotify ( guard );
+        this->disconnectNotify ( guard );
     }
     return false;
 }
@@ -455,121 +727,12 @@ void tcpRecvThread::run ()
             }
         }
 
-        this->iiu.sendThread.start ();
+        this->iiu.pSendThread->start ();
         epicsThreadPrivateSet ( caClientCallbackThreadId, &this->iiu );
         this->iiu.cacRef.attachToClientCtx ();
 
         comBuf * pComBuf = 0;
-        while ( true ) {
-
-            //
-            // We leave the bytes pending and fetch them after
-            // callbacks are enabled when running in the old preemptive
-            // call back disabled mode so that asynchronous wakeup via
-            // file manager call backs works correctly. This does not
-            // appear to impact performance.
-            //
-            if ( ! pComBuf ) {
-                pComBuf = new ( this->iiu.comBufMemMgr ) comBuf;
-            }
-
-            statusWireIO stat;
-            pComBuf->fillFromWire ( this->iiu, stat );
-
-            epicsTime currentTime = epicsTime::getCurrent ();
-
-            {
-                epicsGuard < epicsMutex > guard ( this->iiu.mutex );
-
-                if ( ! this->validFillStatus ( guard, stat ) ) {
-                    break;
-                }
-                if ( stat.bytesCopied == 0u ) {
-                    continue;
-                }
-
-                this->iiu.recvQue.pushLastComBufReceived ( *pComBuf );
-                pComBuf = 0;
-
-                this->iiu._receiveThreadIsBusy = true;
-            }
-
-            bool sendWakeupNeeded = false;
-            {
-                // only one recv thread at a time may call callbacks
-                // - pendEvent() blocks until threads waiting for
-                // this lock get a chance to run
-                callbackManager mgr ( this->ctxNotify, this->cbMutex );
-
-                epicsGuard < epicsMutex > guard ( this->iiu.mutex );
-
-                // route legacy V42 channel connect through the recv thread -
-                // the only thread that should be taking the callback lock
-                while ( nciu * pChan = this->iiu.v42ConnCallbackPend.first () ) {
-                    this->iiu.connectNotify ( guard, *pChan );
-                    pChan->connect ( mgr.cbGuard, guard );
-                }
-
-                this->iiu.unacknowledgedSendBytes = 0u;
-
-                bool protocolOK = false;
-                {
-                    epicsGuardRelease < epicsMutex > unguard ( guard );
-                    // execute receive labor
-                    protocolOK = this->iiu.processIncoming ( currentTime, mgr );
-                }
-
-                if ( ! protocolOK ) {
-                    this->iiu.initiateAbortShutdown ( guard );
-                    break;
-                }
-                this->iiu._receiveThreadIsBusy = false;
-                // reschedule connection activity watchdog
-                this->iiu.recvDog.messageArrivalNotify ( guard );
-                //
-                // if this thread has connected channels with subscriptions
-                // that need to be sent then wakeup the send thread
-                if ( this->iiu.subscripReqPend.count() ) {
-                    sendWakeupNeeded = true;
-                }
-            }
-
-            //
-            // we dont feel comfortable calling this with a lock applied
-            // (it might block for longer than we like)
-            //
-            // we would prefer to improve efficency by trying, first, a
-            // recv with the new MSG_DONTWAIT flag set, but there isnt
-            // universal support
-            //
-            bool bytesArePending = this->iiu.bytesArePendingInOS ();
-            {
-                epicsGuard < epicsMutex > guard ( this->iiu.mutex );
-                if ( bytesArePending ) {
-                    if ( ! this->iiu.busyStateDetected ) {
-                        this->iiu.contigRecvMsgCount++;
-                        if ( this->iiu.contigRecvMsgCount >=
-                            this->iiu.cacRef.maxContiguousFrames ( guard ) ) {
-                            this->iiu.busyStateDetected = true;
-                            sendWakeupNeeded = true;
-                        }
-                    }
-                }
-                else {
-                    // if no bytes are pending then we must immediately
-                    // switch off flow control w/o waiting for more
-                    // data to arrive
-                    this->iiu.contigRecvMsgCount = 0u;
-                    if ( this->iiu.busyStateDetected ) {
-                        sendWakeupNeeded = true;
-                        this->iiu.busyStateDetected = false;
-                    }
-                }
-            }
-
-            if ( sendWakeupNeeded ) {
-                this->iiu.sendThreadFlushEvent.signal ();
-            }
+        while ( this->iiu.recvLabor ( pComBuf ) ) {
         }
 
         if ( pComBuf ) {
@@ -602,6 +765,154 @@ void tcpRecvThread::run ()
     }
 }
 
+// receive and process one buffer, shared by the receive thread and
+// the I/O pool, returns false if the circuit can no longer receive
+bool tcpiiu::recvLabor ( comBuf * & pComBuf )
+{
+    //
+    // We leave the bytes pending and fetch them after
+    // callbacks are enabled when running in the old preemptive
+    // call back disabled mode so that asynchronous wakeup via
+    // file manager call backs works correctly. This does not
+    // appear to impact performance.
+    //
+    statusWireIO stat;
+    unsigned nDirect = this->directRecvBytes ();
+    if ( nDirect ) {
+        this->recvBytes ( & this->pCurData[this->curDataBytes],
+            nDirect, stat );
+    }
+    else {
+        if ( ! pComBuf ) {
+            pComBuf = new ( this->comBufMemMgr )
+                comBuf ( this->comBufMemMgr.capacityBytes () );
+        }
+        pComBuf->fillFromWire ( *this, stat );
+    }
+
+    epicsTime currentTime = epicsTime::getCurrent ();
+
+    {
+        epicsGuard < epicsMutex > guard ( this->mutex );
+
+        if ( ! this->validFillStatus ( guard, stat ) ) {
+            return false;
+        }
+        if ( stat.bytesCopied == 0u ) {
+            return true;
+        }
+
+        if ( nDirect ) {
+            this->curDataBytes += stat.bytesCopied;
+        }
+        else {
+            this->recvQue.pushLastComBufReceived ( *pComBuf );
+            pComBuf = 0;
+        }
+
+        this->_receiveThreadIsBusy = true;
+    }
+
+    bool sendWakeupNeeded = false;
+    {
+        // only one recv thread at a time may call callbacks
+        // - pendEvent() blocks until threads waiting for
+        // this lock get a chance to run
+        callbackManager mgr ( this->ctxNotify, this->cbMutex );
+
+        epicsGuard < epicsMutex > guard ( this->mutex );
+
+        // route legacy V42 channel connect through the recv thread -
+        // the only thread that should be taking the callback lock
+        while ( nciu * pChan = this->v42ConnCallbackPend.first () ) {
+            this->connectNotify ( guard, *pChan );
+            pChan->connect ( mgr.cbGuard, guard );
+        }
+
+        this->unacknowledgedSendBytes = 0u;
+
+        bool protocolOK = false;
+        {
+            epicsGuardRelease < epicsMutex > unguard ( guard );
+            // execute receive labor
+            protocolOK = this->processIncoming ( currentTime, mgr );
+        }
+
+        if ( ! protocolOK ) {
+            this->initiateAbortShutdown ( guard );
+            return false;
+        }
+        this->_receiveThreadIsBusy = false;
+        // reschedule connection activity watchdog
+        this->recvDog.messageArrivalNotify ( guard );
+        //
+        // if this thread has connected channels with subscriptions
+        // that need to be sent then wakeup the send thread
+        if ( this->subscripReqPend.count() ) {
+            sendWakeupNeeded = true;
+        }
+    }
+
+    //
+    // we dont feel comfortable calling this with a lock applied
+    // (it might block for longer than we like)
+    //
+    // we would prefer to improve efficency by trying, first, a
+    // recv with the new MSG_DONTWAIT flag set, but there isnt
+    // universal support
+    //
+    bool bytesArePending = this->bytesArePendingInOS ();
+    {
+        epicsGuard < epicsMutex > guard ( this->mutex );
+        if ( bytesArePending ) {
+            if ( ! this->busyStateDetected ) {
+                this->contigRecvMsgCount++;
+                if ( this->contigRecvMsgCount >=
+                    this->cacRef.maxContiguousFrames ( guard ) ) {
+                    this->busyStateDetected = true;
+                    sendWakeupNeeded = true;
+                }
+            }
+        }
+        else {
+            // if no bytes are pending then we must immediately
+            // switch off flow control w/o waiting for more
+            // data to arrive
+            this->contigRecvMsgCount = 0u;
+            if ( this->busyStateDetected ) {
+                sendWakeupNeeded = true;
+                this->busyStateDetected = false;
+            }
+        }
+
+        if ( sendWakeupNeeded ) {
+            this->sendWakeup ( guard );
+        }
+    }
+
+    return true;
+}
+
+// The rest of a message body at least as large as a buffer is received
+// straight into the message body cache, instead of into buffers that
+// are then copied out to it. Only the receiving thread uses the cache.
+unsigned tcpiiu::directRecvBytes () const
+{
+    if ( ! this->msgHeaderAvailable ||
+            this->curMsg.m_postsize > this->curDataMax ||
+            this->recvQue.occupiedBytes () > 0u ) {
+        return 0u;
+    }
+    arrayElementCount nBytes = this->curMsg.m_postsize - this->curDataBytes;
+    if ( nBytes < this->comBufMemMgr.capacityBytes () ) {
+        return 0u;
+    }
+    if ( nBytes > INT_MAX ) {
+        nBytes = INT_MAX;
+    }
+    return static_cast < unsigned > ( nBytes );
+}
+
 /*
  * tcpRecvThread::connect ()
  */
@@ -673,13 +984,8 @@ tcpiiu::tcpiiu (
         SearchDestTCP * pSearchDestIn ) :
     caServerID ( addrIn.ia, priorityIn ),
     hostNameCacheInstance ( addrIn, engineIn ),
-    recvThread ( *this, cbMutexIn, ctxNotifyIn, "CAC-TCP-recv",
-        epicsThreadGetStackSize ( epicsThreadStackBig ),
-        cac::highestPriorityLevelBelow ( cac.getInitializingThreadsPriority() ) ),
-    sendThread ( *this, "CAC-TCP-send",
-        epicsThreadGetStackSize ( epicsThreadStackMedium ),
-        cac::lowestPriorityLevelAbove (
-            cac.getInitializingThreadsPriority() ) ),
+    pRecvThread ( 0 ),
+    pSendThread ( 0 ),
     recvDog ( cbMutexIn, ctxNotifyIn, mutexIn,
         *this, connectionTimeout, timerQueue ),
     sendDog ( cbMutexIn, ctxNotifyIn, mutexIn,
@@ -690,6 +996,7 @@ tcpiiu::tcpiiu (
     curDataBytes ( 0ul ),
     comBufMemMgr ( comBufMemMgrIn ),
     cacRef ( cac ),
+    ctxNotify ( ctxNotifyIn ),
     pCurData ( (char*) freeListMalloc(this->cacRef.tcpSmallRecvBufFreeList) ),
     pSearchDest ( pSearchDestIn ),
     mutex ( mutexIn ),
@@ -712,7 +1019,29 @@ tcpiiu::tcpiiu (
     recvProcessPostponedFlush ( false ),
     discardingPendingData ( false ),
     socketHasBeenClosed ( false ),
-    unresponsiveCircuit ( false )
+    unresponsiveCircuit ( false ),
+    pShm ( 0 ),
+    shmSwitchBytes ( 0u ),
+    shmAckStatus ( ECA_NORMAL ),
+    shmAckPending ( false ),
+    shmSwitchPending ( false ),
+    shmSend ( false ),
+    shmRecv ( false ),
+    pIoPool ( pSearchDestIn ? 0 : cac.ioPool () ),
+    pIoSendNext ( 0 ),
+    pIoCloseNext ( 0 ),
+    pIoSendPartial ( 0 ),
+    ioConnectErrno ( 0 ),
+    ioConnectPending ( false ),
+    ioSendQueued ( false ),
+    ioSendBusy ( false ),
+    ioSendAgain ( false ),
+    ioClosing ( false ),
+    ioRecvArmed ( false ),
+    ioSendArmed ( false ),
+    ioSendBlocked ( false ),
+    ioRecvDone ( false ),
+    ioSendDone ( false )
 {
     if(!pCurData)
         throw std::bad_alloc();
@@ -759,6 +1088,7 @@ tcpiiu::tcpiiu (
         this->versionMessage ( guard, this->priority() );
         this->userNameSetRequest ( guard );
         this->hostNameSetRequest ( guard );
+        this->shmRequest ( guard );
     }
 
 #   if 0
@@ -808,6 +1138,17 @@ tcpiiu::tcpiiu (
         }
     }
 
+    if ( ! this->pIoPool ) {
+        try {
+            this->createThreads ();
+        }
+        catch ( ... ) {
+            epicsSocketDestroy ( this->sock );
+            freeListFree ( this->cacRef.tcpSmallRecvBufFreeList, this->pCurData );
+            throw;
+        }
+    }
+
     if ( isNameService() ) {
         pSearchDest->setCircuit ( this );
     }
@@ -815,13 +1156,46 @@ tcpiiu::tcpiiu (
     memset ( (void *) &this->curMsg, '\0', sizeof ( this->curMsg ) );
 }
 
+void tcpiiu::createThreads ()
+{
+    unsigned priority = this->cacRef.getInitializingThreadsPriority ();
+    this->pRecvThread = new tcpRecvThread ( *this, "CAC-TCP-recv",
+        epicsThreadGetStackSize ( epicsThreadStackBig ),
+        cac::highestPriorityLevelBelow ( priority ) );
+    try {
+        this->pSendThread = new tcpSendThread ( *this, "CAC-TCP-send",
+            epicsThreadGetStackSize ( epicsThreadStackMedium ),
+            cac::lowestPriorityLevelAbove ( priority ) );
+    }
+    catch ( ... ) {
+        delete this->pRecvThread;
+        this->pRecvThread = 0;
+        throw;
+    }
+}
+
 // this must always be called by the udp thread when it holds
 // the callback lock.
 void tcpiiu::start (
     epicsGuard < epicsMutex > & guard )
 {
     guard.assertIdenticalMutex ( this->mutex );
-    this->recvThread.start ();
+    if ( this->pIoPool ) {
+        if ( this->pIoPool->connect ( guard, *this ) ) {
+            return;
+        }
+        this->pIoPool = 0;
+        try {
+            this->createThreads ();
+        }
+        catch ( ... ) {
+            errlogPrintf ( "CAC: unable to create the threads of a "
+                "virtual circuit - disconnecting\n" );
+            this->initiateAbortShutdown ( guard );
+            return;
+        }
+    }
+    this->pRecvThread->start ();
 }
 
 void tcpiiu::initiateCleanShutdown (
@@ -835,7 +1209,7 @@ void tcpiiu::initiateCleanShutdown (
         }
         else {
             this->state = iiucs_clean_shutdown;
-            this->sendThreadFlushEvent.signal ();
+            this->sendWakeup ( guard );
             this->flushBlockEvent.signal ();
         }
     }
@@ -849,12 +1223,25 @@ void tcpiiu::initiateCleanShutdown (
     }
 }
 
+// wake the send thread, or queue the send labor with the I/O pool
+void tcpiiu::sendWakeup (
+    epicsGuard < epicsMutex > & guard )
+{
+    guard.assertIdenticalMutex ( this->mutex );
+    if ( this->pIoPool ) {
+        this->pIoPool->sendRequest ( guard, *this );
+    }
+    else {
+        this->sendThreadFlushEvent.signal ();
+    }
+}
+
 void tcpiiu::disconnectNotify (
     epicsGuard < epicsMutex > & guard )
 {
     guard.assertIdenticalMutex ( this->mutex );
     this->state = iiucs_disconnected;
-    this->sendThreadFlushEvent.signal ();
+    this->sendWakeup ( guard );
     this->flushBlockEvent.signal ();
 }
 
@@ -872,7 +1259,7 @@ void tcpiiu::responsiveCircuitNotify (
                 channelNode::cs_subscripUpdateReqPend;
             pChan->connect ( cbGuard, guard );
         }
-        this->sendThreadFlushEvent.signal ();
+        this->sendWakeup ( guard );
     }
 }
 
@@ -906,7 +1293,7 @@ void tcpiiu::unresponsiveCircuitNotify (
     if ( ! this->unresponsiveCircuit ) {
         this->unresponsiveCircuit = true;
         this->echoRequestPending = true;
-        this->sendThreadFlushEvent.signal ();
+        this->sendWakeup ( guard );
         this->flushBlockEvent.signal ();
 
         // must not hold lock when canceling timer
@@ -994,8 +1381,10 @@ void tcpiiu::initiateAbortShutdown (
             }
             break;
         case esscimqi_socketSigAlarmRequired:
-            this->recvThread.interruptSocketRecv ();
-            this->sendThread.interruptSocketSend ();
+            if ( this->pRecvThread ) {
+                this->pRecvThread->interruptSocketRecv ();
+                this->pSendThread->interruptSocketSend ();
+            }
             break;
         default:
             break;
@@ -1004,7 +1393,7 @@ void tcpiiu::initiateAbortShutdown (
         //
         // wake up the send thread if it isnt blocking in send()
         //
-        this->sendThreadFlushEvent.signal ();
+        this->sendWakeup ( guard );
         this->flushBlockEvent.signal ();
     }
 }
@@ -1018,8 +1407,10 @@ tcpiiu :: ~tcpiiu ()
         this->pSearchDest->disable ();
     }
 
-    this->sendThread.exitWait ();
-    this->recvThread.exitWait ();
+    if ( this->pRecvThread ) {
+        this->pSendThread->exitWait ();
+        this->pRecvThread->exitWait ();
+    }
     this->sendDog.cancel ();
     this->recvDog.shutdown ();
 
@@ -1027,6 +1418,13 @@ tcpiiu :: ~tcpiiu ()
         epicsSocketDestroy ( this->sock );
     }
 
+    caShmDestroy ( this->pShm );
+
+    if ( this->pIoSendPartial ) {
+        this->pIoSendPartial->~comBuf ();
+        this->comBufMemMgr.release ( this->pIoSendPartial );
+    }
+
     // free message body cache
     if ( this->pCurData ) {
         if ( this->curDataMax <= MAX_TCP ) {
@@ -1039,6 +1437,9 @@ tcpiiu :: ~tcpiiu ()
             free ( this->pCurData );
         }
     }
+
+    delete this->pSendThread;
+    delete this->pRecvThread;
 }
 
 void tcpiiu::show ( unsigned level ) const
@@ -1059,12 +1460,17 @@ void tcpiiu::show ( unsigned level ) const
     }
     if ( level > 2u ) {
         ::printf ( "\tvirtual circuit socket identifier %d\n", this->sock );
-        ::printf ( "\tsend thread flush signal:\n" );
-        this->sendThreadFlushEvent.show ( level-2u );
-        ::printf ( "\tsend thread:\n" );
-        this->sendThread.show ( level-2u );
-        ::printf ( "\trecv thread:\n" );
-        this->recvThread.show ( level-2u );
+        if ( this->pRecvThread ) {
+            ::printf ( "\tsend thread flush signal:\n" );
+            this->sendThreadFlushEvent.show ( level-2u );
+            ::printf ( "\tsend thread:\n" );
+            this->pSendThread->show ( level-2u );
+            ::printf ( "\trecv thread:\n" );
+            this->pRecvThread->show ( level-2u );
+        }
+        else {
+            ::printf ( "\tserved by the I/O pool\n" );
+        }
         ::printf ("\techo pending bool = %u\n", this->echoRequestPending );
         ::printf ( "IO identifier hash table:\n" );
 
@@ -1124,7 +1530,7 @@ bool tcpiiu::setEchoRequestPending ( epicsGuard < epicsMutex > & guard )
     guard.assertIdenticalMutex ( this->mutex );
 
     this->echoRequestPending = true;
-    this->sendThreadFlushEvent.signal ();
+    this->sendWakeup ( guard );
     if ( CA_V43 ( this->minorProtocolVersion ) ) {
         // we send an echo
         return true;
@@ -1378,6 +1784,45 @@ void tcpiiu::enableFlowControlRequest (
     minder.commit ();
 }
 
+// ask a V4.14 server for shared memory rings, it only
+// offers them to clients on the same host
+void tcpiiu::shmRequest ( epicsGuard < epicsMutex > & guard )
+{
+    guard.assertIdenticalMutex ( this->mutex );
+
+    if ( ! CA_V414 ( this->minorProtocolVersion ) ||
+            ! this->cacRef.sharedMemoryEnabled () || this->pIoPool ) {
+        return;
+    }
+
+    comQueSendMsgMinder minder ( this->sendQue, guard );
+    this->sendQue.insertRequestHeader (
+        CA_PROTO_SHM, 0u, CA_SHM_REQUEST, 0u, 0u, 0u,
+        CA_V49 ( this->minorProtocolVersion ) );
+    minder.commit ();
+}
+
+// called by the send thread with nothing being sent, so the bytes
+// queued now are the last ones sent over TCP
+void tcpiiu::shmAckRequest ( epicsGuard < epicsMutex > & guard )
+{
+    guard.assertIdenticalMutex ( this->mutex );
+
+    this->shmAckPending = false;
+
+    comQueSendMsgMinder minder ( this->sendQue, guard );
+    this->sendQue.insertRequestHeader (
+        CA_PROTO_SHM, 0u, CA_SHM_ACK, 0u,
+        static_cast < ca_uint32_t > ( this->shmAckStatus ), 0u,
+        CA_V49 ( this->minorProtocolVersion ) );
+    minder.commit ();
+
+    if ( this->shmAckStatus == ECA_NORMAL ) {
+        this->shmSwitchBytes = this->sendQue.occupiedBytes ();
+        this->shmSwitchPending = true;
+    }
+}
+
 void tcpiiu::versionMessage ( epicsGuard < epicsMutex > & guard,
                              const cacChannel::priLev & priority )
 {
@@ -1667,18 +2112,28 @@ bool tcpiiu::sendThreadFlush ( epicsGuard < epicsMutex > & guard )
 {
     guard.assertIdenticalMutex ( this->mutex );
 
-    if ( this->sendQue.occupiedBytes() > 0 ) {
-        while ( comBuf * pBuf = this->sendQue.popNextComBufToSend () ) {
+    if ( this->pIoSendPartial || this->sendQue.occupiedBytes() > 0 ) {
+        while ( comBuf * pBuf = this->pIoSendPartial ?
+                this->pIoSendPartial : this->sendQue.popNextComBufToSend () ) {
             epicsTime current = epicsTime::getCurrent ();
 
+            this->pIoSendPartial = 0;
             unsigned bytesToBeSent = pBuf->occupiedBytes ();
             bool success = false;
             {
                 // no lock while blocking to send
                 epicsGuardRelease < epicsMutex > unguard ( guard );
                 success = pBuf->flushToWire ( *this, current );
-                pBuf->~comBuf ();
-                this->comBufMemMgr.release ( pBuf );
+                if ( success || ! this->ioSendBlocked ) {
+                    pBuf->~comBuf ();
+                    this->comBufMemMgr.release ( pBuf );
+                }
+            }
+
+            // the I/O pool sends the rest once the socket is writable
+            if ( ! success && this->ioSendBlocked ) {
+                this->pIoSendPartial = pBuf;
+                return true;
             }
 
             if ( ! success ) {
@@ -1750,7 +2205,7 @@ unsigned tcpiiu::requestMessageBytesPending (
 #if 0
     if ( ! this->earlyFlush && this->sendQue.flushEarlyThreshold(0u) ) {
         this->earlyFlush = true;
-        this->sendThreadFlushEvent.signal ();
+        this->sendWakeup ( guard );
     }
 #endif
     return sendQue.occupiedBytes ();
@@ -1953,7 +2408,7 @@ void tcpiiu::installChannel (
     chan.searchReplySetUp ( *this, sidIn, typeIn, countIn, guard );
     // The tcp send thread runs at apriority below the udp thread
     // so that this will not send small packets
-    this->sendThreadFlushEvent.signal ();
+    this->sendWakeup ( guard );
 }
 
 bool tcpiiu :: connectNotify (
@@ -2036,15 +2491,18 @@ int tcpiiu :: printFormated (
     return status;
 }
 
-void tcpiiu::flushRequest ( epicsGuard < epicsMutex > & )
+void tcpiiu::flushRequest ( epicsGuard < epicsMutex > & guard )
 {
     if ( this->sendQue.occupiedBytes () > 0 ) {
-        this->sendThreadFlushEvent.signal ();
+        this->sendWakeup ( guard );
     }
 }
 
 bool tcpiiu::bytesArePendingInOS () const
 {
+    if ( this->shmRecv ) {
+        return caShmPending ( this->pShm ) > 0u;
+    }
 #if 0
     FD_SET readBits;
     FD_ZERO ( & readBits );
@@ -2127,10 +2585,11 @@ void tcpiiu::uninstallChanDueToSuccessfulSearchResponse (
 
 bool tcpiiu::searchMsg (
     epicsGuard < epicsMutex > & guard, ca_uint32_t id,
-        const char * pName, unsigned nameLength )
+        const char * pName, unsigned nameLength,
+        const osiSockAddr * pCachedServer )
 {
     return netiiu::searchMsg (
-        guard, id, pName, nameLength );
+        guard, id, pName, nameLength, pCachedServer );
 }
 
 SearchDestTCP :: SearchDestTCP (
@@ -2191,6 +2650,37 @@ void tcpiiu :: versionRespNotify ( const caHdrLargeArray & msg )
     this->minorProtocolVersion = msg.m_count;
 }
 
+bool tcpiiu :: shmRespNotify ( const caHdrLargeArray & msg,
+    const char * pBody )
+{
+    epicsGuard < epicsMutex > guard ( this->mutex );
+
+    if ( msg.m_dataType == CA_SHM_OFFER ) {
+        // the server declines when not on this host
+        if ( msg.m_cid != ECA_NORMAL || this->pShm ||
+                this->shmAckPending ) {
+            return true;
+        }
+        char name[CA_SHM_NAME_SIZE];
+        unsigned len = msg.m_postsize < sizeof ( name ) ?
+            msg.m_postsize : sizeof ( name ) - 1u;
+        memcpy ( name, pBody, len );
+        name[len] = '\0';
+        this->pShm = caShmAttach ( name );
+        this->shmAckStatus = this->pShm ? ECA_NORMAL : ECA_NOSUPPORT;
+        this->shmAckPending = true;
+        this->sendWakeup ( guard );
+        return true;
+    }
+    if ( msg.m_dataType == CA_SHM_SWITCH && this->pShm &&
+            this->shmAckStatus == ECA_NORMAL && ! this->shmRecv ) {
+        // no more bytes from the server on the socket but wakeups
+        this->shmRecv = true;
+        return true;
+    }
+    return false;
+}
+
 void tcpiiu :: searchRespNotify (
     const epicsTime & currentTime, const caHdrLargeArray & msg )
 {
@@ -2209,5 +2699,5 @@ void tcpiiu :: searchRespNotify (
     }
     cacRef.transferChanToVirtCircuit
             ( msg.m_available, msg.m_cid, 0xffff,
-                0, minorProtocolVersion, serverAddr, currentTime );
+                0, minorProtocolVersion, serverAddr, 0, currentTime );
 }
@@ -140,6 +140,7 @@ udpiiu::udpiiu (
     nTimers ( getNTimers(maxPeriod) ),
     ppSearchTmr ( nTimers ),
     nBytesInXmitBuf ( 0 ),
+    nBytesInCachedXmitBuf ( 0 ),
     beaconAnomalyTimerIndex ( 0 ),
     sequenceNumber ( 0 ),
     lastReceivedSeqNo ( 0 ),
@@ -152,6 +153,8 @@ udpiiu::udpiiu (
 {
     cacGuard.assertIdenticalMutex ( cacMutex );
 
+    memset ( & this->cachedServerAddr, 0, sizeof ( this->cachedServerAddr ) );
+
     double powerOfTwo = log ( beaconAnomalySearchPeriod / minRoundTripEstimate ) / log ( 2.0 );
     this->beaconAnomalyTimerIndex = static_cast < unsigned > ( powerOfTwo + 1.0 );
     if ( this->beaconAnomalyTimerIndex >= this->nTimers ) {
@@ -731,12 +734,12 @@ bool udpiiu :: searchRespAction (
     if ( CA_V42 ( minorVersion ) ) {
        cacRef.transferChanToVirtCircuit
             ( msg.m_available, msg.m_cid, 0xffff,
-                0, minorVersion, serverAddr, currentTime );
+                0, minorVersion, serverAddr, & addr, currentTime );
     }
     else {
         cacRef.transferChanToVirtCircuit
             ( msg.m_available, msg.m_cid, msg.m_dataType,
-                msg.m_count, minorVersion, serverAddr, currentTime );
+                msg.m_count, minorVersion, serverAddr, & addr, currentTime );
     }
 
     return true;
@@ -798,9 +801,11 @@ bool udpiiu::repeaterAckAction (
 }
 
 bool udpiiu::notHereRespAction (
-    const caHdr &,
-        const osiSockAddr &, const epicsTime & )
+    const caHdr & msg,
+        const osiSockAddr & net_addr, const epicsTime & )
 {
+    // only searches sent to a cached server ask for this reply
+    this->cacRef.searchNotFound ( msg.m_cid, net_addr );
     return true;
 }
 
@@ -929,6 +934,15 @@ bool udpiiu::pushVersionMsg ()
 
 bool udpiiu::pushDatagramMsg ( epicsGuard < epicsMutex > & guard,
     const caHdr & msg, const void * pExt, ca_uint16_t extsize )
+{
+    return this->pushDatagramMsg ( guard, this->xmitBuf,
+        this->nBytesInXmitBuf, msg, pExt, extsize );
+}
+
+// pBuf has room for MAX_UDP_SEND bytes
+bool udpiiu::pushDatagramMsg ( epicsGuard < epicsMutex > & guard,
+    char * pBuf, unsigned & nBytesInBuf,
+    const caHdr & msg, const void * pExt, ca_uint16_t extsize )
 {
     guard.assertIdenticalMutex ( this->cacMutex );
 
@@ -936,15 +950,15 @@ bool udpiiu::pushDatagramMsg ( epicsGuard < epicsMutex > & guard,
     arrayElementCount msgsize = sizeof ( caHdr ) + alignedExtSize;
 
     /* fail out if max message size exceeded */
-    if ( msgsize >= sizeof ( this->xmitBuf ) - 7 ) {
+    if ( msgsize >= MAX_UDP_SEND - 7 ) {
         return false;
     }
 
-    if ( msgsize + this->nBytesInXmitBuf > sizeof ( this->xmitBuf ) ) {
+    if ( msgsize + nBytesInBuf > MAX_UDP_SEND ) {
         return false;
     }
 
-    caHdr * pbufmsg = ( caHdr * ) &this->xmitBuf[this->nBytesInXmitBuf];
+    caHdr * pbufmsg = ( caHdr * ) &pBuf[nBytesInBuf];
     *pbufmsg = msg;
     if ( extsize && pExt ) {
         memcpy ( pbufmsg + 1, pExt, extsize );
@@ -954,7 +968,7 @@ bool udpiiu::pushDatagramMsg ( epicsGuard < epicsMutex > & guard,
         }
     }
     AlignedWireRef < epicsUInt16 > ( pbufmsg->m_postsize ) = alignedExtSize;
-    this->nBytesInXmitBuf += msgsize;
+    nBytesInBuf += msgsize;
 
     return true;
 }
@@ -1101,12 +1115,12 @@ void udpiiu :: SearchRespCallback :: notify (
     if ( CA_V42 ( minorVersion ) ) {
        _udpiiu.cacRef.transferChanToVirtCircuit
             ( msg.m_available, msg.m_cid, 0xffff,
-                0, minorVersion, serverAddr, currentTime );
+                0, minorVersion, serverAddr, & addr, currentTime );
     }
     else {
         _udpiiu.cacRef.transferChanToVirtCircuit
             ( msg.m_available, msg.m_cid, msg.m_dataType,
-                msg.m_count, minorVersion, serverAddr, currentTime );
+                msg.m_count, minorVersion, serverAddr, & addr, currentTime );
     }
 }
 
@@ -1122,16 +1136,29 @@ bool udpiiu :: datagramFlush (
 {
     guard.assertIdenticalMutex ( cacMutex );
 
+    bool sent = false;
+
     // dont send the version header by itself
-    if ( this->nBytesInXmitBuf <= sizeof ( caHdr ) ) {
-        return false;
+    if ( this->nBytesInCachedXmitBuf > sizeof ( caHdr ) ) {
+        SearchDestUDP cachedServer ( this->cachedServerAddr, *this );
+        cachedServer.searchRequest ( guard, this->cachedXmitBuf,
+            this->nBytesInCachedXmitBuf );
+        sent = true;
     }
+    this->nBytesInCachedXmitBuf = 0u;
 
-    tsDLIter < SearchDest > iter ( _searchDestList.firstIter () );
-    while ( iter.valid () )
-    {
-        iter->searchRequest ( guard, this->xmitBuf, this->nBytesInXmitBuf );
-        iter++;
+    if ( this->nBytesInXmitBuf > sizeof ( caHdr ) ) {
+        tsDLIter < SearchDest > iter ( _searchDestList.firstIter () );
+        while ( iter.valid () )
+        {
+            iter->searchRequest ( guard, this->xmitBuf, this->nBytesInXmitBuf );
+            iter++;
+        }
+        sent = true;
+    }
+
+    if ( ! sent ) {
+        return false;
     }
 
     this->nBytesInXmitBuf = 0u;
@@ -1241,7 +1268,8 @@ void udpiiu::uninstallChan (
 
 bool udpiiu::searchMsg (
     epicsGuard < epicsMutex > & guard, ca_uint32_t id,
-        const char * pName, unsigned nameLength )
+        const char * pName, unsigned nameLength,
+        const osiSockAddr * pCachedServer )
 {
     caHdr msg;
     AlignedWireRef < epicsUInt16 > ( msg.m_cmmd ) = CA_PROTO_SEARCH;
@@ -1249,8 +1277,27 @@ bool udpiiu::searchMsg (
     AlignedWireRef < epicsUInt16 > ( msg.m_dataType ) = DONTREPLY;
     AlignedWireRef < epicsUInt16 > ( msg.m_count ) = CA_MINOR_PROTOCOL_REVISION;
     AlignedWireRef < epicsUInt32 > ( msg.m_cid ) = id;
-    return this->pushDatagramMsg (
-        guard, msg, pName, (ca_uint16_t) nameLength );
+    if ( ! pCachedServer ) {
+        return this->pushDatagramMsg (
+            guard, msg, pName, (ca_uint16_t) nameLength );
+    }
+
+    // Only the server where the name was last found is asked, and it
+    // replies if it no longer has the name. The datagram begins with
+    // the same version message and sequence number as the broadcast,
+    // and both are flushed together.
+    AlignedWireRef < epicsUInt16 > ( msg.m_dataType ) = DOREPLY;
+    if ( this->nBytesInCachedXmitBuf == 0u ) {
+        memcpy ( this->cachedXmitBuf, this->xmitBuf, sizeof ( caHdr ) );
+        this->nBytesInCachedXmitBuf = sizeof ( caHdr );
+        this->cachedServerAddr = *pCachedServer;
+    }
+    else if ( ! sockAddrAreIdentical ( & this->cachedServerAddr,
+            pCachedServer ) ) {
+        return false;
+    }
+    return this->pushDatagramMsg ( guard, this->cachedXmitBuf,
+        this->nBytesInCachedXmitBuf, msg, pName, (ca_uint16_t) nameLength );
 }
 
 void udpiiu::installNewChannel (
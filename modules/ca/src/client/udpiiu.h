@@ -158,6 +158,7 @@ private:
         udpiiu & m_udpiiu;
     };
     char xmitBuf [MAX_UDP_SEND];
+    char cachedXmitBuf [MAX_UDP_SEND]; // searches for one cached server
     char recvBuf [MAX_UDP_RECV];
     udpRecvThread recvThread;
     M_repeaterTimerNotify m_repeaterTimerNotify;
@@ -182,6 +183,8 @@ private:
         SearchArray& operator=(const SearchArray&);
     } ppSearchTmr;
     unsigned nBytesInXmitBuf;
+    unsigned nBytesInCachedXmitBuf;
+    osiSockAddr cachedServerAddr;
     unsigned beaconAnomalyTimerIndex;
     ca_uint32_t sequenceNumber;
     ca_uint32_t lastReceivedSeqNo;
@@ -202,6 +205,10 @@ private:
     bool pushDatagramMsg ( epicsGuard < epicsMutex > &,
         const caHdr & hdr, const void * pExt,
         ca_uint16_t extsize);
+    bool pushDatagramMsg ( epicsGuard < epicsMutex > &,
+        char * pBuf, unsigned & nBytesInBuf,
+        const caHdr & hdr, const void * pExt,
+        ca_uint16_t extsize);
 
     typedef bool ( udpiiu::*pProtoStubUDP ) (
         const caHdr &,
@@ -287,7 +294,8 @@ private:
         epicsGuard < epicsMutex > & ) const;
     bool searchMsg (
         epicsGuard < epicsMutex > &, ca_uint32_t id,
-            const char * pName, unsigned nameLength );
+            const char * pName, unsigned nameLength,
+            const osiSockAddr * pCachedServer );
 
     // searchTimerNotify stubs
     double getRTTE ( epicsGuard < epicsMutex > & ) const;
@@ -56,8 +56,8 @@ class ipAddrToAsciiEngine;
 class tcpRecvThread : private epicsThreadRunable {
 public:
     tcpRecvThread (
-        class tcpiiu & iiuIn, epicsMutex & cbMutexIn, cacContextNotify &,
-        const char * pName, unsigned int stackSize, unsigned int priority );
+        class tcpiiu & iiuIn, const char * pName,
+        unsigned int stackSize, unsigned int priority );
     virtual ~tcpRecvThread ();
     void start ();
     void exitWait ();
@@ -67,14 +67,9 @@ public:
 private:
     epicsThread thread;
     class tcpiiu & iiu;
-    epicsMutex & cbMutex;
-    cacContextNotify & ctxNotify;
     void run ();
     void connect (
         epicsGuard < epicsMutex > & guard );
-    bool validFillStatus (
-        epicsGuard < epicsMutex > & guard,
-        const statusWireIO & stat );
 };
 
 class tcpSendThread : private epicsThreadRunable {
@@ -198,6 +193,7 @@ public:
     void searchRespNotify (
         const epicsTime &, const caHdrLargeArray & );
     void versionRespNotify ( const caHdrLargeArray & );
+    bool shmRespNotify ( const caHdrLargeArray &, const char * pBody );
 
     void * operator new ( size_t size,
         tsFreeList < class tcpiiu, 32, epicsMutexNOOP >  & );
@@ -206,8 +202,9 @@ public:
 
 private:
     hostNameCache hostNameCacheInstance;
-    tcpRecvThread recvThread;
-    tcpSendThread sendThread;
+    // both zero when the circuit is served by the I/O pool
+    tcpRecvThread * pRecvThread;
+    tcpSendThread * pSendThread;
     tcpRecvWatchdog recvDog;
     tcpSendWatchdog sendDog;
     comQueSend sendQue;
@@ -226,6 +223,7 @@ private:
     arrayElementCount curDataBytes;
     comBufMemoryManager & comBufMemMgr;
     cac & cacRef;
+    cacContextNotify & ctxNotify;
     char * pCurData;
     SearchDestTCP * pSearchDest;
     epicsMutex & mutex;
@@ -257,13 +255,60 @@ private:
     bool discardingPendingData;
     bool socketHasBeenClosed;
     bool unresponsiveCircuit;
+    // shared memory transport, see caShm.h
+    struct caShm * pShm;
+    unsigned shmSwitchBytes; // still to send over TCP
+    int shmAckStatus;
+    bool shmAckPending;
+    bool shmSwitchPending; // only modified by the send thread
+    bool shmSend; // only modified by the send thread
+    bool shmRecv; // only modified by the recv thread
+    // shared I/O threads, see cacIoPool.h
+    class cacIoPool * pIoPool;
+    tcpiiu * pIoSendNext; // protected by the pool's lock
+    tcpiiu * pIoCloseNext; // protected by the pool's lock
+    epicsTime ioCloseDeadline; // protected by the pool's lock
+    epicsEvent ioSendIdle; // signaled when ioSendBusy is cleared
+    comBuf * pIoSendPartial; // sent in part when the socket was full
+    int ioConnectErrno;
+    bool ioConnectPending;
+    bool ioSendQueued; // protected by the pool's lock
+    bool ioSendBusy; // protected by the pool's lock
+    bool ioSendAgain; // protected by the pool's lock
+    bool ioClosing; // protected by the pool's lock
+    bool ioRecvArmed; // protected by the pool's lock
+    bool ioSendArmed; // protected by the pool's lock
+    bool ioSendBlocked; // only modified by the send labor
+    bool ioRecvDone;
+    bool ioSendDone;
 
     bool processIncoming (
         const epicsTime & currentTime, callbackManager & );
+    bool recvLabor ( comBuf * & pComBuf );
+    unsigned directRecvBytes () const;
+    bool validFillStatus (
+        epicsGuard < epicsMutex > & guard,
+        const statusWireIO & stat );
+    bool sendLabor (
+        epicsGuard < epicsMutex > &, bool & laborPending );
+    void sendShutdown (
+        epicsGuard < epicsMutex > & );
+    void socketShutdownSend ();
+    void sendWakeup (
+        epicsGuard < epicsMutex > & );
+    void uninstall ();
+    void createThreads ();
+    bool ioConnectFinish ();
+    bool ioRecv ();
+    bool ioSend ();
     unsigned sendBytes ( const void *pBuf,
         unsigned nBytesInBuf, const epicsTime & currentTime );
     void recvBytes (
         void * pBuf, unsigned nBytesInBuf, statusWireIO & );
+    unsigned sockSendBytes ( const void *pBuf, unsigned nBytesInBuf );
+    unsigned shmSendBytes ( const void *pBuf, unsigned nBytesInBuf );
+    void sockRecvBytes (
+        void * pBuf, unsigned nBytesInBuf, statusWireIO & );
     const char * pHostName (
         epicsGuard < epicsMutex > & ) const throw ();
     double receiveWatchdogDelay (
@@ -295,6 +340,10 @@ private:
         epicsGuard < epicsMutex > & );
     void userNameSetRequest (
         epicsGuard < epicsMutex > & );
+    void shmRequest (
+        epicsGuard < epicsMutex > & );
+    void shmAckRequest (
+        epicsGuard < epicsMutex > & );
     void createChannelRequest (
         nciu &, epicsGuard < epicsMutex > & );
     void writeRequest (
@@ -327,10 +376,12 @@ private:
         epicsGuard < epicsMutex > &, nciu &, const class epicsTime & );
     bool searchMsg (
         epicsGuard < epicsMutex > &, ca_uint32_t id,
-            const char * pName, unsigned nameLength );
+            const char * pName, unsigned nameLength,
+            const osiSockAddr * pCachedServer );
 
     friend class tcpRecvThread;
     friend class tcpSendThread;
+    friend class cacIoPool;
 
     tcpiiu ( const tcpiiu & );
     tcpiiu & operator = ( const tcpiiu & );
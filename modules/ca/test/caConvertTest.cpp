@@ -0,0 +1,237 @@
+/*************************************************************************\
+* EPICS BASE is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+
+/*
+ * Tests of the CA wire format conversion of arrays, and of each set
+ * of vector byte swap kernels that this host can run
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "dbDefs.h"
+#include "epicsUnitTest.h"
+#include "testMain.h"
+
+#include "db_access.h"
+#include "caSwapKernels.h"
+
+static const unsigned checkTypes[] = {
+    DBR_SHORT, DBR_FLOAT, DBR_ENUM, DBR_LONG, DBR_DOUBLE,
+    DBR_STS_SHORT, DBR_STS_FLOAT, DBR_STS_LONG, DBR_STS_DOUBLE,
+    DBR_TIME_SHORT, DBR_TIME_FLOAT, DBR_TIME_LONG, DBR_TIME_DOUBLE,
+    DBR_GR_SHORT, DBR_GR_FLOAT, DBR_GR_LONG, DBR_GR_DOUBLE,
+    DBR_CTRL_SHORT, DBR_CTRL_FLOAT, DBR_CTRL_LONG, DBR_CTRL_DOUBLE
+};
+
+/* counts with and without a tail left over by the vectors */
+static const unsigned long checkCounts[] = {
+    1, 2, 7, 16, 17, 31, 33, 100, 1001
+};
+
+static const unsigned long maxCount = 1001u;
+
+static char host[sizeof(struct dbr_ctrl_double) +
+    maxCount * sizeof(dbr_double_t)];
+static char net[sizeof(host)];
+static char work[sizeof(host)];
+
+/* the network format differs from these hosts only in byte order */
+#if EPICS_BYTE_ORDER == EPICS_ENDIAN_LITTLE && \
+        EPICS_FLOAT_WORD_ORDER == EPICS_ENDIAN_LITTLE
+static const bool swapped = true;
+#else
+static const bool swapped = false;
+#endif
+
+static bool isReversed(const char *pA, const char *pB, unsigned long count,
+    unsigned size)
+{
+    unsigned long i;
+    unsigned j;
+
+    for (i = 0; i < count; i++) {
+        for (j = 0; j < size; j++) {
+            if (pA[i * size + j] != pB[i * size + size - 1u - j])
+                return false;
+        }
+    }
+    return true;
+}
+
+#ifdef EPICS_CONVERSION_REQUIRED
+
+/*
+ * The kernel must reverse whole elements, leave less than a vector of
+ * 32 bytes to the caller, and not write beyond the elements it did.
+ * Odd offsets check unaligned arrays.
+ */
+static bool checkKernel(CACSWAPFUNCPTR swap, unsigned size, bool inPlace)
+{
+    const unsigned long nBytes = maxCount * size;
+    unsigned long i, n;
+    unsigned k, offset;
+
+    for (i = 0; i < sizeof(host); i++)
+        host[i] = (char) (i * 7u + 3u);
+
+    for (k = 0; k < NELEMENTS(checkCounts); k++) {
+        unsigned long count = checkCounts[k];
+        for (offset = 0; offset < 2u; offset++) {
+            const char *pSrc = host + offset;
+            char *pDest = work + offset;
+
+            if (inPlace) {
+                memcpy(work, host, nBytes + 1u);
+                n = swap(pDest, pDest, count);
+            }
+            else {
+                memset(work, 0x5a, nBytes + 1u);
+                n = swap(pSrc, pDest, count);
+            }
+            if (n > count || (count - n) * size >= 32u) {
+                testDiag("%u byte swap of %lu elements did %lu",
+                    size, count, n);
+                return false;
+            }
+            if (!isReversed(pDest, pSrc, n, size)) {
+                testDiag("%u byte swap of %lu elements differs",
+                    size, count);
+                return false;
+            }
+            for (i = n * size; i < nBytes; i++) {
+                if (pDest[i] != (inPlace ? pSrc[i] : 0x5a)) {
+                    testDiag("%u byte swap of %lu elements wrote byte %lu",
+                        size, count, i);
+                    return false;
+                }
+            }
+        }
+    }
+    return true;
+}
+
+#endif /* EPICS_CONVERSION_REQUIRED */
+
+static void testKernels(const cacSwapKernels *pKernels, const char *pName)
+{
+#ifdef EPICS_CONVERSION_REQUIRED
+    if (pKernels) {
+        testOk(checkKernel(pKernels->swap16, 2u, false), "%s 16 bit", pName);
+        testOk(checkKernel(pKernels->swap32, 4u, false), "%s 32 bit", pName);
+        testOk(checkKernel(pKernels->swap64, 8u, false), "%s 64 bit", pName);
+        testOk(checkKernel(pKernels->swap32, 4u, true) &&
+            checkKernel(pKernels->swap64, 8u, true),
+            "%s in place", pName);
+        return;
+    }
+#endif
+    char why[40];
+    sprintf(why, "No %s kernels on this host", pName);
+    testSkip(4, why);
+}
+
+/*
+ * Host format values which survive the trip through a
+ * floating point register unchanged
+ */
+static void fill(unsigned type, char *pBuf, unsigned long count)
+{
+    char *pValue = pBuf + dbr_value_offset[type];
+    unsigned long i;
+
+    memset(pBuf, 0x5a, dbr_size_n(type, count));
+    for (i = 0; i < count; i++) {
+        switch (type % (LAST_TYPE + 1)) {
+        case DBR_FLOAT:
+            ((dbr_float_t *) pValue)[i] = i * 0.75f - 1000.125f;
+            break;
+        case DBR_DOUBLE:
+            ((dbr_double_t *) pValue)[i] = i * 1.0e-3 - 3.0e5;
+            break;
+        case DBR_LONG:
+            ((dbr_long_t *) pValue)[i] = (dbr_long_t) (i * 2654435761u);
+            break;
+        default:
+            ((dbr_short_t *) pValue)[i] = (dbr_short_t) (i * 40503u);
+            break;
+        }
+    }
+}
+
+/*
+ * The destinations start as copies of the source, as the
+ * conversions don't write the padding in the structures
+ */
+static bool checkConvert(unsigned type, unsigned long count)
+{
+    size_t size = dbr_size_n(type, count);
+    unsigned offset = dbr_value_offset[type];
+
+    fill(type, host, count);
+
+    memcpy(net, host, size);
+    caNetConvert(type, host, net, 1, count);
+    if (count && !isReversed(net + offset, host + offset, count,
+            swapped ? dbr_value_size[type] : 1u)) {
+        testDiag("%s with %lu elements: wrong network values",
+            dbr_text[type], count);
+        return false;
+    }
+
+    memcpy(work, net, size);
+    caNetConvert(type, net, work, 0, count);
+    if (memcmp(work, host, size)) {
+        testDiag("%s with %lu elements: wrong host values",
+            dbr_text[type], count);
+        return false;
+    }
+
+    memcpy(work, host, size);
+    caNetConvert(type, work, work, 1, count);
+    bool ok = !memcmp(work, net, size);
+    caNetConvert(type, work, work, 0, count);
+    if (!ok || memcmp(work, host, size)) {
+        testDiag("%s with %lu elements: wrong in place",
+            dbr_text[type], count);
+        return false;
+    }
+    return true;
+}
+
+MAIN(caConvertTest)
+{
+    const cacSwapKernels *pSSE2 = 0, *pAVX2 = 0, *pNEON = 0;
+    unsigned i, j;
+
+    testPlan(12 + NELEMENTS(checkTypes));
+
+#ifdef EPICS_CONVERSION_REQUIRED
+    testDiag("caNetConvert() uses the %s kernels", bestSwapKernels()->pName);
+#endif
+#ifdef CA_SWAP_SSE2
+    pSSE2 = &swapSSE2;
+#endif
+#ifdef CA_SWAP_AVX2
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2"))
+        pAVX2 = &swapAVX2;
+#endif
+#ifdef CA_SWAP_NEON
+    pNEON = &swapNEON;
+#endif
+    testKernels(pSSE2, "SSE2");
+    testKernels(pAVX2, "AVX2");
+    testKernels(pNEON, "NEON");
+
+    for (i = 0; i < NELEMENTS(checkTypes); i++) {
+        bool ok = true;
+        for (j = 0; ok && j < NELEMENTS(checkCounts); j++)
+            ok = checkConvert(checkTypes[i], checkCounts[j]);
+        testOk(ok, "%s", dbr_text[checkTypes[i]]);
+    }
+
+    return testDone();
+}
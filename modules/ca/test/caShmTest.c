@@ -0,0 +1,150 @@
+/*************************************************************************\
+* EPICS BASE is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+
+/*
+ * Tests of the byte rings of the CA shared memory transport, with
+ * both ends of the segment mapped in this process
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "dbDefs.h"
+#include "epicsUnitTest.h"
+#include "testMain.h"
+
+#include "caShm.h"
+
+static void fill(char *pBuf, unsigned nBytes, unsigned seed)
+{
+    unsigned i;
+
+    for (i = 0; i < nBytes; i++)
+        pBuf[i] = (char) (i * 7u + seed);
+}
+
+static void testTransfer(caShm *pServer, caShm *pClient)
+{
+    char out[100], in[200];
+    unsigned n;
+    int wakeup;
+
+    testDiag("Server to client");
+
+    fill(out, sizeof(out), 1);
+    n = caShmWrite(pServer, out, sizeof(out), &wakeup);
+    testOk(n == sizeof(out) && !wakeup, "Wrote %u bytes, no wakeup", n);
+    testOk(caShmPending(pClient) == sizeof(out) && caShmPending(pServer) == 0,
+        "Client has %u bytes pending, server none", caShmPending(pClient));
+
+    n = caShmRead(pClient, in, sizeof(in));
+    testOk(n == sizeof(out) && !memcmp(in, out, sizeof(out)),
+        "Read %u bytes back", n);
+    testOk1(caShmPending(pClient) == 0);
+
+    testDiag("Client to server");
+
+    fill(out, 50, 2);
+    n = caShmWrite(pClient, out, 50, &wakeup);
+    testOk(n == 50 && caShmPending(pServer) == 50 && caShmPending(pClient) == 0,
+        "Wrote %u bytes to the server", n);
+    n = caShmRead(pServer, in, sizeof(in));
+    testOk(n == 50 && !memcmp(in, out, 50), "Server read %u bytes", n);
+}
+
+static void testFull(caShm *pServer, caShm *pClient)
+{
+    unsigned size = caShmRingSize(pServer);
+    char *pOut = malloc(size + 10);
+    char *pIn = malloc(size);
+    char more[1000];
+    unsigned n;
+    int wakeup;
+
+    testDiag("Full ring of %u bytes", size);
+
+    if (!pOut || !pIn) {
+        testAbort("Out of memory");
+    }
+    fill(pOut, size + 10, 3);
+    fill(more, sizeof(more), 4);
+
+    n = caShmWrite(pServer, pOut, size + 10, &wakeup);
+    testOk(n == size, "Wrote %u bytes of %u", n, size + 10);
+    n = caShmWrite(pServer, more, 1, &wakeup);
+    testOk(n == 0, "Wrote %u bytes to the full ring", n);
+
+    n = caShmRead(pClient, pIn, sizeof(more));
+    testOk(n == sizeof(more) && !memcmp(pIn, pOut, sizeof(more)),
+        "Read %u bytes", n);
+
+    /* the bytes written now wrap around the end of the ring */
+    n = caShmWrite(pServer, more, sizeof(more), &wakeup);
+    testOk(n == sizeof(more), "Wrote %u bytes into the space", n);
+
+    n = caShmRead(pClient, pIn, size);
+    testOk(n == size &&
+        !memcmp(pIn, pOut + sizeof(more), size - sizeof(more)) &&
+        !memcmp(pIn + size - sizeof(more), more, sizeof(more)),
+        "Read %u bytes across the end of the ring", n);
+    testOk1(caShmPending(pClient) == 0);
+
+    free(pOut);
+    free(pIn);
+}
+
+static void testWakeup(caShm *pServer, caShm *pClient)
+{
+    char out[10], in[20];
+    int wakeup;
+
+    testDiag("Wakeups");
+
+    fill(out, sizeof(out), 5);
+    testOk(!caShmWaitArm(pClient), "Client waits on an empty ring");
+    (void) caShmWrite(pServer, out, sizeof(out), &wakeup);
+    testOk(wakeup, "The first write wakes the client");
+    (void) caShmWrite(pServer, out, sizeof(out), &wakeup);
+    testOk(!wakeup, "The second write doesn't");
+    testOk(caShmWaitArm(pClient), "Client doesn't wait with bytes pending");
+    testOk(caShmRead(pClient, in, sizeof(in)) == sizeof(in),
+        "Read both writes");
+}
+
+MAIN(caShmTest)
+{
+    caShm *pServer, *pClient;
+    char name[CA_SHM_NAME_SIZE];
+
+    testPlan(23);
+
+    if (!caShmSupported()) {
+        testSkip(23, "No shared memory transport on this target");
+        return testDone();
+    }
+
+    pServer = caShmCreate(1000u);
+    if (!testOk(pServer != NULL, "Created a segment"))
+        testAbort("Can't create a segment");
+    testOk(caShmRingSize(pServer) == 1u << 16,
+        "Ring size %u is the minimum", caShmRingSize(pServer));
+    strcpy(name, caShmName(pServer));
+
+    pClient = caShmAttach(name);
+    if (!testOk(pClient != NULL, "Attached to %s", name))
+        testAbort("Can't attach to the segment");
+    testOk1(caShmRingSize(pClient) == caShmRingSize(pServer));
+    testOk(caShmAttach(name) == NULL, "Name removed by caShmAttach()");
+    testOk1(caShmAttach("/caShmTest.missing") == NULL);
+
+    testTransfer(pServer, pClient);
+    testFull(pServer, pClient);
+    testWakeup(pServer, pClient);
+
+    caShmDestroy(pClient);
+    caShmDestroy(pServer);
+
+    return testDone();
+}
@@ -0,0 +1,169 @@
+/*************************************************************************\
+* EPICS BASE is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+
+/*
+ * Tests of reading and writing the CA client's name cache file
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "epicsMutex.h"
+#include "epicsGuard.h"
+#include "osiSock.h"
+#include "epicsUnitTest.h"
+#include "testMain.h"
+
+#include "caProto.h"
+#include "nameCache.h"
+
+static const char * const cacheFile = "nameCacheTest.cache";
+
+static void writeCache()
+{
+    FILE *pFile = fopen(cacheFile, "w");
+    unsigned i;
+
+    if (!pFile)
+        testAbort("Can't write %s", cacheFile);
+    fputs("10.0.0.5:5070 a:b\n", pFile);
+    fputs("10.0.0.6 c:d\r\n", pFile);
+    fputs("10.0.0.7:5064 a:b\n", pFile);
+    fputs("nospace\n", pFile);
+    fputs("10.0.0.8:5064 \n", pFile);
+    fputs("10.0.0.8:5064 ", pFile);
+    for (i = 0; i < MAX_UDP_SEND + 100u; i++)
+        putc('x', pFile);
+    fputs("\n10.0.0.6:5064 e:f\n", pFile);
+    fclose(pFile);
+}
+
+static struct sockaddr_in addrOf(const char *pAddr)
+{
+    struct sockaddr_in addr;
+
+    memset(&addr, 0, sizeof(addr));
+    if (aToIPAddr(pAddr, CA_SERVER_PORT, &addr))
+        testAbort("Bad address %s", pAddr);
+    return addr;
+}
+
+static bool cachedAt(nameCache &cache, epicsGuard<epicsMutex> &guard,
+    const char *pName, const char *pAddr)
+{
+    struct sockaddr_in addr, expected = addrOf(pAddr);
+    unsigned epoch = 0u;
+
+    return cache.lookup(guard, pName, true, epoch, addr) &&
+        addr.sin_addr.s_addr == expected.sin_addr.s_addr &&
+        addr.sin_port == expected.sin_port;
+}
+
+static void testLoad(epicsMutex &mutex)
+{
+    epicsGuard<epicsMutex> guard(mutex);
+    struct sockaddr_in addr;
+    unsigned epoch = 0u;
+
+    testDiag("Reading %s", cacheFile);
+
+    writeCache();
+    nameCache cache(cacheFile);
+
+    testOk(cachedAt(cache, guard, "a:b", "10.0.0.5:5070"),
+        "a:b at the server of its first line");
+    testOk(cachedAt(cache, guard, "c:d", "10.0.0.6:5064"),
+        "c:d at the default port, CR dropped");
+    testOk(cachedAt(cache, guard, "e:f", "10.0.0.6:5064"),
+        "e:f after an overlong line");
+    testOk(!cache.lookup(guard, "nospace", true, epoch, addr),
+        "Line without a name ignored");
+    testOk(!cache.lookup(guard, "", true, epoch, addr),
+        "Line with an empty name ignored");
+}
+
+static void testUpdate(epicsMutex &mutex)
+{
+    epicsGuard<epicsMutex> guard(mutex);
+    struct sockaddr_in addr;
+    unsigned epoch = 0u;
+
+    testDiag("Updating the cache");
+
+    nameCache cache(cacheFile);
+
+    testOk1(cache.lookup(guard, "a:b", true, epoch, addr));
+    testOk(!cache.lookup(guard, "a:b", false, epoch, addr),
+        "Not retried without a beacon anomaly");
+    cache.beaconAnomaly(guard, addrOf("10.0.0.6:5065"));
+    testOk(!cache.lookup(guard, "a:b", false, epoch, addr),
+        "Not retried after an anomaly from another host");
+    cache.beaconAnomaly(guard, addrOf("10.0.0.5:6000"));
+    testOk(cache.lookup(guard, "a:b", false, epoch, addr),
+        "Retried after an anomaly from its host");
+
+    cache.notFound(guard, "a:b", addrOf("10.0.0.5:5064"));
+    testOk(cachedAt(cache, guard, "a:b", "10.0.0.5:5070"),
+        "Kept when another server on the host doesn't have it");
+    cache.notFound(guard, "a:b", addrOf("10.0.0.5:5070"));
+    testOk(!cache.lookup(guard, "a:b", true, epoch, addr),
+        "Dropped when its server doesn't have it");
+
+    cache.update(guard, "c:d", addrOf("10.0.0.9:5064"));
+    cache.update(guard, "g:h", addrOf("10.0.0.6:5064"));
+    testOk1(cachedAt(cache, guard, "c:d", "10.0.0.9:5064"));
+    testOk1(cachedAt(cache, guard, "g:h", "10.0.0.6:5064"));
+
+    cache.save(guard);
+}
+
+static void testSaved(epicsMutex &mutex)
+{
+    epicsGuard<epicsMutex> guard(mutex);
+    struct sockaddr_in addr;
+    unsigned epoch = 0u;
+    char line[80];
+    unsigned nLines = 0u, nMatch = 0u;
+
+    testDiag("Reading the saved cache");
+
+    FILE *pFile = fopen(cacheFile, "r");
+    if (!pFile)
+        testAbort("Can't read %s", cacheFile);
+    while (fgets(line, sizeof(line), pFile)) {
+        nLines++;
+        if (!strcmp(line, "10.0.0.9:5064 c:d\n") ||
+            !strcmp(line, "10.0.0.6:5064 e:f\n") ||
+            !strcmp(line, "10.0.0.6:5064 g:h\n"))
+            nMatch++;
+    }
+    fclose(pFile);
+    testOk(nLines == 3u && nMatch == 3u,
+        "Saved %u lines, %u as expected", nLines, nMatch);
+
+    nameCache cache(cacheFile);
+    testOk1(cachedAt(cache, guard, "c:d", "10.0.0.9:5064"));
+    testOk1(cachedAt(cache, guard, "e:f", "10.0.0.6:5064"));
+    testOk1(cachedAt(cache, guard, "g:h", "10.0.0.6:5064"));
+    testOk1(!cache.lookup(guard, "a:b", true, epoch, addr));
+}
+
+MAIN(nameCacheTest)
+{
+    testPlan(18);
+
+    osiSockAttach();
+    {
+        epicsMutex mutex;
+
+        testLoad(mutex);
+        testUpdate(mutex);
+        testSaved(mutex);
+    }
+    remove(cacheFile);
+    osiSockRelease();
+
+    return testDone();
+}
@@ -0,0 +1,7 @@
+/* Generated file, do not edit! */
+
+/* Version determined from Git */
+
+#ifndef EPICS_VCS_VERSION
+  #define EPICS_VCS_VERSION "9273a505c986be00a4e0-dirty"
+#endif
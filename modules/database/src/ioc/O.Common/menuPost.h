@@ -0,0 +1,15 @@
+/* menuPost.h generated from menuPost.dbd */
+
+#ifndef INC_menuPost_H
+#define INC_menuPost_H
+
+#ifndef menuPost_NUM_CHOICES
+typedef enum {
+    menuPost_OnChange               /* On Change */,
+    menuPost_Always                 /* Always */
+} menuPost;
+#define menuPost_NUM_CHOICES 2
+#endif
+
+
+#endif /* INC_menuPost_H */
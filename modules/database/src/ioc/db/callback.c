@@ -26,9 +26,11 @@
 #include "epicsAtomic.h"
 #include "epicsEvent.h"
 #include "epicsInterrupt.h"
-#include "epicsRingPointer.h"
+#include "epicsMutex.h"
 #include "epicsString.h"
+#include "epicsSpin.h"
 #include "epicsThread.h"
+#include "epicsTime.h"
 #include "epicsTimer.h"
 #include "errlog.h"
 #include "errMdef.h"
@@ -40,6 +42,7 @@
 #include "dbAddr.h"
 #include "dbBase.h"
 #include "dbCommon.h"
+#include "dbCommonPvt.h"
 #include "dbFldTypes.h"
 #include "dbLock.h"
 #include "dbStaticLib.h"
@@ -50,12 +53,65 @@
 
 
 static int callbackQueueSize = 2000;
+static int callbackQueueLimit = 2000;   /* use atomic */
+static int callbackQueuePolicy = queueFullDrop; /* use atomic */
+
+/* Bounded lock-free multi-producer/multi-consumer ring after D. Vyukov.
+ * Each slot carries a sequence number which tells producers and
+ * consumers whose turn it is, so no lock is needed on either side.
+ */
+typedef struct cbSlot {
+    size_t seq;         /* use atomic */
+    epicsCallback *pcallback;
+    epicsUInt64 queued; /* epicsMonotonicGet() when pushed, or 0 */
+} cbSlot;
+
+typedef struct cbRing {
+    size_t nextPush;    /* use atomic */
+    size_t nextPop;     /* use atomic */
+    size_t mask;        /* size - 1, size is a power of 2 */
+    cbSlot *slots;
+    EpicsAtomicPtrT next;   /* larger ring which replaced this one */
+} cbRing;
+
+/* A queue is a chain of rings.  When the tail ring fills up a ring of
+ * twice the size is appended, producers move on to it and consumers
+ * follow once the old ring has been emptied.
+ */
+typedef struct cbQueue {
+    EpicsAtomicPtrT head;   /* consumers pop from here */
+    EpicsAtomicPtrT tail;   /* producers push here */
+    cbRing *first;
+} cbQueue;
+
+struct cbQueueSet;
+
+typedef struct cbWorker {
+    struct cbQueueSet *set;
+    int index;
+    epicsThreadId tid;
+    /* Queue wait statistics, guarded by statLock */
+    epicsSpinId statLock;
+    epicsUInt64 waitCount;
+    epicsUInt64 waitTotal;
+    epicsUInt64 waitMax;
+} cbWorker;
 
 typedef struct cbQueueSet {
     epicsEventId semWakeUp;
-    epicsRingPointerId queue;
+    epicsEventId semSpace;  /* for producers blocked on a full queue */
+    epicsMutexId growLock;
+    cbQueue *queues;    /* one shared, or one per worker */
+    int numQueues;
+    int nextQueue;      /* use atomic, round robin for producers */
+    int numUsed;        /* use atomic */
+    int maxUsed;        /* use atomic */
+    cbWorker *workers;
+    int numBlocked;     /* use atomic */
     int queueOverflow;
     int queueOverflows;
+    int queueCoalesced;
+    int queueGrowths;
     int shutdown; // use atomic
     int threadsConfigured;
     int threadsRunning;
@@ -69,6 +125,12 @@ int callbackThreadsDefault = 1;
 int callbackParallelThreadsDefault = 2;
 epicsExportAddress(int,callbackParallelThreadsDefault);
 
+/* Give each parallel callback thread its own queue, and let idle
+ * threads steal work from the queues of the others.
+ */
+int callbackWorkerQueues = 0;
+epicsExportAddress(int,callbackWorkerQueues);
+
 /* Timer for Delayed Requests */
 static epicsTimerQueueId timerQueue;
 
@@ -95,8 +157,378 @@ static unsigned int threadPriority[NUM_CALLBACK_PRIORITIES] = {
     epicsThreadPriorityScanLow + 4,
     epicsThreadPriorityScanHigh + 1
 };
-static int priorityValue[NUM_CALLBACK_PRIORITIES] = {0, 1, 2};
 
+static const char *policyName[] = {
+    "drop", "block", "coalesce", "dropOldest"
+};
+
+static void ProcessCallback(epicsCallback *pcallback);
+static void cbCountDrop(epicsCallback *pcallback);
+
+/* Positions are counted modulo CB_POSMASK + 1, the top bit of the
+ * producer position marks a ring which has been replaced by a larger
+ * one and will take no more entries.
+ */
+#define CB_SEALED   (~(~(size_t)0 >> 1))
+#define CB_POSMASK  (~CB_SEALED)
+
+/* Signed distance a - b between two positions */
+static ptrdiff_t cbDiff(size_t a, size_t b)
+{
+    return (ptrdiff_t)(((a - b) & CB_POSMASK) << 1) >> 1;
+}
+
+static cbRing * cbRingCreate(int size)
+{
+    cbRing *ring = calloc(1, sizeof(cbRing));
+    size_t capacity = 2;
+    size_t i;
+
+    if (!ring)
+        return NULL;
+    while (capacity < (size_t)size)
+        capacity <<= 1;
+    ring->slots = calloc(capacity, sizeof(cbSlot));
+    if (!ring->slots) {
+        free(ring);
+        return NULL;
+    }
+    for (i = 0; i < capacity; i++)
+        ring->slots[i].seq = i;
+    ring->mask = capacity - 1;
+    return ring;
+}
+
+static int cbRingPush(cbRing *ring, epicsCallback *pcallback, epicsUInt64 now)
+{
+    size_t pos = epicsAtomicGetSizeT(&ring->nextPush);
+
+    for (;;) {
+        cbSlot *slot;
+        size_t seq;
+        ptrdiff_t dif;
+
+        if (pos & CB_SEALED)
+            return FALSE;
+        slot = &ring->slots[pos & ring->mask];
+        seq = epicsAtomicGetSizeT(&slot->seq);
+        dif = cbDiff(seq, pos);
+
+        if (dif == 0) {
+            size_t prev = epicsAtomicCmpAndSwapSizeT(&ring->nextPush,
+                pos, (pos + 1) & CB_POSMASK);
+
+            if (prev == pos) {
+                slot->pcallback = pcallback;
+                slot->queued = now;
+                epicsAtomicWriteMemoryBarrier();
+                epicsAtomicSetSizeT(&slot->seq, (pos + 1) & CB_POSMASK);
+                return TRUE;
+            }
+            pos = prev;
+        }
+        else if (dif < 0) {
+            return FALSE;   /* full */
+        }
+        else {
+            pos = epicsAtomicGetSizeT(&ring->nextPush);
+        }
+    }
+}
+
+static epicsCallback * cbRingPop(cbRing *ring, epicsUInt64 *pqueued)
+{
+    size_t pos = epicsAtomicGetSizeT(&ring->nextPop);
+
+    for (;;) {
+        cbSlot *slot = &ring->slots[pos & ring->mask];
+        size_t seq = epicsAtomicGetSizeT(&slot->seq);
+        ptrdiff_t dif = cbDiff(seq, (pos + 1) & CB_POSMASK);
+
+        if (dif == 0) {
+            size_t prev = epicsAtomicCmpAndSwapSizeT(&ring->nextPop,
+                pos, (pos + 1) & CB_POSMASK);
+
+            if (prev == pos) {
+                epicsCallback *pcallback = slot->pcallback;
+
+                *pqueued = slot->queued;
+                epicsAtomicWriteMemoryBarrier();
+                epicsAtomicSetSizeT(&slot->seq,
+                    (pos + ring->mask + 1) & CB_POSMASK);
+                return pcallback;
+            }
+            pos = prev;
+        }
+        else if (dif < 0) {
+            return NULL;    /* empty, or next push not yet complete */
+        }
+        else {
+            pos = epicsAtomicGetSizeT(&ring->nextPop);
+        }
+    }
+}
+
+/* Is pcallback sitting in the ring, pushed but not yet popped? */
+static int cbRingFind(cbRing *ring, epicsCallback *pcallback)
+{
+    size_t i;
+
+    for (i = 0; i <= ring->mask; i++) {
+        cbSlot *slot = &ring->slots[i];
+        size_t seq = epicsAtomicGetSizeT(&slot->seq);
+
+        if (((seq - 1) & ring->mask) == i && slot->pcallback == pcallback &&
+            epicsAtomicGetSizeT(&slot->seq) == seq)
+            return TRUE;
+    }
+    return FALSE;
+}
+
+static void cbRingSeal(cbRing *ring)
+{
+    size_t pos = epicsAtomicGetSizeT(&ring->nextPush);
+
+    while (!(pos & CB_SEALED)) {
+        size_t prev = epicsAtomicCmpAndSwapSizeT(&ring->nextPush,
+            pos, pos | CB_SEALED);
+
+        if (prev == pos) break;
+        pos = prev;
+    }
+}
+
+/* Sealed, and every entry that made it in has been taken out */
+static int cbRingDrained(cbRing *ring)
+{
+    size_t pos = epicsAtomicGetSizeT(&ring->nextPush);
+
+    return (pos & CB_SEALED) &&
+        epicsAtomicGetSizeT(&ring->nextPop) == (pos & CB_POSMASK);
+}
+
+static cbRing * cbRingNext(cbRing *ring)
+{
+    return (cbRing *)epicsAtomicGetPtrT(&ring->next);
+}
+
+static void cbQueueInit(cbQueue *q, int size, const char *name)
+{
+    cbRing *ring = cbRingCreate(size);
+
+    if (!ring)
+        cantProceed("callbackInit: No memory for %s queue\n", name);
+    q->first = q->head = q->tail = ring;
+}
+
+static void cbQueueDestroy(cbQueue *q)
+{
+    cbRing *ring = q->first;
+
+    while (ring) {
+        cbRing *next = cbRingNext(ring);
+
+        free(ring->slots);
+        free(ring);
+        ring = next;
+    }
+}
+
+static epicsCallback * cbQueuePopOne(cbQueue *q, epicsUInt64 *pqueued)
+{
+    for (;;) {
+        cbRing *head = (cbRing *)epicsAtomicGetPtrT(&q->head);
+        epicsCallback *pcallback = cbRingPop(head, pqueued);
+        cbRing *next;
+
+        if (pcallback)
+            return pcallback;
+        next = cbRingNext(head);
+        if (!next || !cbRingDrained(head))
+            return NULL;
+        /* Replaced rings are kept until callbackCleanup() since
+         * other threads may still be looking at them.
+         */
+        epicsAtomicCmpAndSwapPtrT(&q->head, head, next);
+    }
+}
+
+/* The entries the rings of a set can hold: all of an open ring, and
+ * those still waiting in a sealed one.  Called with growLock held.
+ */
+static int cbQueueSetHeld(cbQueueSet *mySet)
+{
+    int held = 0;
+    int i;
+
+    for (i = 0; i < mySet->numQueues; i++) {
+        cbRing *ring = (cbRing *)epicsAtomicGetPtrT(&mySet->queues[i].head);
+
+        for (; ring; ring = cbRingNext(ring)) {
+            size_t pos = epicsAtomicGetSizeT(&ring->nextPush);
+
+            if (pos & CB_SEALED)
+                held += (int)((pos - epicsAtomicGetSizeT(&ring->nextPop))
+                    & CB_POSMASK);
+            else
+                held += (int)ring->mask + 1;
+        }
+    }
+    return held;
+}
+
+/* Replace a full ring with a larger one, while the rings of all the
+ * queues of the set hold no more than the queue limit
+ */
+static int cbQueueGrow(cbQueueSet *mySet, cbRing *tail)
+{
+    int limit = epicsAtomicGetIntT(&callbackQueueLimit);
+    int grown = FALSE;
+
+    if (epicsInterruptIsInterruptContext())
+        return FALSE;
+
+    epicsMutexMustLock(mySet->growLock);
+    if (cbRingNext(tail)) {
+        grown = TRUE;
+    }
+    else {
+        int room = limit - cbQueueSetHeld(mySet);
+        int size = 2 * (int)(tail->mask + 1);
+        cbRing *ring = NULL;
+
+        /* ring sizes are powers of 2 */
+        while (size > room && size > 2)
+            size >>= 1;
+        if (size <= room)
+            ring = cbRingCreate(size);
+        if (ring) {
+            cbRingSeal(tail);
+            epicsAtomicSetPtrT(&tail->next, ring);
+            epicsAtomicIncrIntT(&mySet->queueGrowths);
+            grown = TRUE;
+        }
+    }
+    epicsMutexUnlock(mySet->growLock);
+    return grown;
+}
+
+static int cbQueuePushOne(cbQueueSet *mySet, cbQueue *q,
+    epicsCallback *pcallback, epicsUInt64 now)
+{
+    for (;;) {
+        cbRing *tail = (cbRing *)epicsAtomicGetPtrT(&q->tail);
+        cbRing *next;
+
+        if (cbRingPush(tail, pcallback, now))
+            return TRUE;
+        next = cbRingNext(tail);
+        if (next)
+            epicsAtomicCmpAndSwapPtrT(&q->tail, tail, next);
+        else if (!cbQueueGrow(mySet, tail))
+            return FALSE;
+    }
+}
+
+static int cbQueueFind(cbQueue *q, epicsCallback *pcallback)
+{
+    cbRing *ring;
+
+    for (ring = (cbRing *)epicsAtomicGetPtrT(&q->head); ring;
+         ring = cbRingNext(ring)) {
+        if (cbRingFind(ring, pcallback))
+            return TRUE;
+    }
+    return FALSE;
+}
+
+/* Take from our own queue first, then steal from the others */
+static epicsCallback * cbQueuePop(cbWorker *me, epicsUInt64 *pqueued)
+{
+    cbQueueSet *mySet = me->set;
+    int n = mySet->numQueues;
+    int i;
+
+    for (i = 0; i < n; i++) {
+        epicsCallback *pcallback =
+            cbQueuePopOne(&mySet->queues[(me->index + i) % n], pqueued);
+
+        if (pcallback) {
+            epicsAtomicDecrIntT(&mySet->numUsed);
+            if (epicsAtomicGetIntT(&mySet->numBlocked))
+                epicsEventSignal(mySet->semSpace);
+            return pcallback;
+        }
+    }
+    return NULL;
+}
+
+static int cbQueuePush(cbQueueSet *mySet, epicsCallback *pcallback,
+    epicsUInt64 now)
+{
+    int n = mySet->numQueues;
+    int first = 0;
+    int i;
+
+    if (n > 1)
+        first = (unsigned)epicsAtomicIncrIntT(&mySet->nextQueue) % n;
+
+    for (i = 0; i < n; i++) {
+        if (cbQueuePushOne(mySet, &mySet->queues[(first + i) % n],
+                pcallback, now)) {
+            int used = epicsAtomicIncrIntT(&mySet->numUsed);
+            int max = epicsAtomicGetIntT(&mySet->maxUsed);
+
+            while (used > max) {
+                int prev = epicsAtomicCmpAndSwapIntT(&mySet->maxUsed,
+                    max, used);
+
+                if (prev == max) break;
+                max = prev;
+            }
+            return TRUE;
+        }
+    }
+    return FALSE;
+}
+
+static int cbQueueFindAny(cbQueueSet *mySet, epicsCallback *pcallback)
+{
+    int i;
+
+    for (i = 0; i < mySet->numQueues; i++) {
+        if (cbQueueFind(&mySet->queues[i], pcallback))
+            return TRUE;
+    }
+    return FALSE;
+}
+
+static int isCallbackThread(void)
+{
+    epicsThreadId self = epicsThreadGetIdSelf();
+    int prio, i;
+
+    for (prio = 0; prio < NUM_CALLBACK_PRIORITIES; prio++) {
+        cbQueueSet *mySet = &callbackQueue[prio];
+
+        for (i = 0; i < mySet->threadsConfigured && mySet->workers; i++) {
+            if (mySet->workers[i].tid == self)
+                return TRUE;
+        }
+    }
+    return FALSE;
+}
+
+static void cbCountDrop(epicsCallback *pcallback)
+{
+    dbCommon *prec;
+
+    if (pcallback->callback != ProcessCallback)
+        return;
+    callbackGetUser(prec, pcallback);
+    if (prec)
+        epicsAtomicIncrIntT(&dbRec2Pvt(prec)->dropCount);
+}
 
 int callbackSetQueueSize(int size)
 {
@@ -105,6 +537,45 @@ int callbackSetQueueSize(int size)
         return -1;
     }
     callbackQueueSize = size;
+    if (epicsAtomicGetIntT(&callbackQueueLimit) < size)
+        epicsAtomicSetIntT(&callbackQueueLimit, size);
+    return 0;
+}
+
+int callbackParseQueuePolicy(const char *policy)
+{
+    int i;
+
+    for (i = 0; i < (int)NELEMENTS(policyName); i++) {
+        if (epicsStrCaseCmp(policy, policyName[i]) == 0)
+            return i;
+    }
+    return -1;
+}
+
+int callbackSetQueueLimit(int limit, const char *policy)
+{
+    if (policy && *policy) {
+        int i = callbackParseQueuePolicy(policy);
+
+        if (i < 0) {
+            fprintf(stderr, "callbackSetQueueLimit: Unknown policy \"%s\"\n",
+                policy);
+            return -1;
+        }
+        if (i == queueFullDropOldest) {
+            /* Every queued callback is owed to someone, such as an
+             * asynchronous record waiting for its completion.
+             */
+            fprintf(stderr, "callbackSetQueueLimit: Queued callbacks "
+                "can't be dropped, use \"drop\" instead\n");
+            return -1;
+        }
+        epicsAtomicSetIntT(&callbackQueuePolicy, i);
+    }
+    if (limit < callbackQueueSize)
+        limit = callbackQueueSize;
+    epicsAtomicSetIntT(&callbackQueueLimit, limit);
     return 0;
 }
 
@@ -114,12 +585,26 @@ int callbackQueueStatus(const int reset, callbackQueueStats *result)
     if (epicsAtomicGetIntT(&cbState)==cbInit) return -1;
     if (result) {
         int prio;
-        result->size = callbackQueueSize;
+        result->size = 0;
         for(prio = 0; prio < NUM_CALLBACK_PRIORITIES; prio++) {
-            epicsRingPointerId qId = callbackQueue[prio].queue;
-            result->numUsed[prio] = epicsRingPointerGetUsed(qId);
-            result->maxUsed[prio] = epicsRingPointerGetHighWaterMark(qId);
-            result->numOverflow[prio] = epicsAtomicGetIntT(&callbackQueue[prio].queueOverflows);
+            cbQueueSet *mySet = &callbackQueue[prio];
+            int i, size = 0;
+
+            /* Rings still being drained count towards the size */
+            for (i = 0; i < mySet->numQueues; i++) {
+                cbRing *ring = (cbRing *)
+                    epicsAtomicGetPtrT(&mySet->queues[i].head);
+
+                for (; ring; ring = cbRingNext(ring))
+                    size += (int)ring->mask + 1;
+            }
+            if (size > result->size)
+                result->size = size;
+            result->numUsed[prio] = epicsAtomicGetIntT(&mySet->numUsed);
+            if (result->numUsed[prio] < 0)
+                result->numUsed[prio] = 0;
+            result->maxUsed[prio] = epicsAtomicGetIntT(&mySet->maxUsed);
+            result->numOverflow[prio] = epicsAtomicGetIntT(&mySet->queueOverflows);
         }
         ret = 0;
     } else {
@@ -128,27 +613,82 @@ int callbackQueueStatus(const int reset, callbackQueueStats *result)
     if (reset) {
         int prio;
         for(prio = 0; prio < NUM_CALLBACK_PRIORITIES; prio++) {
-            epicsRingPointerResetHighWaterMark(callbackQueue[prio].queue);
+            cbQueueSet *mySet = &callbackQueue[prio];
+            int i;
+
+            epicsAtomicSetIntT(&mySet->maxUsed,
+                epicsAtomicGetIntT(&mySet->numUsed));
+            for (i = 0; i < mySet->threadsConfigured; i++) {
+                cbWorker *pw = &mySet->workers[i];
+
+                epicsSpinLock(pw->statLock);
+                pw->waitCount = pw->waitTotal = pw->waitMax = 0;
+                epicsSpinUnlock(pw->statLock);
+            }
         }
     }
     return ret;
 }
 
+int callbackQueueExtStatus(callbackQueueExtStats *result)
+{
+    int prio;
+
+    if (epicsAtomicGetIntT(&cbState)==cbInit) return -1;
+    if (!result) return -2;
+    for (prio = 0; prio < NUM_CALLBACK_PRIORITIES; prio++) {
+        cbQueueSet *mySet = &callbackQueue[prio];
+        epicsUInt64 count = 0, total = 0, max = 0;
+        int i;
+
+        for (i = 0; i < mySet->threadsConfigured; i++) {
+            cbWorker *pw = &mySet->workers[i];
+
+            epicsSpinLock(pw->statLock);
+            count += pw->waitCount;
+            total += pw->waitTotal;
+            if (pw->waitMax > max)
+                max = pw->waitMax;
+            epicsSpinUnlock(pw->statLock);
+        }
+        result->numCoalesced[prio] = epicsAtomicGetIntT(&mySet->queueCoalesced);
+        result->numGrowths[prio] = epicsAtomicGetIntT(&mySet->queueGrowths);
+        result->meanWait[prio] = count ? 1e-9 * total / count : 0.0;
+        result->maxWait[prio] = 1e-9 * max;
+    }
+    result->limit = epicsAtomicGetIntT(&callbackQueueLimit);
+    return 0;
+}
+
 void callbackQueueShow(const int reset)
 {
     callbackQueueStats stats;
+    callbackQueueExtStats ext;
+
+    /* before the reset clears the wait times */
+    callbackQueueExtStatus(&ext);
     if (callbackQueueStatus(reset, &stats) == -1) {
         fprintf(stderr, "Callback system not initialized, yet. Please run "
             "iocInit before using this command.\n");
     } else {
         int prio;
-        printf("PRIORITY  HIGH-WATER MARK  ITEMS IN Q  Q SIZE  %% USED  Q OVERFLOWS\n");
+        printf("PRIORITY  HIGH-WATER MARK  ITEMS IN Q  Q SIZE  %% USED  Q OVERFLOWS"
+               "  MEAN WAIT ms  MAX WAIT ms\n");
         for (prio = 0; prio < NUM_CALLBACK_PRIORITIES; prio++) {
             double qusage = 100.0 * stats.numUsed[prio] / stats.size;
-            printf("%8s  %15d  %10d  %6d  %6.1f  %11d\n",
+            printf("%8s  %15d  %10d  %6d  %6.1f  %11d  %12.3f  %11.3f\n",
                    threadNamePrefix[prio], stats.maxUsed[prio],
                    stats.numUsed[prio], stats.size, qusage,
-                   stats.numOverflow[prio]);
+                   stats.numOverflow[prio], 1e3 * ext.meanWait[prio],
+                   1e3 * ext.maxWait[prio]);
+        }
+        printf("Queue limit %d, when full: %s\n", ext.limit,
+               policyName[epicsAtomicGetIntT(&callbackQueuePolicy)]);
+        for (prio = 0; prio < NUM_CALLBACK_PRIORITIES; prio++) {
+            if (ext.numGrowths[prio] || ext.numCoalesced[prio])
+                printf("%8s  grown %d times, %d requests coalesced\n",
+                       threadNamePrefix[prio], ext.numGrowths[prio],
+                       ext.numCoalesced[prio]);
         }
     }
 }
@@ -205,24 +745,38 @@ found:
 
 static void callbackTask(void *arg)
 {
-    int prio = *(int*)arg;
-    cbQueueSet *mySet = &callbackQueue[prio];
+    cbWorker *me = (cbWorker *)arg;
+    cbQueueSet *mySet = me->set;
 
+    me->tid = epicsThreadGetIdSelf();
     taskwdInsert(0, NULL, NULL);
     epicsEventSignal(startStopEvent);
 
     while(!epicsAtomicGetIntT(&mySet->shutdown)) {
-        void *ptr;
-        if (epicsRingPointerIsEmpty(mySet->queue))
-            epicsEventMustWait(mySet->semWakeUp);
+        epicsCallback *pcallback;
+        epicsUInt64 queued;
 
-        while ((ptr = epicsRingPointerPop(mySet->queue))) {
-            epicsCallback *pcallback = (epicsCallback *)ptr;
-            if(!epicsRingPointerIsEmpty(mySet->queue))
+        /* A producer may still be completing the push at the head of
+         * a queue, so wait to be signalled rather than spinning.
+         */
+        while ((pcallback = cbQueuePop(me, &queued))) {
+            if (epicsAtomicGetIntT(&mySet->numUsed) > 0)
                 epicsEventMustTrigger(mySet->semWakeUp);
             mySet->queueOverflow = FALSE;
+            if (queued) {
+                epicsUInt64 wait = epicsMonotonicGet() - queued;
+
+                epicsSpinLock(me->statLock);
+                me->waitCount++;
+                me->waitTotal += wait;
+                if (wait > me->waitMax)
+                    me->waitMax = wait;
+                epicsSpinUnlock(me->statLock);
+            }
             (*pcallback->callback)(pcallback);
         }
+        if (!epicsAtomicGetIntT(&mySet->shutdown))
+            epicsEventMustWait(mySet->semWakeUp);
     }
 
     if(!epicsAtomicDecrIntT(&mySet->threadsRunning))
@@ -239,6 +793,7 @@ void callbackStop(void)
     for (i = 0; i < NUM_CALLBACK_PRIORITIES; i++) {
         epicsAtomicSetIntT(&callbackQueue[i].shutdown, 1);
         epicsEventSignal(callbackQueue[i].semWakeUp);
+        epicsEventSignal(callbackQueue[i].semSpace);
     }
 
     for (i = 0; i < NUM_CALLBACK_PRIORITIES; i++) {
@@ -253,7 +808,7 @@ void callbackStop(void)
 
 void callbackCleanup(void)
 {
-    int i;
+    int i, j;
 
     if(epicsAtomicCmpAndSwapIntT(&cbState, cbStop, cbInit)!=cbStop) {
         fprintf(stderr, "callbackCleanup() but not stopped\n");
@@ -264,7 +819,14 @@ void callbackCleanup(void)
 
         assert(epicsAtomicGetIntT(&mySet->threadsRunning)==0);
         epicsEventDestroy(mySet->semWakeUp);
-        epicsRingPointerDelete(mySet->queue);
+        epicsEventDestroy(mySet->semSpace);
+        epicsMutexDestroy(mySet->growLock);
+        for (j = 0; j < mySet->numQueues; j++)
+            cbQueueDestroy(&mySet->queues[j]);
+        free(mySet->queues);
+        for (j = 0; j < mySet->threadsConfigured; j++)
+            epicsSpinDestroy(mySet->workers[j].statLock);
+        free(mySet->workers);
     }
 
     epicsTimerQueueRelease(timerQueue);
@@ -288,25 +850,41 @@ void callbackInit(void)
     timerQueue = epicsTimerQueueAllocate(0, epicsThreadPriorityScanHigh);
 
     for (i = 0; i < NUM_CALLBACK_PRIORITIES; i++) {
+        cbQueueSet *mySet = &callbackQueue[i];
         epicsThreadId tid;
-
-        callbackQueue[i].semWakeUp = epicsEventMustCreate(epicsEventEmpty);
-        callbackQueue[i].queue = epicsRingPointerLockedCreate(callbackQueueSize);
-        if (callbackQueue[i].queue == 0)
-            cantProceed("epicsRingPointerLockedCreate failed for %s\n",
-                threadNamePrefix[i]);
-        callbackQueue[i].queueOverflow = FALSE;
-        if (callbackQueue[i].threadsConfigured == 0)
-            callbackQueue[i].threadsConfigured = callbackThreadsDefault;
-
-        for (j = 0; j < callbackQueue[i].threadsConfigured; j++) {
-            if (callbackQueue[i].threadsConfigured > 1 )
+        int size;
+
+        mySet->semWakeUp = epicsEventMustCreate(epicsEventEmpty);
+        mySet->semSpace = epicsEventMustCreate(epicsEventEmpty);
+        mySet->growLock = epicsMutexMustCreate();
+        mySet->queueOverflow = FALSE;
+        if (mySet->threadsConfigured == 0)
+            mySet->threadsConfigured = callbackThreadsDefault;
+
+        mySet->numQueues = 1;
+        if (callbackWorkerQueues && mySet->threadsConfigured > 1)
+            mySet->numQueues = mySet->threadsConfigured;
+        size = (callbackQueueSize + mySet->numQueues - 1) / mySet->numQueues;
+        mySet->queues = callocMustSucceed(mySet->numQueues, sizeof(cbQueue),
+            "callbackInit");
+        for (j = 0; j < mySet->numQueues; j++)
+            cbQueueInit(&mySet->queues[j], size, threadNamePrefix[i]);
+        mySet->numUsed = mySet->maxUsed = 0;
+
+        mySet->workers = callocMustSucceed(mySet->threadsConfigured,
+            sizeof(cbWorker), "callbackInit");
+
+        for (j = 0; j < mySet->threadsConfigured; j++) {
+            mySet->workers[j].set = mySet;
+            mySet->workers[j].index = j;
+            mySet->workers[j].statLock = epicsSpinMustCreate();
+            if (mySet->threadsConfigured > 1 )
                 sprintf(threadName, "%s-%d", threadNamePrefix[i], j);
             else
                 strcpy(threadName, threadNamePrefix[i]);
             tid = epicsThreadCreate(threadName, threadPriority[i],
                 epicsThreadGetStackSize(epicsThreadStackBig),
-                (EPICSTHREADFUNC)callbackTask, &priorityValue[i]);
+                (EPICSTHREADFUNC)callbackTask, &mySet->workers[j]);
             if (tid == 0) {
                 cantProceed("Failed to spawn callback thread %s\n", threadName);
             } else {
@@ -321,7 +899,10 @@ void callbackInit(void)
 int callbackRequest(epicsCallback *pcallback)
 {
     int priority;
+    int policy;
     int pushOK;
+    int isr = epicsInterruptIsInterruptContext();
+    epicsUInt64 now;
     cbQueueSet *mySet;
 
     if (!pcallback) {
@@ -334,14 +915,44 @@ int callbackRequest(epicsCallback *pcallback)
         return S_db_badChoice;
     }
     mySet = &callbackQueue[priority];
-    if (mySet->queueOverflow) return S_db_bufFull;
+    policy = epicsAtomicGetIntT(&callbackQueuePolicy);
+    if (mySet->queueOverflow && policy == queueFullDrop) {
+        cbCountDrop(pcallback);
+        return S_db_bufFull;
+    }
 
-    pushOK = epicsRingPointerPush(mySet->queue, pcallback);
+    /* No wait time is measured for requests from an interrupt */
+    now = isr ? 0 : epicsMonotonicGet();
+    while (!(pushOK = cbQueuePush(mySet, pcallback, now))) {
+        /* The push only fails outside an interrupt once the queue
+         * has grown to the limit, so that's when the scan is done.
+         */
+        if (policy == queueFullCoalesce && !isr) {
+            if (cbQueueFindAny(mySet, pcallback)) {
+                epicsAtomicIncrIntT(&mySet->queueCoalesced);
+                return 0;
+            }
+        }
+        else if (policy == queueFullBlock && !isr &&
+                 !epicsAtomicGetIntT(&mySet->shutdown) &&
+                 !isCallbackThread()) {
+            /* Callback threads must not wait on a queue they may
+             * have to empty themselves.
+             */
+            epicsAtomicIncrIntT(&mySet->numBlocked);
+            epicsEventSignal(mySet->semWakeUp);
+            epicsEventWaitWithTimeout(mySet->semSpace, 1.0);
+            epicsAtomicDecrIntT(&mySet->numBlocked);
+            continue;
+        }
+        break;
+    }
 
     if (!pushOK) {
         epicsInterruptContextMessage(fullMessage[priority]);
         mySet->queueOverflow = TRUE;
         epicsAtomicIncrIntT(&mySet->queueOverflows);
+        cbCountDrop(pcallback);
         return S_db_bufFull;
     }
     epicsEventSignal(mySet->semWakeUp);
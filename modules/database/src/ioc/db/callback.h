@@ -58,6 +58,24 @@ typedef struct callbackQueueStats {
     int numOverflow[NUM_CALLBACK_PRIORITIES];
 } callbackQueueStats;
 
+/* More statistics, kept apart so callbackQueueStats doesn't change */
+typedef struct callbackQueueExtStats {
+    double meanWait[NUM_CALLBACK_PRIORITIES]; /* seconds spent queued */
+    double maxWait[NUM_CALLBACK_PRIORITIES];
+    int numCoalesced[NUM_CALLBACK_PRIORITIES];
+    int numGrowths[NUM_CALLBACK_PRIORITIES];
+    int limit;
+} callbackQueueExtStats;
+
+/* What to do with a request when a queue is full and may not grow */
+typedef enum {
+    queueFullDrop,      /* Drop the new request */
+    queueFullBlock,     /* Wait for space, except in callback threads */
+    queueFullCoalesce,  /* Drop it if the same request is already queued */
+    queueFullDropOldest /* Drop the oldest queued request without a
+                         * completion instead, scanOnce only */
+} queueFullPolicy;
+
 #define callbackSetCallback(PFUN, PCALLBACK) \
     ( (PCALLBACK)->callback = (PFUN) )
 #define callbackSetPriority(PRIORITY, PCALLBACK) \
@@ -83,10 +101,16 @@ epicsShareFunc void callbackCancelDelayed(epicsCallback *pcallback);
 epicsShareFunc void callbackRequestProcessCallbackDelayed(
     epicsCallback *pCallback, int Priority, void *pRec, double seconds);
 epicsShareFunc int callbackSetQueueSize(int size);
+epicsShareFunc int callbackSetQueueLimit(int limit, const char *policy);
+epicsShareFunc int callbackParseQueuePolicy(const char *policy);
 epicsShareFunc int callbackQueueStatus(const int reset, callbackQueueStats *result);
+epicsShareFunc int callbackQueueExtStatus(callbackQueueExtStats *result);
 epicsShareFunc void callbackQueueShow(const int reset);
 epicsShareFunc int callbackParallelThreads(int count, const char *prio);
 
+/* Give each parallel callback thread its own queue */
+epicsShareExtern int callbackWorkerQueues;
+
 #ifdef __cplusplus
 }
 #endif
@@ -52,6 +52,7 @@
 #include "dbLink.h"
 #include "dbLockPvt.h"
 #include "dbNotify.h"
+#include "dbProfile.h"
 #include "dbScan.h"
 #include "dbServer.h"
 #include "dbStaticLib.h"
@@ -586,7 +587,15 @@ long dbProcess(dbCommon *precord)
         printf("%s: dbProcess of '%s'\n", context, precord->name);
 
     /* process record */
-    status = prset->process(precord);
+    if (dbProcessProfiling) {
+        dbProfileFrame frame;
+
+        dbProfileEnter(precord, &frame);
+        status = prset->process(precord);
+        dbProfileLeave(precord, &frame);
+    }
+    else
+        status = prset->process(precord);
 
     /* Print record's fields if PRINT_MASK set in breakpoint field */
     if (lset_stack_count != 0) {
@@ -594,6 +603,8 @@ long dbProcess(dbCommon *precord)
     }
 
 all_done:
+    /* a scan request which didn't reach process() isn't timed */
+    dbRec2Pvt(precord)->profRequested = 0;
     if (set_trace)
         *ptrace = 0;
     if (callNotifyCompletion && precord->ppn)
@@ -882,9 +893,9 @@ long dbGetField(DBADDR *paddr,short dbrType,
     dbCommon *precord = paddr->precord;
     long status = 0;
 
-    dbScanLock(precord);
+    dbScanLockRead(precord);
     status = dbGet(paddr, dbrType, pbuffer, options, nRequest, pflin);
-    dbScanUnlock(precord);
+    dbScanUnlockRead(precord);
     return status;
 }
 
@@ -893,6 +904,7 @@ long dbGet(DBADDR *paddr, short dbrType,
 {
     char *pbuf = pbuffer;
     void *pfieldsave = paddr->pfield;
+    DBADDR arrayAddr;
     db_field_log *pfl = (db_field_log *)pflin;
     short field_type;
     long capacity, no_elements, offset;
@@ -909,11 +921,14 @@ long dbGet(DBADDR *paddr, short dbrType,
         no_elements = capacity = paddr->no_elements;
 
         /* Update field info from record
-         * may modify paddr->pfield
+         * may modify paddr->pfield, so use a copy which readers
+         * sharing the lock set (dbScanLockRead) can't see
          */
         if (paddr->pfldDes->special == SPC_DBADDR &&
             (prset = dbGetRset(paddr)) &&
             prset->get_array_info) {
+            arrayAddr = *paddr;
+            paddr = &arrayAddr;
             status = prset->get_array_info(paddr, &no_elements, &offset);
         } else
             offset = 0;
@@ -747,6 +747,8 @@ static void scanComplete(void *raw, dbCommon *prec)
         /* another scan is queued */
         if(scanOnceCallback(prec, scanComplete, raw)) {
             errlogPrintf("dbCa.c failed to re-queue scanOnce\n");
+            /* let the next update queue a scan again */
+            pca->scanningOnce = 0;
         } else
             caLinkInc(pca);
     }
@@ -759,6 +761,8 @@ static void scanLinkOnce(dbCommon *prec, caLink *pca) {
     if(pca->scanningOnce==0) {
         if(scanOnceCallback(prec, scanComplete, pca)) {
             errlogPrintf("dbCa.c failed to queue scanOnce\n");
+            /* no completion will come to count down */
+            return;
         } else
             caLinkInc(pca);
     }
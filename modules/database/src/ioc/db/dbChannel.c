@@ -667,9 +667,9 @@ long dbChannelGetField(dbChannel *chan, short dbrType, void *pbuffer,
     dbCommon *precord = chan->addr.precord;
     long status = 0;
 
-    dbScanLock(precord);
+    dbScanLockRead(precord);
     status = dbChannelGet(chan, dbrType, pbuffer, options, nRequest, pfl);
-    dbScanUnlock(precord);
+    dbScanUnlockRead(precord);
     return status;
 }
 
@@ -60,6 +60,7 @@ typedef struct dbChannel {
     ELLLIST filters;          /* list of filters as created from JSON */
     ELLLIST pre_chain;        /* list of filters to be called pre-event-queue */
     ELLLIST post_chain;       /* list of filters to be called post-event-queue */
+    double min_interval;      /* seconds between monitor updates, 0 for all */
 } dbChannel;
 
 /* Prototype for the channel event function that is called in filter stacks
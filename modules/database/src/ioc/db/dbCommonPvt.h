@@ -6,6 +6,7 @@
 #include "dbCommon.h"
 
 struct epicsThreadOSD;
+struct dbProcessProfile;
 
 /** Base internal additional information for every record
  */
@@ -15,6 +16,28 @@ typedef struct dbCommonPvt {
     /* Thread which is currently processing this record */
     struct epicsThreadOSD* procThread;
 
+    /* Processing requests dropped from full queues, use atomic */
+    int dropCount;
+
+    /* Set while a coalescing scanOnce() request is queued, use atomic */
+    int oncePending;
+    /* Completions chained onto that request, guarded by the scanOnce
+     * queue lock
+     */
+    struct onceWaiter *onceWaiters;
+
+    /* scanOnce() requests without a completion callback queued for
+     * this record, use atomic
+     */
+    int onceQueued;
+
+    /* Processing profile, allocated when first timed, see dbProfile.c */
+    struct dbProcessProfile *prof;
+    /* When the pending scan request was made, 0 if none */
+    epicsUInt64 profRequested;
+    /* Enabled subscriptions to PTIM, use atomic */
+    int ptimMonitors;
+
     struct dbCommon common;
 } dbCommonPvt;
 
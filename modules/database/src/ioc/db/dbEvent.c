@@ -25,12 +25,16 @@
 #include <errno.h>
 #include <limits.h>
 
+#define EPICS_PRIVATE_API
+
 #include "cantProceed.h"
 #include "dbDefs.h"
 #include "epicsAssert.h"
+#include "epicsAtomic.h"
 #include "epicsEvent.h"
 #include "epicsMutex.h"
 #include "epicsThread.h"
+#include "epicsTime.h"
 #include "errlog.h"
 #include "freeList.h"
 #include "taskwd.h"
@@ -43,12 +47,16 @@
 #include "dbBase.h"
 #include "dbChannel.h"
 #include "dbCommon.h"
+#include "dbCommonPvt.h"
 #include "dbEvent.h"
+#include "dbExtractArray.h"
 #include "db_field_log.h"
 #include "dbFldTypes.h"
+#include "dbLatency.h"
 #include "dbLock.h"
 #include "link.h"
 #include "special.h"
+#include "epicsExport.h"
 
 /* Queue size based on Ethernet MTU of 1500 bytes.
  * Assume <=66 bytes of ethernet+IP+TCP overhead
@@ -59,24 +67,77 @@
 #define EVENTSPERQUE    36
 #define EVENTENTRIES    4      /* the number of que entries for each event */
 #define EVENTQUESIZE    (EVENTENTRIES  * EVENTSPERQUE)
+#define EVENTQMAXSIZE   32768  /* ring indices are unsigned short */
 #define EVENTQEMPTY     ((struct evSubscrip *)NULL)
 
+/* Number of consecutive passes of the event task over a queue which
+ * stayed below a quarter full before the queue is shrunk again.
+ */
+#define EVENTQIDLEPASSES 100
+
+/* Updates held back by a subscription's minimum interval wait on a
+ * wheel of slots, one for each tick, which the event task expires.
+ */
+#define EVENTWHEELSLOTS 64u
+#define EVENTWHEELTICK  10000000u   /* ns */
+
+/* Defaults for new event users, see db_event_set_queue_size() */
+int dbEventQueueEntries = EVENTENTRIES;
+epicsExportAddress(int,dbEventQueueEntries);
+int dbEventQueueMaxSize = 8 * EVENTQUESIZE;
+epicsExportAddress(int,dbEventQueueMaxSize);
+
+/* Share one copy of an array between its subscriptions, see
+ * snapshot_wanted()
+ */
+int dbEventArraySnapshots = 0;
+epicsExportAddress(int,dbEventArraySnapshots);
+
 /*
  * really a ring buffer
+ *
+ * The ring starts with EVENTQUESIZE entries, or entriesPerSub entries
+ * for each subscription if that is more. The event task doubles it
+ * when updates had to be discarded because it was full, up to maxSize,
+ * and halves it again after it has stayed mostly empty for a while.
  */
 struct event_que {
     /* lock writers to the ring buffer only */
     /* readers must never slow up writers */
     epicsMutexId            writelock;
-    db_field_log            *valque[EVENTQUESIZE];
-    struct evSubscrip       *evque[EVENTQUESIZE];
+    db_field_log            **valque;
+    struct evSubscrip       **evque;
     struct event_que        *nextque;       /* in case que quota exceeded */
     struct event_user       *evUser;        /* event user parent struct */
     unsigned short          putix;
     unsigned short          getix;
+    unsigned short          size;           /* the number of ring entries */
     unsigned short          quota;          /* the number of assigned entries*/
     unsigned short          nDuplicates;    /* N events duplicated on this q */
     unsigned short          nCanceled;      /* the number of canceled entries */
+    unsigned short          maxDepth;       /* high water mark */
+    unsigned short          windowDepth;    /* high water mark since last pass */
+    unsigned short          idlePasses;     /* passes spent below size/4 */
+    unsigned long           nReplaced;      /* replaced in flow control mode,
+                                             * or a newer array snapshot */
+    unsigned long           nDropped;       /* replaced as the ring was full */
+    unsigned long           nDroppedSeen;   /* nDropped at the last pass */
+    unsigned long           nCoalesced;     /* held updates replaced */
+    unsigned                nGrowths;
+    unsigned                nShrinks;
+    unsigned                nHeld;          /* updates on the wheel */
+    epicsUInt64             wheelTick;      /* the next tick to expire */
+    ELLLIST                 wheel[EVENTWHEELSLOTS];
+};
+
+/*
+ * an event taken off the queue for batch delivery
+ */
+struct event_batch {
+    struct evSubscrip   *pevent;
+    db_field_log        *pfl;
+    EVENTFUNC           *user_sub;
+    int                 canceled;       /* by the batch function itself */
 };
 
 struct event_user {
@@ -96,6 +157,18 @@ struct event_user {
     unsigned char       extra_labor;    /* if set call extra labor func */
     unsigned char       flowCtrlMode;   /* replace existing monitor */
     unsigned char       extraLaborBusy;
+    unsigned            entriesPerSub;  /* que entries for each event */
+    unsigned            maxSize;        /* largest ring size */
+    int                 nHeld;          /* on the wheels of all queues */
+
+    EVENTBATCHFUNC      *batch_sub;     /* deliver events in batches */
+    void                *batch_arg;     /* parameter to above */
+    struct event_batch  *batch;         /* batch being delivered */
+    dbEventBatchEntry   *batchEntries;  /* passed to batch_sub */
+    unsigned            batchMax;
+    unsigned            batchCount;     /* non-zero while delivering */
+    unsigned long       nBatches;
+    unsigned long       nBatched;       /* events delivered in batches */
     void                (*init_func)();
     epicsThreadId       init_func_arg;
 };
@@ -106,8 +179,8 @@ struct event_user {
  * into only 10 or 20 total steps part of the time.
  */
 
-#define RNGINC(OLD)\
-( (unsigned short) ( (OLD) >= (EVENTQUESIZE-1) ? 0 : (OLD)+1 ) )
+#define RNGINC(EV_QUE, OLD)\
+( (unsigned short) ( (OLD) >= ((EV_QUE)->size-1) ? 0 : (OLD)+1 ) )
 
 #define LOCKEVQUE(EV_QUE)   epicsMutexMustLock((EV_QUE)->writelock)
 #define UNLOCKEVQUE(EV_QUE) epicsMutexUnlock((EV_QUE)->writelock)
@@ -121,8 +194,120 @@ static void *dbevFieldLogFreeList;
 
 static char *EVENT_PEND_NAME = "eventTask";
 
+/*
+ * A subscription with the state of its minimum interval hold, which
+ * only this file uses.  db_add_event() allocates these.
+ */
+typedef struct evSubscripPvt {
+    struct evSubscrip       ev;
+    ELLNODE                 heldNode;   /* on the wheel while pHeld is set */
+    db_field_log            *pHeld;     /* latest update, not yet queued */
+    epicsUInt64             minInterval;/* ns between queued updates */
+    epicsUInt64             lastQueued; /* epicsMonotonicGet() */
+    epicsUInt64             dueTime;    /* when pHeld gets queued */
+    unsigned                heldSlot;
+} evSubscripPvt;
+
+#define EVPVT(PEVENT) CONTAINER ( PEVENT, evSubscripPvt, ev )
+
 static struct evSubscrip canceledEvent;
 
+/*
+ * An immutable copy of an array field, taken once for each
+ * db_post_events() call and shared by the reference type field logs of
+ * all subscriptions to that field. The last log to be deleted frees it.
+ */
+struct event_snapshot {
+    int                 refs;
+    void                *pfield;        /* channel field, identifies it */
+    short               field_type;
+    short               field_size;
+    long                no_elements;
+    double              data[1];        /* the array elements follow */
+};
+
+static struct event_snapshot * snapshot_create ( struct dbChannel *chan )
+{
+    struct event_snapshot *psnap;
+    DBADDR addr = chan->addr;   /* get_array_info() may change pfield */
+    long capacity = addr.no_elements;
+    long no_elements = capacity;
+    long offset = 0;
+    short field_size = addr.field_size;
+    rset *prset = dbGetRset ( &addr );
+
+    if ( prset && prset->get_array_info ) {
+        prset->get_array_info ( &addr, &no_elements, &offset );
+    }
+    if ( no_elements > capacity ) {
+        no_elements = capacity;
+    }
+    if ( addr.field_type == DBF_STRING && field_size > MAX_STRING_SIZE ) {
+        field_size = MAX_STRING_SIZE;
+    }
+
+    psnap = malloc ( offsetof ( struct event_snapshot, data ) +
+        ( no_elements ? no_elements * field_size : sizeof ( psnap->data ) ) );
+    if ( ! psnap ) {
+        return NULL;
+    }
+    psnap->refs = 1;
+    psnap->pfield = dbChannelField ( chan );
+    psnap->field_type = addr.field_type;
+    psnap->field_size = field_size;
+    psnap->no_elements = no_elements;
+    if ( no_elements ) {
+        dbExtractArrayFromRec ( &addr, psnap->data, no_elements, capacity,
+            offset, 1 );
+    }
+    return psnap;
+}
+
+/*
+ * Array values are copied only when another subscription to the
+ * same field will share the copy, as otherwise the copy would be
+ * made in addition to the one by the subscriber.
+ */
+static int snapshot_field ( const struct evSubscrip *pevent )
+{
+    struct dbChannel *chan = pevent->chan;
+
+    return ! pevent->useValque &&
+        dbChannelSpecial ( chan ) == SPC_DBADDR &&
+        dbChannelElements ( chan ) > 1 &&
+        dbChannelFieldType ( chan ) <= DBF_ENUM;
+}
+
+static int snapshot_wanted ( const struct evSubscrip *pevent,
+    unsigned caEventMask )
+{
+    const struct evSubscrip *pnext;
+
+    if ( ! snapshot_field ( pevent ) ) {
+        return FALSE;
+    }
+    for ( pnext = (const struct evSubscrip *) pevent->node.next;
+        pnext; pnext = (const struct evSubscrip *) pnext->node.next ) {
+        if ( dbChannelField ( pnext->chan ) == dbChannelField ( pevent->chan ) &&
+            ( caEventMask & pnext->select ) && snapshot_field ( pnext ) ) {
+            return TRUE;
+        }
+    }
+    return FALSE;
+}
+
+static void snapshot_release ( struct event_snapshot *psnap )
+{
+    if ( psnap && epicsAtomicDecrIntT ( &psnap->refs ) == 0 ) {
+        free ( psnap );
+    }
+}
+
+static void snapshot_log_free ( db_field_log *pfl )
+{
+    snapshot_release ( (struct event_snapshot *) pfl->u.r.pvt );
+}
+
 static unsigned short ringSpace ( const struct event_que *pevq )
 {
     if ( pevq->evque[pevq->putix] == EVENTQEMPTY ) {
@@ -130,12 +315,39 @@ static unsigned short ringSpace ( const struct event_que *pevq )
             return ( unsigned short ) ( pevq->getix - pevq->putix );
         }
         else {
-            return ( unsigned short ) ( ( EVENTQUESIZE + pevq->getix ) - pevq->putix );
+            return ( unsigned short ) ( ( pevq->size + pevq->getix ) - pevq->putix );
         }
     }
     return 0;
 }
 
+/*
+ * ring_alloc ()
+ */
+static int ring_alloc ( struct event_que *ev_que, unsigned size )
+{
+    ev_que->evque = calloc ( size, sizeof ( *ev_que->evque ) );
+    ev_que->valque = calloc ( size, sizeof ( *ev_que->valque ) );
+    if ( ! ev_que->evque || ! ev_que->valque ) {
+        free ( ev_que->evque );
+        free ( ev_que->valque );
+        ev_que->evque = NULL;
+        ev_que->valque = NULL;
+        return FALSE;
+    }
+    ev_que->size = ( unsigned short ) size;
+    ev_que->putix = ev_que->getix = 0;
+    return TRUE;
+}
+
+static void ring_free ( struct event_que *ev_que )
+{
+    free ( ev_que->evque );
+    free ( ev_que->valque );
+    ev_que->evque = NULL;
+    ev_que->valque = NULL;
+}
+
 /*
  *  db_event_list ()
  */
@@ -193,16 +405,18 @@ int dbel ( const char *pname, unsigned level )
 
             if ( level > 1 ) {
                 unsigned nEntriesFree;
+                unsigned queSize;
                 const void * taskId;
                 LOCKEVQUE(pevent->ev_que);
                 nEntriesFree = ringSpace ( pevent->ev_que );
+                queSize = pevent->ev_que->size;
                 taskId = ( void * ) pevent->ev_que->evUser->taskid;
                 UNLOCKEVQUE(pevent->ev_que);
                 if ( nEntriesFree == 0u ) {
                     printf ( ", thread=%p, queue full",
                         (void *) taskId );
                 }
-                else if ( nEntriesFree == EVENTQUESIZE ) {
+                else if ( nEntriesFree == queSize ) {
                     printf ( ", thread=%p, queue empty",
                         (void *) taskId );
                 }
@@ -210,11 +424,14 @@ int dbel ( const char *pname, unsigned level )
                     printf ( ", thread=%p, unused entries=%u",
                         (void *) taskId, nEntriesFree );
                 }
+                printf ( ", queue size=%u", queSize );
             }
 
             if ( level > 2 ) {
                 unsigned nDuplicates;
                 unsigned nCanceled;
+                unsigned maxDepth;
+                unsigned long nReplaced, nDropped;
                 if ( pevent->nreplace ) {
                     printf (", discarded by replacement=%ld", pevent->nreplace);
                 }
@@ -224,7 +441,17 @@ int dbel ( const char *pname, unsigned level )
                 LOCKEVQUE(pevent->ev_que);
                 nDuplicates = pevent->ev_que->nDuplicates;
                 nCanceled = pevent->ev_que->nCanceled;
+                maxDepth = pevent->ev_que->maxDepth;
+                nReplaced = pevent->ev_que->nReplaced;
+                nDropped = pevent->ev_que->nDropped;
                 UNLOCKEVQUE(pevent->ev_que);
+                printf ( ", queue max depth=%u", maxDepth );
+                if ( nReplaced ) {
+                    printf ( ", queue replaced=%lu", nReplaced );
+                }
+                if ( nDropped ) {
+                    printf ( ", queue dropped=%lu", nDropped );
+                }
                 if  ( nDuplicates ) {
                     printf (", duplicate count =%u\n", nDuplicates );
                 }
@@ -271,7 +498,7 @@ void db_init_event_freelists (void)
     }
     if (!dbevEventSubscriptionFreeList) {
         freeListInitPvt(&dbevEventSubscriptionFreeList,
-            sizeof(struct evSubscrip),256);
+            sizeof(evSubscripPvt),256);
     }
     if (!dbevFieldLogFreeList) {
         freeListInitPvt(&dbevFieldLogFreeList,
@@ -301,6 +528,8 @@ dbEventCtx db_init_events (void)
     }
 
     evUser->firstque.evUser = evUser;
+    if (!ring_alloc(&evUser->firstque, EVENTQUESIZE))
+        goto fail;
     evUser->firstque.writelock = epicsMutexCreate();
     if (!evUser->firstque.writelock)
         goto fail;
@@ -315,6 +544,12 @@ dbEventCtx db_init_events (void)
     if (!evUser->lock)
         goto fail;
 
+    evUser->entriesPerSub = EVENTENTRIES;
+    evUser->maxSize = EVENTQUESIZE;
+    db_event_set_queue_size ( evUser,
+        dbEventQueueEntries > 0 ? dbEventQueueEntries : 0,
+        dbEventQueueMaxSize > 0 ? dbEventQueueMaxSize : 0 );
+
     evUser->flowCtrlMode = FALSE;
     evUser->extraLaborBusy = FALSE;
     evUser->pSuicideEvent = NULL;
@@ -328,10 +563,109 @@ fail:
         epicsEventDestroy (evUser->ppendsem);
     if(evUser->pflush_sem)
         epicsEventDestroy (evUser->pflush_sem);
+    ring_free(&evUser->firstque);
     freeListFree(dbevEventUserFreeList,evUser);
     return NULL;
 }
 
+/*
+ * DB_EVENT_SET_QUEUE_SIZE()
+ *
+ * Set the number of queue entries reserved for each subscription, and
+ * the size that the queues may grow to when updates are being lost.
+ * A zero argument leaves that setting alone. May be called at any
+ * time, the event task applies the new sizes on its next pass.
+ */
+void db_event_set_queue_size ( dbEventCtx ctx, unsigned entriesPerSub,
+    unsigned maxSize )
+{
+    struct event_user * const evUser = (struct event_user *) ctx;
+
+    epicsMutexMustLock ( evUser->lock );
+    if ( entriesPerSub ) {
+        if ( entriesPerSub > EVENTQMAXSIZE ) {
+            entriesPerSub = EVENTQMAXSIZE;
+        }
+        evUser->entriesPerSub = entriesPerSub;
+    }
+    if ( maxSize ) {
+        if ( maxSize < EVENTQUESIZE ) {
+            maxSize = EVENTQUESIZE;
+        }
+        else if ( maxSize > EVENTQMAXSIZE ) {
+            maxSize = EVENTQMAXSIZE;
+        }
+        evUser->maxSize = maxSize;
+    }
+    epicsMutexUnlock ( evUser->lock );
+    if ( evUser->taskid ) {
+        epicsEventSignal ( evUser->ppendsem );
+    }
+}
+
+/*
+ * DB_EVENT_QUEUE_STATUS()
+ *
+ * Sum the statistics of all event queues of this event user
+ */
+int db_event_queue_status ( dbEventCtx ctx, dbEventQueueStats *pstats )
+{
+    struct event_user * const evUser = (struct event_user *) ctx;
+    struct event_que * ev_que;
+
+    if ( ! pstats ) {
+        return DB_EVENT_ERROR;
+    }
+    memset ( pstats, 0, sizeof ( *pstats ) );
+
+    epicsMutexMustLock ( evUser->lock );
+    pstats->entriesPerSub = evUser->entriesPerSub;
+    pstats->maxSize = evUser->maxSize;
+    pstats->nBatches = evUser->nBatches;
+    pstats->nBatched = evUser->nBatched;
+    for ( ev_que = &evUser->firstque; ev_que; ev_que = ev_que->nextque ) {
+        LOCKEVQUE ( ev_que );
+        pstats->nQueues++;
+        pstats->size += ev_que->size;
+        pstats->depth += ev_que->size - ringSpace ( ev_que );
+        pstats->maxDepth += ev_que->maxDepth;
+        pstats->nReplaced += ev_que->nReplaced;
+        pstats->nDropped += ev_que->nDropped;
+        pstats->nGrowths += ev_que->nGrowths;
+        pstats->nShrinks += ev_que->nShrinks;
+        UNLOCKEVQUE ( ev_que );
+    }
+    epicsMutexUnlock ( evUser->lock );
+    return DB_EVENT_OK;
+}
+
+/*
+ * DB_EVENT_HOLD_STATUS()
+ *
+ * Sum the minimum interval statistics of all event queues of this
+ * event user
+ */
+int db_event_hold_status ( dbEventCtx ctx, dbEventHoldStats *pstats )
+{
+    struct event_user * const evUser = (struct event_user *) ctx;
+    struct event_que * ev_que;
+
+    if ( ! pstats ) {
+        return DB_EVENT_ERROR;
+    }
+    memset ( pstats, 0, sizeof ( *pstats ) );
+
+    epicsMutexMustLock ( evUser->lock );
+    for ( ev_que = &evUser->firstque; ev_que; ev_que = ev_que->nextque ) {
+        LOCKEVQUE ( ev_que );
+        pstats->nHeld += ev_que->nHeld;
+        pstats->nCoalesced += ev_que->nCoalesced;
+        UNLOCKEVQUE ( ev_que );
+    }
+    epicsMutexUnlock ( evUser->lock );
+    return DB_EVENT_OK;
+}
+
 
 epicsShareFunc void db_cleanup_events(void)
 {
@@ -380,6 +714,62 @@ void db_close_events (dbEventCtx ctx)
     /* evUser has been deleted by the worker */
 }
 
+/*
+ * The ring always has a free entry for each subscription on it which
+ * has nothing queued, as its first update must never be lost. These
+ * are kept back from subscriptions which already have one queued.
+ */
+static unsigned ringReserve ( const struct event_que *ev_que )
+{
+    unsigned reserve = ev_que->quota / EVENTENTRIES + 1u;
+
+    return reserve > EVENTSPERQUE ? reserve : EVENTSPERQUE;
+}
+
+/* the smallest ring which keeps the reserve for the current quota */
+static unsigned ringMinSize ( const struct event_que *ev_que )
+{
+    unsigned size = ev_que->quota + ev_que->nCanceled + EVENTENTRIES;
+
+    return size > EVENTQUESIZE ? size : EVENTQUESIZE;
+}
+
+static void event_que_resize ( struct event_que *ev_que, unsigned size );
+
+/*
+ * EVENT_QUE_ADMIT()
+ * event queue lock _must_ be applied
+ *
+ * Take one more subscription if the ring can make room for it without
+ * growing beyond maxSize. The ring is grown at once when needed, the
+ * event task would only do so after updates had been lost.
+ */
+static int event_que_admit ( struct event_que *ev_que, unsigned maxSize )
+{
+    unsigned size = ev_que->size;
+
+    if ( ev_que->quota + ev_que->nCanceled + EVENTENTRIES >= maxSize ) {
+        return FALSE;
+    }
+    ev_que->quota += EVENTENTRIES;
+    if ( size < ringMinSize ( ev_que ) ) {
+        while ( size < ringMinSize ( ev_que ) ) {
+            size *= 2;
+        }
+        if ( size > maxSize ) {
+            size = maxSize;
+        }
+        event_que_resize ( ev_que, size );
+        if ( ev_que->size < ringMinSize ( ev_que ) ) {
+            /* no memory */
+            ev_que->quota -= EVENTENTRIES;
+            return FALSE;
+        }
+        ev_que->nGrowths++;
+    }
+    return TRUE;
+}
+
 /*
  * create_ev_que()
  */
@@ -390,8 +780,13 @@ static struct event_que * create_ev_que ( struct event_user * const evUser )
     if ( ! ev_que ) {
         return NULL;
     }
+    if ( ! ring_alloc ( ev_que, EVENTQUESIZE ) ) {
+        freeListFree ( dbevEventQueueFreeList, ev_que );
+        return NULL;
+    }
     ev_que->writelock = epicsMutexCreate();
     if ( ! ev_que->writelock ) {
+        ring_free ( ev_que );
         freeListFree ( dbevEventQueueFreeList, ev_que );
         return NULL;
     }
@@ -399,6 +794,17 @@ static struct event_que * create_ev_que ( struct event_user * const evUser )
     return ev_que;
 }
 
+static epicsUInt64 interval_ns ( double seconds )
+{
+    if ( ! ( seconds > 0.0 ) ) {
+        return 0u;
+    }
+    if ( seconds > 1e6 ) {
+        seconds = 1e6;
+    }
+    return (epicsUInt64) ( seconds * 1e9 );
+}
+
 /*
  * DB_ADD_EVENT()
  */
@@ -429,11 +835,7 @@ dbEventSubscription db_add_event (
     while ( TRUE ) {
         int success = 0;
         LOCKEVQUE ( ev_que );
-        success = ( ev_que->quota + ev_que->nCanceled <
-                                EVENTQUESIZE - EVENTENTRIES );
-        if ( success ) {
-            ev_que->quota += EVENTENTRIES;
-        }
+        success = event_que_admit ( ev_que, evUser->maxSize );
         UNLOCKEVQUE ( ev_que );
         if ( success ) {
             break;
@@ -464,6 +866,9 @@ dbEventSubscription db_add_event (
     pevent->callBackInProgress = FALSE;
     pevent->enabled =   FALSE;
     pevent->ev_que =    ev_que;
+    EVPVT ( pevent )->pHeld = NULL;
+    EVPVT ( pevent )->minInterval = interval_ns ( chan->min_interval );
+    EVPVT ( pevent )->lastQueued = 0u;
 
     /*
      * Simple types values queued up for reliable interprocess
@@ -494,6 +899,9 @@ void db_event_enable (dbEventSubscription event)
     if ( ! pevent->enabled ) {
         ellAdd (&precord->mlis, &pevent->node);
         pevent->enabled = TRUE;
+        /* PTIM is only posted while monitored, see dbProfileLeave() */
+        if ( dbChannelField(pevent->chan) == (void *) &precord->ptim )
+            epicsAtomicIncrIntT ( &dbRec2Pvt(precord)->ptimMonitors );
     }
     UNLOCKREC (precord);
 }
@@ -510,10 +918,80 @@ void db_event_disable (dbEventSubscription event)
     if ( pevent->enabled ) {
         ellDelete(&precord->mlis, &pevent->node);
         pevent->enabled = FALSE;
+        if ( dbChannelField(pevent->chan) == (void *) &precord->ptim )
+            epicsAtomicDecrIntT ( &dbRec2Pvt(precord)->ptimMonitors );
     }
     UNLOCKREC (precord);
 }
 
+/*
+ *  EVENT_HOLD()
+ *  event queue lock _must_ be applied
+ *
+ *  Keep pLog back until the subscription's minimum interval has passed,
+ *  replacing an update held already. Returns TRUE if the event task must
+ *  be woken to start expiring the wheel.
+ */
+static int event_hold ( struct event_que *ev_que, evSubscrip *pevent,
+    db_field_log *pLog )
+{
+    evSubscripPvt * const ppvt = EVPVT ( pevent );
+    epicsUInt64 tick;
+
+    if ( ppvt->pHeld ) {
+        db_delete_field_log(ppvt->pHeld);
+        ppvt->pHeld = pLog;
+        pevent->nreplace++;
+        ev_que->nCoalesced++;
+        return FALSE;
+    }
+
+    ppvt->pHeld = pLog;
+    ppvt->dueTime = ppvt->lastQueued + ppvt->minInterval;
+    tick = ( ppvt->dueTime + EVENTWHEELTICK - 1u ) / EVENTWHEELTICK;
+    if ( tick < ev_que->wheelTick ) {
+        tick = ev_que->wheelTick;
+    }
+    ppvt->heldSlot = (unsigned) ( tick % EVENTWHEELSLOTS );
+    ellAdd ( &ev_que->wheel[ppvt->heldSlot], &ppvt->heldNode );
+    ev_que->nHeld++;
+    return epicsAtomicIncrIntT ( &ev_que->evUser->nHeld ) == 1;
+}
+
+/*
+ *  EVENT_UNHOLD()
+ *  event queue lock _must_ be applied
+ *
+ *  Take the held update of a subscription off the wheel
+ */
+static db_field_log * event_unhold ( struct event_que *ev_que,
+    evSubscrip *pevent )
+{
+    evSubscripPvt * const ppvt = EVPVT ( pevent );
+    db_field_log *pLog = ppvt->pHeld;
+
+    ellDelete ( &ev_que->wheel[ppvt->heldSlot], &ppvt->heldNode );
+    ppvt->pHeld = NULL;
+    ev_que->nHeld--;
+    epicsAtomicDecrIntT ( &ev_que->evUser->nHeld );
+    return pLog;
+}
+
+/*
+ * DB_EVENT_MIN_INTERVAL()
+ *
+ * Queue at most one update for this subscription in each interval, the
+ * latest, or every update for 0. Applies from the next update posted.
+ */
+void db_event_min_interval (dbEventSubscription event, double seconds)
+{
+    struct evSubscrip * const pevent = (struct evSubscrip *) event;
+
+    LOCKEVQUE (pevent->ev_que);
+    EVPVT ( pevent )->minInterval = interval_ns ( seconds );
+    UNLOCKEVQUE (pevent->ev_que);
+}
+
 /*
  * event_remove()
  * event queue lock _must_ be applied
@@ -548,6 +1026,7 @@ void db_cancel_event (dbEventSubscription event)
 {
     struct evSubscrip * const pevent = (struct evSubscrip *) event;
     unsigned short getix;
+    int deferFree = FALSE;
 
     db_event_disable ( event );
 
@@ -561,6 +1040,10 @@ void db_cancel_event (dbEventSubscription event)
 
     pevent->user_sub = NULL;
 
+    if ( EVPVT ( pevent )->pHeld ) {
+        db_delete_field_log ( event_unhold ( pevent->ev_que, pevent ) );
+    }
+
     /*
      * purge this event from the queue
      *
@@ -578,7 +1061,7 @@ void db_cancel_event (dbEventSubscription event)
             pevent->ev_que->nCanceled++;
             event_remove ( pevent->ev_que, getix, &canceledEvent );
         }
-        getix = RNGINC ( getix );
+        getix = RNGINC ( pevent->ev_que, getix );
         if ( getix == pevent->ev_que->getix ) {
             break;
         }
@@ -586,7 +1069,22 @@ void db_cancel_event (dbEventSubscription event)
     assert ( pevent->npend == 0u );
 
     if ( pevent->ev_que->evUser->taskid == epicsThreadGetIdSelf() ) {
-        pevent->ev_que->evUser->pSuicideEvent = pevent;
+        struct event_user * const evUser = pevent->ev_que->evUser;
+
+        if ( evUser->batchCount ) {
+            /* canceled by the batch function, free it after the batch */
+            unsigned i;
+
+            for ( i = 0; i < evUser->batchCount; i++ ) {
+                if ( evUser->batch[i].pevent == pevent ) {
+                    evUser->batch[i].canceled = TRUE;
+                    deferFree = TRUE;
+                }
+            }
+        }
+        else {
+            evUser->pSuicideEvent = pevent;
+        }
     }
     else {
         while ( pevent->callBackInProgress ) {
@@ -600,7 +1098,9 @@ void db_cancel_event (dbEventSubscription event)
 
     UNLOCKEVQUE (pevent->ev_que);
 
-    freeListFree ( dbevEventSubscriptionFreeList, pevent );
+    if ( ! deferFree ) {
+        freeListFree ( dbevEventSubscriptionFreeList, pevent );
+    }
 
     return;
 }
@@ -643,6 +1143,52 @@ int db_add_extra_labor_event (
     return DB_EVENT_OK;
 }
 
+/*
+ * DB_ADD_EVENT_BATCH()
+ *
+ * Have the event task hand events to func in batches of up to
+ * maxBatch, instead of calling each subscription's own callback.
+ * Must be called before db_start_events().
+ */
+int db_add_event_batch (
+    dbEventCtx ctx, EVENTBATCHFUNC *func, void *arg, unsigned maxBatch)
+{
+    struct event_user * const evUser = (struct event_user *) ctx;
+    struct event_batch *batch = NULL;
+    dbEventBatchEntry *batchEntries = NULL;
+
+    if ( func ) {
+        if ( maxBatch == 0 ) {
+            return DB_EVENT_ERROR;
+        }
+        batch = calloc ( maxBatch, sizeof ( *batch ) );
+        batchEntries = calloc ( maxBatch, sizeof ( *batchEntries ) );
+        if ( ! batch || ! batchEntries ) {
+            free ( batch );
+            free ( batchEntries );
+            return DB_EVENT_ERROR;
+        }
+    }
+
+    epicsMutexMustLock ( evUser->lock );
+    if ( evUser->taskid ) {
+        epicsMutexUnlock ( evUser->lock );
+        free ( batch );
+        free ( batchEntries );
+        return DB_EVENT_ERROR;
+    }
+    free ( evUser->batch );
+    free ( evUser->batchEntries );
+    evUser->batch_sub = func;
+    evUser->batch_arg = arg;
+    evUser->batch = batch;
+    evUser->batchEntries = batchEntries;
+    evUser->batchMax = func ? maxBatch : 0;
+    epicsMutexUnlock ( evUser->lock );
+
+    return DB_EVENT_OK;
+}
+
 /*
  *  DB_POST_EXTRA_LABOR()
  */
@@ -669,20 +1215,46 @@ int db_post_extra_labor (dbEventCtx ctx)
 }
 
 /*
- *  DB_CREATE_EVENT_LOG()
+ *  CREATE_EVENT_LOG()
  *
- *  NOTE: This assumes that the db scan lock is already applied
- *        (as it copies data from the record)
+ *  Array subscriptions share the snapshot in *ppSnap, which is replaced
+ *  when it is of a different field. The caller releases the last one.
+ *  Without ppSnap the field log holds no array data.
  */
-db_field_log* db_create_event_log (struct evSubscrip *pevent)
+static db_field_log* create_event_log (struct evSubscrip *pevent,
+    struct event_snapshot **ppSnap, unsigned caEventMask)
 {
     db_field_log *pLog = (db_field_log *) freeListCalloc(dbevFieldLogFreeList);
 
     if (pLog) {
         struct dbChannel *chan = pevent->chan;
         struct dbCommon  *prec = dbChannelRecord(chan);
+        struct event_snapshot *psnap = NULL;
+
         pLog->ctx = dbfl_context_event;
-        if (pevent->useValque) {
+        if (ppSnap && snapshot_field(pevent)) {
+            psnap = *ppSnap;
+            if (!psnap || psnap->pfield != dbChannelField(chan) ||
+                psnap->field_type != dbChannelFieldType(chan)) {
+                snapshot_release(psnap);
+                psnap = *ppSnap = NULL;
+                if (snapshot_wanted(pevent, caEventMask))
+                    psnap = *ppSnap = snapshot_create(chan);
+            }
+        }
+        if (psnap) {
+            epicsAtomicIncrIntT(&psnap->refs);
+            pLog->type = dbfl_type_ref;
+            pLog->stat = prec->stat;
+            pLog->sevr = prec->sevr;
+            pLog->time = prec->time;
+            pLog->field_type  = psnap->field_type;
+            pLog->field_size  = psnap->field_size;
+            pLog->no_elements = psnap->no_elements;
+            pLog->u.r.dtor = snapshot_log_free;
+            pLog->u.r.pvt = psnap;
+            pLog->u.r.field = psnap->data;
+        } else if (pevent->useValque) {
             pLog->type = dbfl_type_val;
             pLog->stat = prec->stat;
             pLog->sevr = prec->sevr;
@@ -704,6 +1276,29 @@ db_field_log* db_create_event_log (struct evSubscrip *pevent)
     return pLog;
 }
 
+/*
+ *  DB_CREATE_EVENT_LOG()
+ *
+ *  NOTE: This assumes that the db scan lock is already applied
+ *        (as it copies data from the record)
+ */
+db_field_log* db_create_event_log (struct evSubscrip *pevent)
+{
+    return create_event_log(pevent, NULL, 0);
+}
+
+/*
+ *  DB_FIELD_LOG_IS_SNAPSHOT()
+ *
+ *  The field of a snapshot log is never written, and belongs to the
+ *  snapshot rather than to u.r.field, so it may be offset or shortened.
+ */
+int db_field_log_is_snapshot (const struct db_field_log *pfl)
+{
+    return pfl && pfl->type == dbfl_type_ref &&
+        pfl->u.r.dtor == snapshot_log_free;
+}
+
 /*
  *  DB_CREATE_READ_LOG()
  *
@@ -720,23 +1315,17 @@ db_field_log* db_create_read_log (struct dbChannel *chan)
 }
 
 /*
- *  DB_QUEUE_EVENT_LOG()
+ *  EVENT_ENQUEUE()
+ *  event queue lock _must_ be applied
  *
+ *  Returns TRUE if the ring was empty and the event task must be woken
  */
-static void db_queue_event_log (evSubscrip *pevent, db_field_log *pLog)
+static int event_enqueue ( struct event_que *ev_que, evSubscrip *pevent,
+    db_field_log *pLog )
 {
-    struct event_que    *ev_que;
     int firstEventFlag;
     unsigned rngSpace;
 
-    ev_que = pevent->ev_que;
-    /*
-     * evUser ring buffer must be locked for the multiple
-     * threads writing/reading it
-     */
-
-    LOCKEVQUE (ev_que);
-
     /*
      * if we have an event on the queue and both the last
      * event on the queue and the current event are emtpy
@@ -747,8 +1336,21 @@ static void db_queue_event_log (evSubscrip *pevent, db_field_log *pLog)
         (*pevent->pLastLog)->type == dbfl_type_rec &&
         pLog->type == dbfl_type_rec) {
         db_delete_field_log(pLog);
-        UNLOCKEVQUE (ev_que);
-        return;
+        return FALSE;
+    }
+
+    /*
+     * likewise keep only the latest array snapshot, as an empty
+     * event would have delivered the latest value of the array
+     */
+    if (pevent->npend > 0u &&
+        db_field_log_is_snapshot(*pevent->pLastLog) &&
+        db_field_log_is_snapshot(pLog)) {
+        db_delete_field_log(*pevent->pLastLog);
+        *pevent->pLastLog = pLog;
+        pevent->nreplace++;
+        ev_que->nReplaced++;
+        return FALSE;
     }
 
     /*
@@ -762,7 +1364,7 @@ static void db_queue_event_log (evSubscrip *pevent, db_field_log *pLog)
      */
     rngSpace = ringSpace ( ev_que );
     if ( pevent->npend>0u &&
-        (ev_que->evUser->flowCtrlMode || rngSpace<=EVENTSPERQUE) ) {
+        (ev_que->evUser->flowCtrlMode || rngSpace<=ringReserve(ev_que)) ) {
         /*
          * replace last event if no space is left
          */
@@ -771,6 +1373,10 @@ static void db_queue_event_log (evSubscrip *pevent, db_field_log *pLog)
             *pevent->pLastLog = pLog;
         }
         pevent->nreplace++;
+        if (ev_que->evUser->flowCtrlMode)
+            ev_que->nReplaced++;
+        else
+            ev_que->nDropped++;
         /*
          * the event task has already been notified about
          * this so we dont need to post the semaphore
@@ -794,13 +1400,56 @@ static void db_queue_event_log (evSubscrip *pevent, db_field_log *pLog)
          * if the ring buffer was empty before
          * adding this event
          */
-        if (rngSpace==EVENTQUESIZE) {
+        if (rngSpace==ev_que->size) {
             firstEventFlag = 1;
         }
         else {
             firstEventFlag = 0;
         }
-        ev_que->putix = RNGINC ( ev_que->putix );
+        if (ev_que->size - rngSpace + 1 > ev_que->maxDepth)
+            ev_que->maxDepth = ev_que->size - rngSpace + 1;
+        if (ev_que->size - rngSpace + 1 > ev_que->windowDepth)
+            ev_que->windowDepth = ev_que->size - rngSpace + 1;
+        ev_que->putix = RNGINC ( ev_que, ev_que->putix );
+    }
+
+    return firstEventFlag;
+}
+
+/*
+ *  DB_QUEUE_EVENT_LOG()
+ *
+ */
+static void db_queue_event_log (evSubscrip *pevent, db_field_log *pLog)
+{
+    struct event_que * const ev_que = pevent->ev_que;
+    evSubscripPvt * const ppvt = EVPVT ( pevent );
+    int wakeup = FALSE;
+
+    /*
+     * evUser ring buffer must be locked for the multiple
+     * threads writing/reading it
+     */
+    LOCKEVQUE (ev_que);
+
+    /*
+     * an update arriving sooner than the minimum interval after the
+     * last one queued waits on the wheel, behind any update held already
+     */
+    if ( ppvt->minInterval || ppvt->pHeld ) {
+        epicsUInt64 now = epicsMonotonicGet ();
+
+        if ( ppvt->pHeld ||
+                now - ppvt->lastQueued < ppvt->minInterval ) {
+            wakeup = event_hold ( ev_que, pevent, pLog );
+            pLog = NULL;
+        }
+        else {
+            ppvt->lastQueued = now;
+        }
+    }
+    if ( pLog ) {
+        wakeup = event_enqueue ( ev_que, pevent, pLog );
     }
 
     UNLOCKEVQUE (ev_que);
@@ -811,7 +1460,7 @@ static void db_queue_event_log (evSubscrip *pevent, db_field_log *pLog)
      * is off in case it runs at a higher priority
      * than the caller here.
      */
-    if (firstEventFlag) {
+    if (wakeup) {
         /*
          * notify the event handler
          */
@@ -833,9 +1482,15 @@ unsigned int    caEventMask
 {
     struct dbCommon   * const prec = (struct dbCommon *) pRecord;
     struct evSubscrip *pevent;
+    struct event_snapshot *psnap = NULL;
+    epicsUInt64 posted = 0;
+    int nposted = 0;
 
     if (prec->mlis.count == 0) return DB_EVENT_OK;       /* no monitors set */
 
+    if (dbLatencyTracing)
+        posted = epicsMonotonicGet();
+
     LOCKREC (prec);
 
     for (pevent = (struct evSubscrip *) prec->mlis.node.next;
@@ -847,13 +1502,21 @@ unsigned int    caEventMask
          */
         if ( (dbChannelField(pevent->chan) == (void *)pField || pField==NULL) &&
             (caEventMask & pevent->select)) {
-            db_field_log *pLog = db_create_event_log(pevent);
+            db_field_log *pLog = create_event_log(pevent,
+                dbEventArraySnapshots ? &psnap : NULL, caEventMask);
             pLog = dbChannelRunPreChain(pevent->chan, pLog);
-            if (pLog) db_queue_event_log(pevent, pLog);
+            if (pLog) {
+                pLog->postTime = posted;
+                db_queue_event_log(pevent, pLog);
+                nposted++;
+            }
         }
     }
 
     UNLOCKREC (prec);
+    snapshot_release(psnap);
+    if (posted && nposted)
+        dbLatencySample(dbLatPost, posted, epicsMonotonicGet());
     return DB_EVENT_OK;
 
 }
@@ -871,11 +1534,190 @@ void db_post_single_event (dbEventSubscription event)
 
     pLog = db_create_event_log(pevent);
     pLog = dbChannelRunPreChain(pevent->chan, pLog);
-    if(pLog) db_queue_event_log(pevent, pLog);
+    if(pLog) {
+        epicsUInt64 posted = dbLatencyTracing ? epicsMonotonicGet() : 0;
+
+        pLog->postTime = posted;
+        db_queue_event_log(pevent, pLog);
+        if (posted)
+            dbLatencySample(dbLatPost, posted, epicsMonotonicGet());
+    }
 
     dbScanUnlock (prec);
 }
 
+/*
+ * EVENT_QUE_RESIZE()
+ * event queue lock _must_ be applied
+ *
+ * Move the queued entries to a ring of a different size. Both
+ * event_que_admit() and the event task's event_que_adapt() do this,
+ * always under ev_que->writelock, which is held by everyone who looks
+ * at the ring, so the old ring can be freed here.
+ */
+static void event_que_resize ( struct event_que *ev_que, unsigned size )
+{
+    struct event_que old = *ev_que;
+    unsigned short getix;
+    unsigned short n = 0;
+
+    if ( ! ring_alloc ( ev_que, size ) ) {
+        /* keep going with the old ring */
+        ev_que->evque = old.evque;
+        ev_que->valque = old.valque;
+        return;
+    }
+
+    for ( getix = old.getix; old.evque[getix] != EVENTQEMPTY; ) {
+        struct evSubscrip *pevent = old.evque[getix];
+
+        ev_que->evque[n] = pevent;
+        ev_que->valque[n] = old.valque[getix];
+        if ( pevent != &canceledEvent &&
+                pevent->pLastLog == &old.valque[getix] ) {
+            pevent->pLastLog = &ev_que->valque[n];
+        }
+        n++;
+        getix = RNGINC ( &old, getix );
+        if ( getix == old.getix ) {
+            break;
+        }
+    }
+    ev_que->putix = n;
+    ring_free ( &old );
+}
+
+/*
+ * EVENT_QUE_ADAPT()
+ * event queue lock _must_ be applied
+ *
+ * Grow the ring if updates were discarded for lack of space since the
+ * last pass, shrink it once it has stayed mostly empty for a while.
+ */
+static void event_que_adapt ( struct event_que *ev_que,
+    unsigned entriesPerSub, unsigned maxSize )
+{
+    unsigned nSubs = ev_que->quota / EVENTENTRIES;
+    unsigned minSize = nSubs * entriesPerSub;
+    unsigned depth = ev_que->size - ringSpace ( ev_que );
+    unsigned size = ev_que->size;
+
+    if ( minSize > maxSize ) {
+        minSize = maxSize;
+    }
+    /* even if maxSize was lowered after the subscriptions were made */
+    if ( minSize < ringMinSize ( ev_que ) ) {
+        minSize = ringMinSize ( ev_que );
+    }
+    if ( maxSize < minSize ) {
+        maxSize = minSize;
+    }
+
+    if ( size > maxSize ) {
+        size = maxSize;
+    }
+    else if ( ev_que->nDropped != ev_que->nDroppedSeen && size < maxSize ) {
+        size *= 2;
+        if ( size > maxSize ) {
+            size = maxSize;
+        }
+    }
+    else if ( size < minSize ) {
+        size = minSize;
+    }
+    else if ( size > minSize && ev_que->windowDepth < size / 4 ) {
+        if ( ++ev_que->idlePasses >= EVENTQIDLEPASSES ) {
+            size /= 2;
+            if ( size < minSize ) {
+                size = minSize;
+            }
+        }
+    }
+    else {
+        ev_que->idlePasses = 0;
+    }
+    ev_que->nDroppedSeen = ev_que->nDropped;
+    ev_que->windowDepth = ( unsigned short ) depth;
+
+    /* A shrunk ring must still leave room for one entry per event */
+    if ( size != ev_que->size && size >= depth + ringReserve ( ev_que ) ) {
+        if ( size > ev_que->size ) {
+            ev_que->nGrowths++;
+        }
+        else {
+            ev_que->nShrinks++;
+        }
+        ev_que->idlePasses = 0;
+        event_que_resize ( ev_que, size );
+    }
+}
+
+/*
+ * EVENT_SKIP_CANCELED()
+ * event queue lock _must_ be applied
+ *
+ * remove the place holder of a canceled event at the head of the queue
+ */
+static void event_skip_canceled ( struct event_que *ev_que )
+{
+    ev_que->evque[ev_que->getix] = EVENTQEMPTY;
+    if (ev_que->valque[ev_que->getix]) {
+        db_delete_field_log(ev_que->valque[ev_que->getix]);
+        ev_que->valque[ev_que->getix] = NULL;
+    }
+    ev_que->getix = RNGINC ( ev_que, ev_que->getix );
+    assert ( ev_que->nCanceled > 0 );
+    ev_que->nCanceled--;
+}
+
+/*
+ * EVENT_EXPIRE()
+ *
+ * Queue the held updates which are due
+ */
+static void event_expire ( struct event_que *ev_que )
+{
+    epicsUInt64 now, nowTick;
+    unsigned i, n;
+
+    LOCKEVQUE (ev_que);
+    if ( ev_que->nHeld == 0u ) {
+        UNLOCKEVQUE (ev_que);
+        return;
+    }
+
+    now = epicsMonotonicGet ();
+    nowTick = now / EVENTWHEELTICK;
+    if ( nowTick >= ev_que->wheelTick + EVENTWHEELSLOTS ) {
+        n = EVENTWHEELSLOTS;
+    }
+    else {
+        n = (unsigned) ( nowTick + 1u - ev_que->wheelTick );
+    }
+
+    for ( i = 0u; i < n; i++ ) {
+        ELLLIST *pslot = &ev_que->wheel[
+            ( ev_que->wheelTick + i ) % EVENTWHEELSLOTS];
+        ELLNODE *pnode = ellFirst ( pslot );
+
+        while ( pnode ) {
+            evSubscripPvt *ppvt = CONTAINER ( pnode, evSubscripPvt, heldNode );
+
+            /* a later turn of the wheel if not due yet */
+            pnode = ellNext ( pnode );
+            if ( ppvt->dueTime <= now ) {
+                db_field_log *pLog = event_unhold ( ev_que, &ppvt->ev );
+
+                ppvt->lastQueued = now;
+                event_enqueue ( ev_que, &ppvt->ev, pLog );
+            }
+        }
+    }
+    ev_que->wheelTick = nowTick + 1u;
+
+    UNLOCKEVQUE (ev_que);
+}
+
 /*
  * EVENT_READ()
  */
@@ -906,14 +1748,7 @@ static int event_read ( struct event_que *ev_que )
 
         pfl = ev_que->valque[ev_que->getix];
         if ( pevent == &canceledEvent ) {
-            ev_que->evque[ev_que->getix] = EVENTQEMPTY;
-            if (ev_que->valque[ev_que->getix]) {
-                db_delete_field_log(ev_que->valque[ev_que->getix]);
-                ev_que->valque[ev_que->getix] = NULL;
-            }
-            ev_que->getix = RNGINC ( ev_que->getix );
-            assert ( ev_que->nCanceled > 0 );
-            ev_que->nCanceled--;
+            event_skip_canceled ( ev_que );
             continue;
         }
 
@@ -924,7 +1759,7 @@ static int event_read ( struct event_que *ev_que )
          */
 
         event_remove ( ev_que, ev_que->getix, EVENTQEMPTY );
-        ev_que->getix = RNGINC ( ev_que->getix );
+        ev_que->getix = RNGINC ( ev_que, ev_que->getix );
 
         /*
          * create a local copy of the call back parameters while
@@ -943,6 +1778,10 @@ static int event_read ( struct event_que *ev_que )
          * for the event queue lock (which this thread now has).
          */
         if ( user_sub ) {
+            /* event_que_admit() may replace the ring once unlocked */
+            int eventsRemaining =
+                ev_que->evque[ev_que->getix] != EVENTQEMPTY;
+
             /*
              * This provides a way to test to see if an event is in use
              * despite the fact that the event queue does not point to
@@ -950,6 +1789,10 @@ static int event_read ( struct event_que *ev_que )
              */
             pevent->callBackInProgress = TRUE;
             UNLOCKEVQUE (ev_que);
+            if (pfl && pfl->postTime) {
+                dbLatencySample(dbLatQueue, pfl->postTime,
+                    epicsMonotonicGet());
+            }
             /* Run post-event-queue filter chain */
             if (ellCount(&pevent->chan->post_chain)) {
                 pfl = dbChannelRunPostChain(pevent->chan, pfl);
@@ -957,7 +1800,7 @@ static int event_read ( struct event_que *ev_que )
             if (pfl) {
                 /* Issue user callback */
                 ( *user_sub ) ( pevent->user_arg, pevent->chan,
-                                ev_que->evque[ev_que->getix] != EVENTQEMPTY, pfl );
+                                eventsRemaining, pfl );
             }
             LOCKEVQUE (ev_que);
 
@@ -989,6 +1832,137 @@ static int event_read ( struct event_que *ev_que )
     return DB_EVENT_OK;
 }
 
+/*
+ * EVENT_READ_BATCH()
+ *
+ * Like event_read(), but takes up to batchMax events off the queue
+ * at a time and hands them to the batch function in one call.
+ */
+static int event_read_batch ( struct event_que *ev_que )
+{
+    struct event_user * const evUser = ev_que->evUser;
+    struct event_batch * const batch = evUser->batch;
+
+    LOCKEVQUE (ev_que);
+
+    if ( evUser->flowCtrlMode && ev_que->nDuplicates == 0u ) {
+        UNLOCKEVQUE (ev_que);
+        return DB_EVENT_OK;
+    }
+
+    while ( ev_que->evque[ev_que->getix] != EVENTQEMPTY ) {
+        unsigned i, n = 0, nEntries = 0;
+        int eventsRemaining;
+        epicsUInt64 dequeued = 0;
+
+        /*
+         * A second update for an event already in the batch ends it,
+         * so each subscription still sees its updates in order
+         */
+        while ( n < evUser->batchMax &&
+                ev_que->evque[ev_que->getix] != EVENTQEMPTY ) {
+            struct evSubscrip *pevent = ev_que->evque[ev_que->getix];
+            db_field_log *pfl = ev_que->valque[ev_que->getix];
+
+            if ( pevent == &canceledEvent ) {
+                event_skip_canceled ( ev_que );
+                continue;
+            }
+            if ( pevent->callBackInProgress ) {
+                break;
+            }
+            event_remove ( ev_que, ev_que->getix, EVENTQEMPTY );
+            ev_que->getix = RNGINC ( ev_que, ev_que->getix );
+            if ( ! pevent->user_sub ) {
+                db_delete_field_log(pfl);
+                continue;
+            }
+            pevent->callBackInProgress = TRUE;
+            batch[n].pevent = pevent;
+            batch[n].pfl = pfl;
+            batch[n].user_sub = pevent->user_sub;
+            batch[n].canceled = FALSE;
+            n++;
+        }
+        if ( n == 0 ) {
+            continue;
+        }
+        eventsRemaining = ev_que->evque[ev_que->getix] != EVENTQEMPTY;
+        evUser->batchCount = n;
+        UNLOCKEVQUE (ev_que);
+
+        for ( i = 0; i < n; i++ ) {
+            struct evSubscrip *pevent = batch[i].pevent;
+
+            if ( batch[i].pfl && batch[i].pfl->postTime ) {
+                if ( ! dequeued ) {
+                    dequeued = epicsMonotonicGet ();
+                }
+                dbLatencySample ( dbLatQueue, batch[i].pfl->postTime,
+                    dequeued );
+            }
+
+            /* Run post-event-queue filter chain */
+            if (ellCount(&pevent->chan->post_chain)) {
+                batch[i].pfl = dbChannelRunPostChain(pevent->chan,
+                    batch[i].pfl);
+            }
+            if ( batch[i].pfl ) {
+                dbEventBatchEntry *pent = &evUser->batchEntries[nEntries++];
+
+                pent->user_sub = batch[i].user_sub;
+                pent->user_arg = pevent->user_arg;
+                pent->chan = pevent->chan;
+                pent->pfl = batch[i].pfl;
+            }
+        }
+        if ( nEntries ) {
+            ( *evUser->batch_sub ) ( evUser->batch_arg, evUser->batchEntries,
+                nEntries, eventsRemaining );
+        }
+
+        LOCKEVQUE (ev_que);
+        evUser->batchCount = 0;
+        evUser->nBatches++;
+        evUser->nBatched += nEntries;
+        for ( i = 0; i < n; i++ ) {
+            struct evSubscrip *pevent = batch[i].pevent;
+
+            db_delete_field_log(batch[i].pfl);
+            if ( batch[i].canceled ) {
+                freeListFree ( dbevEventSubscriptionFreeList, pevent );
+                continue;
+            }
+            pevent->callBackInProgress = FALSE;
+            if ( pevent->user_sub==NULL && pevent->npend==0u ) {
+                epicsEventSignal ( evUser->pflush_sem );
+            }
+        }
+    }
+
+    UNLOCKEVQUE (ev_que);
+
+    return DB_EVENT_OK;
+}
+
+/*
+ * EVENT_ADAPT()
+ */
+static void event_adapt ( struct event_que *ev_que )
+{
+    struct event_user * const evUser = ev_que->evUser;
+    unsigned entriesPerSub, maxSize;
+
+    epicsMutexMustLock ( evUser->lock );
+    entriesPerSub = evUser->entriesPerSub;
+    maxSize = evUser->maxSize;
+    epicsMutexUnlock ( evUser->lock );
+
+    LOCKEVQUE (ev_que);
+    event_que_adapt ( ev_que, entriesPerSub, maxSize );
+    UNLOCKEVQUE (ev_que);
+}
+
 /*
  * EVENT_TASK()
  */
@@ -1008,7 +1982,15 @@ static void event_task (void *pParm)
     do {
         void (*pExtraLaborSub) (void *);
         void *pExtraLaborArg;
-        epicsEventMustWait(evUser->ppendsem);
+
+        /* tick while updates are held back */
+        if ( epicsAtomicGetIntT ( &evUser->nHeld ) ) {
+            epicsEventWaitWithTimeout ( evUser->ppendsem,
+                EVENTWHEELTICK * 1e-9 );
+        }
+        else {
+            epicsEventMustWait(evUser->ppendsem);
+        }
 
         /*
          * check to see if the caller has offloaded
@@ -1035,7 +2017,14 @@ static void event_task (void *pParm)
         for ( ev_que = &evUser->firstque; ev_que;
                 ev_que = ev_que->nextque ) {
             epicsMutexUnlock ( evUser->lock );
-            event_read (ev_que);
+            event_expire (ev_que);
+            if ( evUser->batch_sub ) {
+                event_read_batch (ev_que);
+            }
+            else {
+                event_read (ev_que);
+            }
+            event_adapt (ev_que);
             epicsMutexMustLock ( evUser->lock );
         }
         pendexit = evUser->pendexit;
@@ -1044,6 +2033,7 @@ static void event_task (void *pParm)
     } while( ! pendexit );
 
     epicsMutexDestroy(evUser->firstque.writelock);
+    ring_free(&evUser->firstque);
 
     {
         struct event_que    *nextque;
@@ -1052,6 +2042,7 @@ static void event_task (void *pParm)
         while (ev_que) {
             nextque = ev_que->nextque;
             epicsMutexDestroy(ev_que->writelock);
+            ring_free(ev_que);
             freeListFree(dbevEventQueueFreeList, ev_que);
             ev_que = nextque;
         }
@@ -1060,6 +2051,8 @@ static void event_task (void *pParm)
     epicsEventDestroy(evUser->ppendsem);
     epicsEventDestroy(evUser->pflush_sem);
     epicsMutexDestroy(evUser->lock);
+    free(evUser->batch);
+    free(evUser->batchEntries);
 
     if (dbevEventUserFreeList)
         freeListFree(dbevEventUserFreeList, evUser);
@@ -64,14 +64,56 @@ epicsShareFunc void db_flush_extra_labor_event (dbEventCtx);
 epicsShareFunc int db_post_extra_labor (dbEventCtx ctx);
 epicsShareFunc void db_event_change_priority ( dbEventCtx ctx, unsigned epicsPriority );
 
+typedef struct dbEventQueueStats {
+    unsigned nQueues;       /* number of chained queues */
+    unsigned size;          /* total entries in all queues */
+    unsigned depth;         /* entries in use */
+    unsigned maxDepth;      /* sum of the queue high water marks */
+    unsigned long nReplaced;/* updates replaced while in flow control,
+                             * or by a newer array snapshot */
+    unsigned long nDropped; /* updates replaced because a queue was full */
+    unsigned nGrowths;
+    unsigned nShrinks;
+    unsigned entriesPerSub;
+    unsigned maxSize;
+    unsigned long nBatches; /* batches handed to the batch function */
+    unsigned long nBatched; /* events delivered in those batches */
+} dbEventQueueStats;
+
+epicsShareFunc void db_event_set_queue_size ( dbEventCtx ctx,
+    unsigned entriesPerSub, unsigned maxSize );
+epicsShareFunc int db_event_queue_status ( dbEventCtx ctx,
+    dbEventQueueStats *pstats );
+
 #ifdef EPICS_PRIVATE_API
 epicsShareFunc void db_cleanup_events(void);
 epicsShareFunc void db_init_event_freelists (void);
+
+typedef struct dbEventHoldStats {
+    unsigned nHeld;         /* updates held for a minimum interval */
+    unsigned long nCoalesced;/* held updates replaced by a newer one */
+} dbEventHoldStats;
+
+epicsShareFunc int db_event_hold_status ( dbEventCtx ctx,
+    dbEventHoldStats *pstats );
 #endif
 
 typedef void EVENTFUNC (void *user_arg, struct dbChannel *chan,
     int eventsRemaining, struct db_field_log *pfl);
 
+typedef struct dbEventBatchEntry {
+    EVENTFUNC *user_sub;    /* the subscription's own callback */
+    void *user_arg;
+    struct dbChannel *chan;
+    struct db_field_log *pfl;
+} dbEventBatchEntry;
+
+/* eventsRemaining applies to the end of the batch */
+typedef void EVENTBATCHFUNC (void *batch_arg, dbEventBatchEntry *entries,
+    unsigned count, int eventsRemaining);
+epicsShareFunc int db_add_event_batch (
+    dbEventCtx ctx, EVENTBATCHFUNC *func, void *arg, unsigned maxBatch);
+
 typedef void * dbEventSubscription;
 epicsShareFunc dbEventSubscription db_add_event (
     dbEventCtx ctx, struct dbChannel *chan,
@@ -80,10 +122,14 @@ epicsShareFunc void db_cancel_event (dbEventSubscription es);
 epicsShareFunc void db_post_single_event (dbEventSubscription es);
 epicsShareFunc void db_event_enable (dbEventSubscription es);
 epicsShareFunc void db_event_disable (dbEventSubscription es);
+epicsShareFunc void db_event_min_interval (dbEventSubscription es,
+    double seconds);
 
 epicsShareFunc struct db_field_log* db_create_event_log (struct evSubscrip *pevent);
 epicsShareFunc struct db_field_log* db_create_read_log (struct dbChannel *chan);
 epicsShareFunc void db_delete_field_log (struct db_field_log *pfl);
+epicsShareFunc int db_field_log_is_snapshot (const struct db_field_log *pfl);
+epicsShareExtern int dbEventArraySnapshots;
 epicsShareFunc int db_available_logs(void);
 
 #define DB_EVENT_OK 0
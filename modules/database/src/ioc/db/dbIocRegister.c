@@ -18,8 +18,10 @@
 #include "dbEvent.h"
 #include "dbIocRegister.h"
 #include "dbJLink.h"
+#include "dbLatency.h"
 #include "dbLock.h"
 #include "dbNotify.h"
+#include "dbProfile.h"
 #include "dbScan.h"
 #include "dbServer.h"
 #include "dbState.h"
@@ -332,6 +334,69 @@ static const iocshFuncDef dbLockShowLockedFuncDef =
 static void dbLockShowLockedCallFunc(const iocshArgBuf *args)
 { dbLockShowLocked(args[0].ival);}
 
+/* dbLockShowProfile */
+static const iocshArg dbLockShowProfileArg0 = { "count",iocshArgInt};
+static const iocshArg dbLockShowProfileArg1 = { "sort by (hold,wait,max,locks)",iocshArgString};
+static const iocshArg * const dbLockShowProfileArgs[2] =
+    {&dbLockShowProfileArg0,&dbLockShowProfileArg1};
+static const iocshFuncDef dbLockShowProfileFuncDef =
+    {"dbLockShowProfile",2,dbLockShowProfileArgs,
+     "Show the busiest Locksets, while dbLockProfiling is set.\n"};
+static void dbLockShowProfileCallFunc(const iocshArgBuf *args)
+{ dbLockShowProfile(args[0].ival,args[1].sval);}
+
+/* dbLockResetProfile */
+static const iocshFuncDef dbLockResetProfileFuncDef =
+    {"dbLockResetProfile",0,NULL,
+     "Clear the Lockset profiles.\n"};
+static void dbLockResetProfileCallFunc(const iocshArgBuf *args)
+{ dbLockResetProfile();}
+
+/* dbtop */
+static const iocshArg dbtopArg0 = { "count",iocshArgInt};
+static const iocshArg * const dbtopArgs[1] = {&dbtopArg0};
+static const iocshFuncDef dbtopFuncDef = {"dbtop",1,dbtopArgs,
+    "Show the records using the most processing time,\n"
+    "while dbProcessProfiling is set.\n"};
+static void dbtopCallFunc(const iocshArgBuf *args)
+{ dbtop(args[0].ival);}
+
+/* dbtophist */
+static const iocshArg dbtophistArg0 = { "record name",iocshArgString};
+static const iocshArg * const dbtophistArgs[1] = {&dbtophistArg0};
+static const iocshFuncDef dbtophistFuncDef = {"dbtophist",1,dbtophistArgs,
+    "Show the processing time histograms of one record.\n"};
+static void dbtophistCallFunc(const iocshArgBuf *args)
+{ dbtophist(args[0].sval);}
+
+/* dbtopReset */
+static const iocshFuncDef dbtopResetFuncDef = {"dbtopReset",0,NULL,
+    "Clear the record processing profiles.\n"};
+static void dbtopResetCallFunc(const iocshArgBuf *args)
+{ dbtopReset();}
+
+/* dbLatencyShow */
+static const iocshFuncDef dbLatencyShowFuncDef = {"dbLatencyShow",0,NULL,
+    "Show the latency percentiles of each stage of the monitor path,\n"
+    "traced while dbLatencyTracing is set.\n"};
+static void dbLatencyShowCallFunc(const iocshArgBuf *args)
+{ dbLatencyShow();}
+
+/* dbLatencyDump */
+static const iocshArg dbLatencyDumpArg0 = { "file name",iocshArgString};
+static const iocshArg * const dbLatencyDumpArgs[1] = {&dbLatencyDumpArg0};
+static const iocshFuncDef dbLatencyDumpFuncDef = {"dbLatencyDump",1,dbLatencyDumpArgs,
+    "Write the monitor path latency samples as Chrome trace event JSON,\n"
+    "which chrome://tracing and Perfetto can load.\n"};
+static void dbLatencyDumpCallFunc(const iocshArgBuf *args)
+{ dbLatencyDump(args[0].sval);}
+
+/* dbLatencyReset */
+static const iocshFuncDef dbLatencyResetFuncDef = {"dbLatencyReset",0,NULL,
+    "Discard the monitor path latency samples.\n"};
+static void dbLatencyResetCallFunc(const iocshArgBuf *args)
+{ dbLatencyReset();}
+
 /* scanOnceSetQueueSize */
 static const iocshArg scanOnceSetQueueSizeArg0 = { "size",iocshArgInt};
 static const iocshArg * const scanOnceSetQueueSizeArgs[1] =
@@ -345,6 +410,32 @@ static void scanOnceSetQueueSizeCallFunc(const iocshArgBuf *args)
     scanOnceSetQueueSize(args[0].ival);
 }
 
+/* scanOnceSetQueueLimit */
+static const iocshArg scanOnceSetQueueLimitArg0 = { "limit",iocshArgInt};
+static const iocshArg scanOnceSetQueueLimitArg1 = { "policy",iocshArgString};
+static const iocshArg * const scanOnceSetQueueLimitArgs[2] =
+    {&scanOnceSetQueueLimitArg0,&scanOnceSetQueueLimitArg1};
+static const iocshFuncDef scanOnceSetQueueLimitFuncDef =
+    {"scanOnceSetQueueLimit",2,scanOnceSetQueueLimitArgs,
+     "Allow the scan once queue to grow up to limit entries.\n"
+     "policy says what happens when the queue is full and may not grow:\n"
+     "drop (the default), block, coalesce or dropOldest.\n"};
+static void scanOnceSetQueueLimitCallFunc(const iocshArgBuf *args)
+{
+    iocshSetError(scanOnceSetQueueLimit(args[0].ival, args[1].sval));
+}
+
+/* scanDropShow */
+static const iocshArg scanDropShowArg0 = { "reset",iocshArgInt};
+static const iocshArg * const scanDropShowArgs[1] = {&scanDropShowArg0};
+static const iocshFuncDef scanDropShowFuncDef =
+    {"scanDropShow",1,scanDropShowArgs,
+     "Show records with processing requests dropped from full queues.\n"};
+static void scanDropShowCallFunc(const iocshArgBuf *args)
+{
+    scanDropShow(args[0].ival);
+}
+
 /* scanOnceQueueShow */
 static const iocshArg scanOnceQueueShowArg0 = { "reset",iocshArgInt};
 static const iocshArg * const scanOnceQueueShowArgs[1] =
@@ -357,6 +448,23 @@ static void scanOnceQueueShowCallFunc(const iocshArgBuf *args)
     scanOnceQueueShow(args[0].ival);
 }
 
+/* scanPeriodicWorkers */
+static const iocshArg scanPeriodicWorkersArg0 = { "no of threads", iocshArgInt};
+static const iocshArg scanPeriodicWorkersArg1 = { "rate", iocshArgString};
+static const iocshArg * const scanPeriodicWorkersArgs[2] =
+    {&scanPeriodicWorkersArg0,&scanPeriodicWorkersArg1};
+static const iocshFuncDef scanPeriodicWorkersFuncDef =
+    {"scanPeriodicWorkers",2,scanPeriodicWorkersArgs,
+     "Split a periodic scan list between multiple threads.\n"
+     "Records are divided between the threads by lock set.\n"
+     "rate may be omitted or \"*\" to act on all periodic scan rates\n"
+     "or a SCAN menu choice such as \".1 second\".\n"
+     "Must be called before iocInit().\n"};
+static void scanPeriodicWorkersCallFunc(const iocshArgBuf *args)
+{
+    scanPeriodicWorkers(args[0].ival, args[1].sval);
+}
+
 /* scanppl */
 static const iocshArg scanpplArg0 = { "rate",iocshArgDouble};
 static const iocshArg * const scanpplArgs[1] = {&scanpplArg0};
@@ -402,6 +510,21 @@ static void callbackSetQueueSizeCallFunc(const iocshArgBuf *args)
     callbackSetQueueSize(args[0].ival);
 }
 
+/* callbackSetQueueLimit */
+static const iocshArg callbackSetQueueLimitArg0 = { "limit",iocshArgInt};
+static const iocshArg callbackSetQueueLimitArg1 = { "policy",iocshArgString};
+static const iocshArg * const callbackSetQueueLimitArgs[2] =
+    {&callbackSetQueueLimitArg0,&callbackSetQueueLimitArg1};
+static const iocshFuncDef callbackSetQueueLimitFuncDef =
+    {"callbackSetQueueLimit",2,callbackSetQueueLimitArgs,
+     "Allow callback queues to grow up to limit entries.\n"
+     "policy says what happens when a queue is full and may not grow:\n"
+     "drop (the default), block or coalesce.\n"};
+static void callbackSetQueueLimitCallFunc(const iocshArgBuf *args)
+{
+    iocshSetError(callbackSetQueueLimit(args[0].ival, args[1].sval));
+}
+
 /* callbackQueueShow */
 static const iocshArg callbackQueueShowArg0 = { "reset", iocshArgInt};
 static const iocshArg * const callbackQueueShowArgs[1] =
@@ -526,15 +649,27 @@ void dbIocRegister(void)
     iocshRegister(&tpnFuncDef,tpnCallFunc);
     iocshRegister(&dblsrFuncDef,dblsrCallFunc);
     iocshRegister(&dbLockShowLockedFuncDef,dbLockShowLockedCallFunc);
+    iocshRegister(&dbLockShowProfileFuncDef,dbLockShowProfileCallFunc);
+    iocshRegister(&dbLockResetProfileFuncDef,dbLockResetProfileCallFunc);
+    iocshRegister(&dbtopFuncDef,dbtopCallFunc);
+    iocshRegister(&dbtophistFuncDef,dbtophistCallFunc);
+    iocshRegister(&dbtopResetFuncDef,dbtopResetCallFunc);
+    iocshRegister(&dbLatencyShowFuncDef,dbLatencyShowCallFunc);
+    iocshRegister(&dbLatencyDumpFuncDef,dbLatencyDumpCallFunc);
+    iocshRegister(&dbLatencyResetFuncDef,dbLatencyResetCallFunc);
 
     iocshRegister(&scanOnceSetQueueSizeFuncDef,scanOnceSetQueueSizeCallFunc);
+    iocshRegister(&scanOnceSetQueueLimitFuncDef,scanOnceSetQueueLimitCallFunc);
     iocshRegister(&scanOnceQueueShowFuncDef,scanOnceQueueShowCallFunc);
+    iocshRegister(&scanDropShowFuncDef,scanDropShowCallFunc);
+    iocshRegister(&scanPeriodicWorkersFuncDef,scanPeriodicWorkersCallFunc);
     iocshRegister(&scanpplFuncDef,scanpplCallFunc);
     iocshRegister(&scanpelFuncDef,scanpelCallFunc);
     iocshRegister(&postEventFuncDef,postEventCallFunc);
     iocshRegister(&scanpiolFuncDef,scanpiolCallFunc);
 
     iocshRegister(&callbackSetQueueSizeFuncDef,callbackSetQueueSizeCallFunc);
+    iocshRegister(&callbackSetQueueLimitFuncDef,callbackSetQueueLimitCallFunc);
     iocshRegister(&callbackQueueShowFuncDef,callbackQueueShowCallFunc);
     iocshRegister(&callbackParallelThreadsFuncDef,callbackParallelThreadsCallFunc);
 
@@ -0,0 +1,339 @@
+/*************************************************************************\
+* EPICS BASE is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+
+/* Monitor path latency tracing.
+ *
+ * While dbLatencyTracing is set, db_post_events() stamps each field log
+ * it queues with epicsMonotonicGet(), and the event task and the CA
+ * server record the time an update spent in each stage after that.
+ *
+ * Each thread writes its samples to a ring of its own, so recording
+ * takes no lock.  The writer fills in a sample before it advances the
+ * head of the ring, and a reader copying the ring checks the head
+ * again afterwards to drop the samples which may have been overwritten
+ * meanwhile.  The ring of a thread which has exited is taken over by
+ * the next thread needing one.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "dbDefs.h"
+#include "ellLib.h"
+#include "epicsAtomic.h"
+#include "epicsExit.h"
+#include "epicsMutex.h"
+#include "epicsStdio.h"
+#include "epicsThread.h"
+#include "epicsTime.h"
+#include "errlog.h"
+
+#define epicsExportSharedSymbols
+#include "dbLatency.h"
+#include "epicsExport.h"
+
+int dbLatencyTracing = 0;
+epicsExportAddress(int,dbLatencyTracing);
+
+static const char * const stageNames[dbLatNStages] = {
+    "post", "queue", "serialize", "send", "total"
+};
+
+typedef struct latSample {
+    epicsUInt64 start;
+    epicsUInt64 end;
+    unsigned stage;
+    unsigned id;            /* of the ring, set when copied */
+} latSample;
+
+typedef struct latRing {
+    ELLNODE node;
+    unsigned id;
+    int inUse;              /* the owning thread is still running */
+    char name[32];
+    size_t head;            /* samples written */
+    latSample samples[DBLAT_RING_SIZE];
+} latRing;
+
+static epicsThreadOnceId latOnce = EPICS_THREAD_ONCE_INIT;
+static epicsThreadPrivateId latKey;
+static epicsMutexId latLock;
+static ELLLIST latRings = ELLLIST_INIT;
+static unsigned latNextId;
+static epicsUInt64 latResetTime;
+
+static void latInit(void *junk)
+{
+    latKey = epicsThreadPrivateCreate();
+    latLock = epicsMutexMustCreate();
+}
+
+static void latThreadExit(void *arg)
+{
+    latRing *pring = arg;
+
+    epicsMutexMustLock(latLock);
+    pring->inUse = FALSE;
+    epicsMutexUnlock(latLock);
+}
+
+static latRing * latRingGet(void)
+{
+    latRing *pring;
+
+    epicsThreadOnce(&latOnce, latInit, NULL);
+    pring = epicsThreadPrivateGet(latKey);
+    if (pring)
+        return pring;
+
+    epicsMutexMustLock(latLock);
+    for (pring = (latRing *) ellFirst(&latRings); pring;
+         pring = (latRing *) ellNext(&pring->node)) {
+        if (!pring->inUse)
+            break;
+    }
+    if (!pring) {
+        pring = calloc(1, sizeof(*pring));
+        if (pring)
+            ellAdd(&latRings, &pring->node);
+    }
+    if (pring) {
+        /* nobody writes or reads it now */
+        pring->id = ++latNextId;
+        pring->inUse = TRUE;
+        pring->head = 0;
+        strncpy(pring->name, epicsThreadGetNameSelf(), sizeof(pring->name) - 1);
+        pring->name[sizeof(pring->name) - 1] = '\0';
+    }
+    epicsMutexUnlock(latLock);
+
+    if (pring) {
+        epicsThreadPrivateSet(latKey, pring);
+        epicsAtThreadExit(latThreadExit, pring);
+    }
+    return pring;
+}
+
+void dbLatencySample(dbLatStage stage, epicsUInt64 start, epicsUInt64 end)
+{
+    latRing *pring = latRingGet();
+    latSample *psample;
+    size_t head;
+
+    if (!pring || (unsigned) stage >= dbLatNStages)
+        return;
+
+    head = pring->head;
+    psample = &pring->samples[head % DBLAT_RING_SIZE];
+    psample->start = start;
+    psample->end = end;
+    psample->stage = stage;
+    epicsAtomicWriteMemoryBarrier();
+    epicsAtomicSetSizeT(&pring->head, head + 1);
+}
+
+/* Copy the samples of one ring since the last reset, latLock held */
+static size_t latRingCopy(latRing *pring, latSample *pbuf)
+{
+    size_t head = epicsAtomicGetSizeT(&pring->head);
+    size_t first = head > DBLAT_RING_SIZE ? head - DBLAT_RING_SIZE : 0;
+    size_t valid, i, n = 0;
+
+    epicsAtomicReadMemoryBarrier();
+    for (i = first; i < head; i++)
+        pbuf[i - first] = pring->samples[i % DBLAT_RING_SIZE];
+    epicsAtomicReadMemoryBarrier();
+
+    /* the writer may have reused the oldest slots meanwhile */
+    valid = epicsAtomicGetSizeT(&pring->head) + 1;
+    valid = valid > DBLAT_RING_SIZE ? valid - DBLAT_RING_SIZE : 0;
+    if (valid < first)
+        valid = first;
+
+    for (i = valid; i < head; i++) {
+        latSample *psample = &pbuf[i - first];
+
+        if (psample->start < latResetTime)
+            continue;
+        psample->id = pring->id;
+        pbuf[n++] = *psample;
+    }
+    return n;
+}
+
+/* All samples since the last reset, latLock held */
+static latSample * latCollect(size_t *pcount)
+{
+    latRing *pring;
+    latSample *pbuf;
+    size_t n = 0;
+
+    *pcount = 0;
+    pbuf = calloc(ellCount(&latRings) + 1, sizeof(latSample) * DBLAT_RING_SIZE);
+    if (!pbuf)
+        return NULL;
+    for (pring = (latRing *) ellFirst(&latRings); pring;
+         pring = (latRing *) ellNext(&pring->node))
+        n += latRingCopy(pring, pbuf + n);
+    *pcount = n;
+    return pbuf;
+}
+
+static int u64compare(const void *rawA, const void *rawB)
+{
+    epicsUInt64 A = *(const epicsUInt64 *) rawA;
+    epicsUInt64 B = *(const epicsUInt64 *) rawB;
+
+    return A < B ? -1 : A > B;
+}
+
+static double percentile(const epicsUInt64 *sorted, size_t n, double p)
+{
+    size_t rank = (size_t) (p * n / 100.0 + 0.5);
+
+    if (rank < 1)
+        rank = 1;
+    if (rank > n)
+        rank = n;
+    return sorted[rank - 1] * 1e-3;
+}
+
+long dbLatencyShow(void)
+{
+    latSample *psamples;
+    epicsUInt64 *ptimes;
+    size_t n, i;
+    unsigned stage;
+
+    if (!dbLatencyTracing)
+        printf("Latency tracing is off, set dbLatencyTracing to 1\n");
+
+    epicsThreadOnce(&latOnce, latInit, NULL);
+    epicsMutexMustLock(latLock);
+    psamples = latCollect(&n);
+    epicsMutexUnlock(latLock);
+    ptimes = calloc(n + 1, sizeof(*ptimes));
+    if (!psamples || !ptimes) {
+        printf("Out of memory\n");
+        free(psamples);
+        free(ptimes);
+        return -1;
+    }
+
+    printf("%-10s %9s %9s %9s %9s %9s %9s\n", "Stage",
+           "Count", "p50 us", "p90 us", "p99 us", "p99.9 us", "Max us");
+    for (stage = 0; stage < dbLatNStages; stage++) {
+        size_t count = 0;
+
+        for (i = 0; i < n; i++) {
+            if (psamples[i].stage == stage)
+                ptimes[count++] = psamples[i].end - psamples[i].start;
+        }
+        if (!count)
+            continue;
+        qsort(ptimes, count, sizeof(*ptimes), &u64compare);
+        printf("%-10s %9lu %9.1f %9.1f %9.1f %9.1f %9.1f\n",
+               stageNames[stage], (unsigned long) count,
+               percentile(ptimes, count, 50.0),
+               percentile(ptimes, count, 90.0),
+               percentile(ptimes, count, 99.0),
+               percentile(ptimes, count, 99.9),
+               ptimes[count - 1] * 1e-3);
+    }
+    free(psamples);
+    free(ptimes);
+    return 0;
+}
+
+static void jsonString(FILE *fp, const char *pstr)
+{
+    fputc('"', fp);
+    for (; *pstr; pstr++) {
+        unsigned char c = (unsigned char) *pstr;
+
+        if (c == '"' || c == '\\')
+            fprintf(fp, "\\%c", c);
+        else if (c < 0x20u)
+            fprintf(fp, "\\u%04x", c);
+        else
+            fputc(c, fp);
+    }
+    fputc('"', fp);
+}
+
+/* Trace event format, as read by chrome://tracing and Perfetto.
+ * The times are epicsMonotonicGet() in us.
+ */
+static void latWrite(FILE *fp, const latSample *psamples, size_t n)
+{
+    latRing *pring;
+    const char *sep = "";
+    size_t i;
+
+    fprintf(fp, "{\"displayTimeUnit\": \"ns\",\n \"traceEvents\": [");
+    for (pring = (latRing *) ellFirst(&latRings); pring;
+         pring = (latRing *) ellNext(&pring->node)) {
+        fprintf(fp, "%s\n  {\"name\": \"thread_name\", \"ph\": \"M\", "
+                "\"pid\": 1, \"tid\": %u, \"args\": {\"name\": ",
+                sep, pring->id);
+        jsonString(fp, pring->name);
+        fprintf(fp, "}}");
+        sep = ",";
+    }
+    for (i = 0; i < n; i++) {
+        const latSample *psample = &psamples[i];
+
+        fprintf(fp, "%s\n  {\"name\": \"%s\", \"cat\": \"monitor\", "
+                "\"ph\": \"X\", \"pid\": 1, \"tid\": %u, "
+                "\"ts\": %.3f, \"dur\": %.3f}",
+                sep, stageNames[psample->stage], psample->id,
+                psample->start * 1e-3,
+                (psample->end - psample->start) * 1e-3);
+        sep = ",";
+    }
+    fprintf(fp, "\n ]\n}\n");
+}
+
+long dbLatencyDump(const char *file)
+{
+    FILE *fp = stdout;
+    latSample *psamples;
+    size_t n;
+    long status = 0;
+
+    if (file && *file) {
+        fp = fopen(file, "w");
+        if (!fp) {
+            errlogPrintf("dbLatencyDump: can't open \"%s\"\n", file);
+            return -1;
+        }
+    }
+
+    epicsThreadOnce(&latOnce, latInit, NULL);
+    epicsMutexMustLock(latLock);
+    psamples = latCollect(&n);
+    if (psamples)
+        latWrite(fp, psamples, n);
+    epicsMutexUnlock(latLock);
+
+    if (!psamples) {
+        errlogPrintf("dbLatencyDump: out of memory\n");
+        status = -1;
+    }
+    free(psamples);
+    if (fp != stdout && fclose(fp)) {
+        errlogPrintf("dbLatencyDump: error writing \"%s\"\n", file);
+        status = -1;
+    }
+    return status;
+}
+
+void dbLatencyReset(void)
+{
+    epicsThreadOnce(&latOnce, latInit, NULL);
+    epicsMutexMustLock(latLock);
+    latResetTime = epicsMonotonicGet();
+    epicsMutexUnlock(latLock);
+}
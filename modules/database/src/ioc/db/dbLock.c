@@ -18,11 +18,13 @@
 #include "ellLib.h"
 #include "epicsAssert.h"
 #include "epicsAtomic.h"
+#include "epicsEvent.h"
 #include "epicsMutex.h"
 #include "epicsPrint.h"
 #include "epicsSpin.h"
 #include "epicsStdio.h"
 #include "epicsThread.h"
+#include "epicsTime.h"
 #include "errMdef.h"
 
 #define epicsExportSharedSymbols
@@ -35,18 +37,41 @@
 #include "dbLockPvt.h"
 #include "dbStaticLib.h"
 #include "link.h"
+#include "epicsExport.h"
 
 typedef struct dbScanLockNode dbScanLockNode;
 
 static epicsThreadOnceId dbLockOnceInit = EPICS_THREAD_ONCE_INIT;
 
-static ELLLIST lockSetsActive; /* in use */
+/* The global lists of lockSets are split into shards, each with
+ * its own guard, so that creating and freeing lockSets during link
+ * changes in one part of the database doesn't stall the others.
+ * New lockSets are spread over the shards in turn.
+ */
+#define LOCKSET_NSHARDS 16
+
+typedef struct {
+    epicsMutexId guard;
+    ELLLIST active; /* in use */
 #ifndef LOCKSET_NOFREE
-static ELLLIST lockSetsFree; /* free list */
+    ELLLIST free; /* free list */
 #endif
+} lockSetShard;
+
+static lockSetShard lockSetShards[LOCKSET_NSHARDS];
+static size_t next_shard;
+
+/* Allow dbScanLockRead() callers to share a lockSet.
+ * Only read by dbLockInitRecords().
+ */
+int dbLockSharedReaders = 0;
+epicsExportAddress(int,dbLockSharedReaders);
+
+static int lockSharedReaders;
 
-/* Guard the global list */
-static epicsMutexId lockSetsGuard;
+/* Collect the contention profile of each lockSet */
+int dbLockProfiling = 0;
+epicsExportAddress(int,dbLockProfiling);
 
 #ifndef LOCKSET_NOCNT
 /* Counter which we increment whenever
@@ -60,7 +85,24 @@ static size_t recomputeCnt;
 /*private routines */
 static void dbLockOnce(void* ignore)
 {
-    lockSetsGuard = epicsMutexMustCreate();
+    unsigned i;
+    for(i=0; i<LOCKSET_NSHARDS; i++)
+        lockSetShards[i].guard = epicsMutexMustCreate();
+}
+
+/* iterate over the active lockSets of all shards, without locking */
+static lockSet* nextActiveSet(lockSet *ls)
+{
+    unsigned i = 0;
+    ELLNODE *cur = NULL;
+
+    if(ls) {
+        cur = ellNext(&ls->node);
+        i = ls->shard + 1;
+    }
+    for(; !cur && i<LOCKSET_NSHARDS; i++)
+        cur = ellFirst(&lockSetShards[i].active);
+    return (lockSet*)cur;
 }
 
 /* global ID number assigned to each lockSet on creation.
@@ -71,30 +113,47 @@ static void dbLockOnce(void* ignore)
  */
 static size_t next_id = 1;
 
+static void lockSetProfReset(lockSet *ls)
+{
+    ls->profLocks = 0;
+    ls->profWait = ls->profWaitMax = 0;
+    ls->profHold = ls->profHoldMax = 0;
+    ls->profHoldMaxId = NULL;
+    ls->profHoldMaxThread[0] = '\0';
+    epicsAtomicSetIntT(&ls->profResetPending, 0);
+}
+
 static lockSet* makeSet(void)
 {
     lockSet *ls;
     int iref;
-    epicsMutexMustLock(lockSetsGuard);
+    unsigned ishard = epicsAtomicIncrSizeT(&next_shard) % LOCKSET_NSHARDS;
+    lockSetShard *shard = &lockSetShards[ishard];
+
+    epicsMutexMustLock(shard->guard);
 #ifndef LOCKSET_NOFREE
-    ls = (lockSet*)ellGet(&lockSetsFree);
+    ls = (lockSet*)ellGet(&shard->free);
     if(!ls) {
-        epicsMutexUnlock(lockSetsGuard);
+        epicsMutexUnlock(shard->guard);
 #endif
 
         ls=dbCalloc(1,sizeof(*ls));
         ellInit(&ls->lockRecordList);
         ls->lock = epicsMutexMustCreate();
         ls->id = epicsAtomicIncrSizeT(&next_id);
+        ls->shard = ishard;
 
 #ifndef LOCKSET_NOFREE
-        epicsMutexMustLock(lockSetsGuard);
+        epicsMutexMustLock(shard->guard);
     }
 #endif
+    if(lockSharedReaders && !ls->readersDone)
+        ls->readersDone = epicsEventMustCreate(epicsEventEmpty);
+    lockSetProfReset(ls);
     /* the initial reference for the first lockRecord */
     iref = epicsAtomicIncrIntT(&ls->refcount);
-    ellAdd(&lockSetsActive, &ls->node);
-    epicsMutexUnlock(lockSetsGuard);
+    ellAdd(&shard->active, &ls->node);
+    epicsMutexUnlock(shard->guard);
 
     assert(ls->id>0);
     assert(iref>0);
@@ -110,10 +169,13 @@ unsigned long dbLockGetRefs(struct dbCommon* prec)
 
 unsigned long dbLockCountSets(void)
 {
-    unsigned long count;
-    epicsMutexMustLock(lockSetsGuard);
-    count = (unsigned long)ellCount(&lockSetsActive);
-    epicsMutexUnlock(lockSetsGuard);
+    unsigned long count = 0;
+    unsigned i;
+    for(i=0; i<LOCKSET_NSHARDS; i++) {
+        epicsMutexMustLock(lockSetShards[i].guard);
+        count += (unsigned long)ellCount(&lockSetShards[i].active);
+        epicsMutexUnlock(lockSetShards[i].guard);
+    }
     return count;
 }
 
@@ -153,16 +215,22 @@ void dbLockDecRef(lockSet *ls)
 
     epicsMutexUnlock(ls->lock);
 
-    epicsMutexMustLock(lockSetsGuard);
-    ellDelete(&lockSetsActive, &ls->node);
+    {
+        lockSetShard *shard = &lockSetShards[ls->shard];
+
+        epicsMutexMustLock(shard->guard);
+        ellDelete(&shard->active, &ls->node);
 #ifndef LOCKSET_NOFREE
-    ellAdd(&lockSetsFree, &ls->node);
+        ellAdd(&shard->free, &ls->node);
 #else
-    epicsMutexDestroy(ls->lock);
-    memset(ls, 0, sizeof(*ls)); /* paranoia */
-    free(ls);
+        epicsMutexDestroy(ls->lock);
+        if(ls->readersDone)
+            epicsEventDestroy(ls->readersDone);
+        memset(ls, 0, sizeof(*ls)); /* paranoia */
+        free(ls);
 #endif
-    epicsMutexUnlock(lockSetsGuard);
+        epicsMutexUnlock(shard->guard);
+    }
 }
 
 lockSet* dbLockGetRef(lockRecord *lr)
@@ -184,10 +252,96 @@ unsigned long dbLockGetLockId(dbCommon *precord)
     return id;
 }
 
-void dbScanLock(dbCommon *precord)
+/* Caller has locked ls->lock for exclusive use.
+ * Wait until shared holders have left, unless this thread
+ * already holds the lockSet exclusively.
+ */
+static void lockSetWriterEnter(lockSet *ls)
+{
+    epicsThreadId myself;
+
+    if(!lockSharedReaders)
+        return;
+
+    myself = epicsThreadGetIdSelf();
+    if(ls->writer!=myself) {
+        /* new readers are held off by ls->lock */
+        while(epicsAtomicGetIntT(&ls->readers)>0) {
+            epicsAtomicSetIntT(&ls->writerWaiting, 1);
+            if(epicsAtomicGetIntT(&ls->readers)>0)
+                epicsEventMustWait(ls->readersDone);
+        }
+        epicsAtomicSetIntT(&ls->writerWaiting, 0);
+        ls->writer = myself;
+    }
+    ls->writerDepth++;
+}
+
+/* Caller is about to unlock ls->lock */
+static void lockSetWriterLeave(lockSet *ls)
+{
+    if(!lockSharedReaders)
+        return;
+
+    assert(ls->writer==epicsThreadGetIdSelf());
+    assert(ls->writerDepth>0);
+    if(--ls->writerDepth==0)
+        ls->writer = NULL;
+}
+
+/* Caller has locked ls->lock, having started to wait at tstart */
+static void lockSetProfWait(lockSet *ls, epicsUInt64 tstart, epicsUInt64 now)
+{
+    epicsUInt64 wait = now - tstart;
+
+    if(epicsAtomicGetIntT(&ls->profResetPending))
+        lockSetProfReset(ls);
+    ls->profLocks++;
+    ls->profWait += wait;
+    if(wait > ls->profWaitMax)
+        ls->profWaitMax = wait;
+}
+
+/* Caller has locked ls->lock for exclusive use */
+static void lockSetProfEnter(lockSet *ls, epicsUInt64 tstart)
+{
+    epicsUInt64 now = epicsMonotonicGet();
+
+    lockSetProfWait(ls, tstart, now);
+    if(ls->profDepth++==0) {
+        ls->profHoldStart = now;
+        ls->profHolder = epicsThreadGetIdSelf();
+    }
+}
+
+/* Caller is about to unlock ls->lock.
+ * Completes a hold started while profiling, even if it has stopped.
+ */
+static void lockSetProfLeave(lockSet *ls)
+{
+    epicsUInt64 hold;
+
+    if(ls->profDepth==0 || --ls->profDepth!=0)
+        return;
+
+    if(epicsAtomicGetIntT(&ls->profResetPending))
+        lockSetProfReset(ls);
+    hold = epicsMonotonicGet() - ls->profHoldStart;
+    ls->profHold += hold;
+    if(hold > ls->profHoldMax) {
+        ls->profHoldMax = hold;
+        ls->profHoldMaxId = epicsThreadGetIdSelf();
+        strncpy(ls->profHoldMaxThread, epicsThreadGetNameSelf(),
+                sizeof(ls->profHoldMaxThread)-1);
+        ls->profHoldMaxThread[sizeof(ls->profHoldMaxThread)-1] = '\0';
+    }
+    ls->profHolder = NULL;
+}
+
+/* Lock the present lockSet of lr, returning it */
+static lockSet* lockRecordSet(lockRecord *lr)
 {
     int cnt;
-    lockRecord * const lr = precord->lset;
     lockSet *ls;
 
     assert(lr);
@@ -223,6 +377,17 @@ retry:
      */
     cnt = epicsAtomicDecrIntT(&ls->refcount);
     assert(cnt>0);
+    return ls;
+}
+
+void dbScanLock(dbCommon *precord)
+{
+    epicsUInt64 tstart = dbLockProfiling ? epicsMonotonicGet() : 0;
+    lockSet *ls = lockRecordSet(precord->lset);
+
+    lockSetWriterEnter(ls);
+    if(tstart)
+        lockSetProfEnter(ls, tstart);
 
 #ifdef LOCKSET_DEBUG
     if(ls->owner) {
@@ -248,10 +413,49 @@ void dbScanUnlock(dbCommon *precord)
     if(ls->ownercount==0)
         ls->owner = NULL;
 #endif
+    lockSetProfLeave(ls);
+    lockSetWriterLeave(ls);
     epicsMutexUnlock(ls->lock);
     dbLockDecRef(ls);
 }
 
+void dbScanLockRead(dbCommon *precord)
+{
+    epicsUInt64 tstart;
+    lockSet *ls;
+
+    if(!lockSharedReaders) {
+        dbScanLock(precord);
+        return;
+    }
+
+    /* Exclusive access is only needed to join the readers.
+     * The lockRecord can't be moved to another lockSet
+     * until we leave again.
+     */
+    tstart = dbLockProfiling ? epicsMonotonicGet() : 0;
+    ls = lockRecordSet(precord->lset);
+    if(tstart)
+        lockSetProfWait(ls, tstart, epicsMonotonicGet());
+    epicsAtomicIncrIntT(&ls->readers);
+    epicsMutexUnlock(ls->lock);
+}
+
+void dbScanUnlockRead(dbCommon *precord)
+{
+    lockSet *ls;
+
+    if(!lockSharedReaders) {
+        dbScanUnlock(precord);
+        return;
+    }
+
+    ls = precord->lset->plockSet;
+    if(epicsAtomicDecrIntT(&ls->readers)==0 &&
+       epicsAtomicGetIntT(&ls->writerWaiting))
+        epicsEventMustTrigger(ls->readersDone);
+}
+
 static
 int lrrcompare(const void *rawA, const void *rawB)
 {
@@ -388,6 +592,7 @@ void dbScanLockMany(dbLocker* locker)
 {
     size_t i, nlock = locker->maxrefs;
     lockSet *plock;
+    epicsUInt64 tstart;
 #ifdef LOCKSET_DEBUG
     const epicsThreadId myself = epicsThreadGetIdSelf();
 #endif
@@ -412,7 +617,11 @@ retry:
             continue;
         plock = ref->plockSet;
 
+        tstart = dbLockProfiling ? epicsMonotonicGet() : 0;
         epicsMutexMustLock(plock->lock);
+        lockSetWriterEnter(plock);
+        if(tstart)
+            lockSetProfEnter(plock, tstart);
         assert(plock->ownerlocker==NULL);
         plock->ownerlocker = locker;
         ellAdd(&locker->locked, &plock->lockernode);
@@ -470,6 +679,8 @@ void dbScanUnlockMany(dbLocker* locker)
             plock->owner = NULL;
 #endif
 
+        lockSetProfLeave(plock);
+        lockSetWriterLeave(plock);
         epicsMutexUnlock(plock->lock);
         /* release ref for locked list */
         dbLockDecRef(plock);
@@ -533,6 +744,8 @@ void dbLockInitRecords(dbBase *pdbbase)
 {
     epicsThreadOnce(&dbLockOnceInit, &dbLockOnce, NULL);
 
+    lockSharedReaders = dbLockSharedReaders;
+
     /* create all lockRecords and lockSets */
     forEachRecord(NULL, pdbbase, &createLockRecord);
 }
@@ -560,23 +773,28 @@ void dbLockCleanupRecords(dbBase *pdbbase)
 {
 #ifndef LOCKSET_NOFREE
     ELLNODE *cur;
+    unsigned i;
 #endif
     epicsThreadOnce(&dbLockOnceInit, &dbLockOnce, NULL);
 
     forEachRecord(NULL, pdbbase, &freeLockRecord);
-    if(ellCount(&lockSetsActive)) {
+    if(nextActiveSet(NULL)) {
         printf("Warning: dbLockCleanupRecords() leaking lockSets\n");
         dblsr(NULL,2);
     }
 
 #ifndef LOCKSET_NOFREE
-    while((cur=ellGet(&lockSetsFree))!=NULL) {
-        lockSet *ls = (lockSet*)cur;
-
-        assert(ls->refcount==0);
-        assert(ellCount(&ls->lockRecordList)==0);
-        epicsMutexDestroy(ls->lock);
-        free(ls);
+    for(i=0; i<LOCKSET_NSHARDS; i++) {
+        while((cur=ellGet(&lockSetShards[i].free))!=NULL) {
+            lockSet *ls = (lockSet*)cur;
+
+            assert(ls->refcount==0);
+            assert(ellCount(&ls->lockRecordList)==0);
+            epicsMutexDestroy(ls->lock);
+            if(ls->readersDone)
+                epicsEventDestroy(ls->readersDone);
+            free(ls);
+        }
     }
 #endif
 }
@@ -664,6 +882,8 @@ void dbLockSetMerge(dbLocker *locker, dbCommon *pfirst, dbCommon *psecond)
         B->ownerlocker = NULL;
         epicsAtomicDecrIntT(&B->refcount);
 
+        lockSetProfLeave(B);
+        lockSetWriterLeave(B);
         epicsMutexUnlock(B->lock);
     }
 
@@ -805,6 +1025,9 @@ void dbLockSetSplit(dbLocker *locker, dbCommon *pfirst, dbCommon *psecond)
         splitset = makeSet(); /* reference for locker->locked */
 
         epicsMutexMustLock(splitset->lock);
+        lockSetWriterEnter(splitset);
+        if(dbLockProfiling)
+            lockSetProfEnter(splitset, epicsMonotonicGet());
 
         assert(splitset->ownerlocker==NULL);
         ellAdd(&locker->locked, &splitset->lockernode);
@@ -909,11 +1132,13 @@ long dblsr(char *recordname,int level)
         if (!plockRecord) return 0; /* before iocInit */
         plockSet = plockRecord->plockSet;
     } else {
-        plockSet = (lockSet *)ellFirst(&lockSetsActive);
+        plockSet = nextActiveSet(NULL);
     }
-    for( ; plockSet; plockSet = (lockSet *)ellNext(&plockSet->node)) {
+    for( ; plockSet; plockSet = nextActiveSet(plockSet)) {
         printf("Lock Set %lu %d members %d refs epicsMutexId %p\n",
             plockSet->id,ellCount(&plockSet->lockRecordList),plockSet->refcount,plockSet->lock);
+        if(lockSharedReaders && level>0)
+            printf("    %d readers\n", epicsAtomicGetIntT(&plockSet->readers));
 
         if(level==0) { if(recordname) break; continue; }
         for(plockRecord = (lockRecord *)ellFirst(&plockSet->lockRecordList);
@@ -951,15 +1176,23 @@ long dbLockShowLocked(int level)
 {
     int     indListType;
     lockSet *plockSet;
+    int     nActive = 0, nFree = 0;
+    unsigned i;
 
-    printf("Active lockSets: %d\n", ellCount(&lockSetsActive));
+    for(i=0; i<LOCKSET_NSHARDS; i++) {
+        nActive += ellCount(&lockSetShards[i].active);
+#ifndef LOCKSET_NOFREE
+        nFree += ellCount(&lockSetShards[i].free);
+#endif
+    }
+    printf("Active lockSets: %d\n", nActive);
 #ifndef LOCKSET_NOFREE
-    printf("Free lockSets: %d\n", ellCount(&lockSetsFree));
+    printf("Free lockSets: %d\n", nFree);
 #endif
 
     /*Even if failure on lockSetModifyLock will continue */
     for(indListType=0; indListType <= 1; ++indListType) {
-        plockSet = (lockSet *)ellFirst(&lockSetsActive);
+        plockSet = nextActiveSet(NULL);
         if(plockSet) {
             if (indListType==0)
                 printf("listTypeScanLock\n");
@@ -975,12 +1208,127 @@ long dbLockShowLocked(int level)
 
                 epicsMutexShow(plockSet->lock,level);
             }
-            plockSet = (lockSet *)ellNext(&plockSet->node);
+            plockSet = nextActiveSet(plockSet);
+        }
+    }
+    return 0;
+}
+
+typedef struct {
+    lockSet *ls;
+    epicsUInt64 key;
+} profEntry;
+
+static int profcompare(const void *rawA, const void *rawB)
+{
+    const profEntry *A = rawA, *B = rawB;
+    /* descending */
+    if(A->key > B->key)
+        return -1;
+    else if(A->key < B->key)
+        return 1;
+    return 0;
+}
+
+long dbLockShowProfile(int count, const char *sortby)
+{
+    profEntry *entries;
+    lockSet *ls;
+    size_t i, n = 0, nmax = dbLockCountSets();
+    enum {sortHold, sortWait, sortMax, sortLocks} key = sortHold;
+
+    if(!sortby || !*sortby || strcmp(sortby, "hold")==0)
+        key = sortHold;
+    else if(strcmp(sortby, "wait")==0)
+        key = sortWait;
+    else if(strcmp(sortby, "max")==0)
+        key = sortMax;
+    else if(strcmp(sortby, "locks")==0)
+        key = sortLocks;
+    else {
+        printf("Unknown sort key \"%s\", use hold, wait, max or locks\n",
+               sortby);
+        return -1;
+    }
+    if(count<=0)
+        count = 10;
+
+    if(!dbLockProfiling)
+        printf("Lock set profiling is off, set dbLockProfiling to 1\n");
+    if(nmax==0)
+        return 0;
+
+    entries = calloc(nmax, sizeof(*entries));
+    if(!entries) {
+        printf("Out of memory\n");
+        return -1;
+    }
+
+    /* lockSets are never free()d while the IOC runs,
+     * so a racy walk is safe like in dblsr()
+     */
+    for(ls = nextActiveSet(NULL); ls && n<nmax; ls = nextActiveSet(ls)) {
+        if(ls->profLocks==0)
+            continue;
+        entries[n].ls = ls;
+        switch(key) {
+        case sortHold:  entries[n].key = ls->profHold; break;
+        case sortWait:  entries[n].key = ls->profWait; break;
+        case sortMax:   entries[n].key = ls->profHoldMax; break;
+        case sortLocks: entries[n].key = ls->profLocks; break;
         }
+        n++;
+    }
+    qsort(entries, n, sizeof(*entries), &profcompare);
+
+    printf("%8s %7s %10s %10s %9s %10s %9s  %-15s %-18s %s\n",
+           "Lock Set", "Records", "Locks", "Wait ms", "Max wait",
+           "Hold ms", "Max hold", "Max holder", "Thread id",
+           "First record");
+    for(i=0; i<n && i<(size_t)count; i++) {
+        lockRecord *lr;
+
+        ls = entries[i].ls;
+        lr = (lockRecord*)ellFirst(&ls->lockRecordList);
+        printf("%8lu %7d %10llu %10.3f %9.3f %10.3f %9.3f  %-15s %-18p %s\n",
+               ls->id, ellCount(&ls->lockRecordList),
+               (unsigned long long)ls->profLocks,
+               ls->profWait*1e-6, ls->profWaitMax*1e-6,
+               ls->profHold*1e-6, ls->profHoldMax*1e-6,
+               ls->profHoldMaxThread[0] ? ls->profHoldMaxThread : "-",
+               (void*)ls->profHoldMaxId,
+               lr && lr->precord ? lr->precord->name : "");
     }
+    free(entries);
     return 0;
 }
 
+void dbLockResetProfile(void)
+{
+    unsigned i;
+
+    /* Waiting for ls->lock while holding a shard guard could deadlock
+     * with a thread freeing a lockSet, so lock sets which are held
+     * are reset by their holder instead.
+     */
+    for(i=0; i<LOCKSET_NSHARDS; i++) {
+        lockSetShard *shard = &lockSetShards[i];
+        ELLNODE *cur;
+
+        epicsMutexMustLock(shard->guard);
+        for(cur = ellFirst(&shard->active); cur; cur = ellNext(cur)) {
+            lockSet *ls = CONTAINER(cur, lockSet, node);
+
+            epicsAtomicSetIntT(&ls->profResetPending, 1);
+            if(epicsMutexTryLock(ls->lock)==epicsMutexLockOK) {
+                lockSetProfReset(ls);
+                epicsMutexUnlock(ls->lock);
+            }
+        }
+        epicsMutexUnlock(shard->guard);
+    }
+}
+
 int * dbLockSetAddrTrace(dbCommon *precord)
 {
     lockRecord  *plockRecord = precord->lset;
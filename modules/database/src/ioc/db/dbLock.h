@@ -29,6 +29,14 @@ typedef struct dbLocker dbLocker;
 epicsShareFunc void dbScanLock(struct dbCommon *precord);
 epicsShareFunc void dbScanUnlock(struct dbCommon *precord);
 
+/* Shared locking for callers which only read from the lock set.
+ * Exclusive unless dbLockSharedReaders was set before iocInit.
+ * Must not be nested, or followed by dbScanLock() of the same lock set.
+ */
+epicsShareFunc void dbScanLockRead(struct dbCommon *precord);
+epicsShareFunc void dbScanUnlockRead(struct dbCommon *precord);
+epicsShareExtern int dbLockSharedReaders;
+
 epicsShareFunc dbLocker *dbLockerAlloc(struct dbCommon * const *precs,
                                        size_t nrecs,
                                        unsigned int flags);
@@ -52,6 +60,14 @@ epicsShareFunc long dblsr(char *recordname,int level);
 
 epicsShareFunc long dbLockShowLocked(int level);
 
+/* Lock set contention profile, collected while dbLockProfiling is set.
+ * Show the count busiest lock sets, sorted by "wait", "hold" (the
+ * default), "max" hold time or "locks".
+ */
+epicsShareExtern int dbLockProfiling;
+epicsShareFunc long dbLockShowProfile(int count, const char *sortby);
+epicsShareFunc void dbLockResetProfile(void);
+
 /*KLUDGE to support field TPRO*/
 epicsShareFunc int * dbLockSetAddrTrace(struct dbCommon *precord);
 
@@ -10,6 +10,7 @@
 #define DBLOCKPVT_H
 
 #include "dbLock.h"
+#include "epicsEvent.h"
 #include "epicsSpin.h"
 
 /* Define to enable additional error checking */
@@ -39,6 +40,33 @@ typedef struct dbLockSet {
     ELLNODE             lockernode;
 
     int                 trace; /*For field TPRO*/
+
+    unsigned            shard; /* index into the global table, never changes */
+
+    /* Shared (reader) locking, only used with dbLockSharedReaders.
+     * readers and writerWaiting are atomic, writer and writerDepth
+     * are guarded by lock.
+     */
+    int                 readers;
+    int                 writerWaiting;
+    epicsEventId        readersDone;
+    epicsThreadId       writer;
+    unsigned            writerDepth;
+
+    /* Contention profile, only collected while dbLockProfiling is set.
+     * Guarded by lock, except profResetPending.  Times are in ns.
+     */
+    epicsUInt64         profLocks;      /* acquisitions */
+    epicsUInt64         profWait;       /* total time spent waiting */
+    epicsUInt64         profWaitMax;
+    epicsUInt64         profHold;       /* total time held */
+    epicsUInt64         profHoldMax;
+    epicsUInt64         profHoldStart;
+    unsigned            profDepth;      /* recursion of the present holder */
+    epicsThreadId       profHolder;
+    epicsThreadId       profHoldMaxId;  /* holder for profHoldMax */
+    char                profHoldMaxThread[32]; /* and its name */
+    int                 profResetPending; /* reset by the next holder */
 } lockSet;
 
 struct lockRecord;
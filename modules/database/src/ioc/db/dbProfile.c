@@ -0,0 +1,295 @@
+/*************************************************************************\
+* EPICS BASE is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+
+/* Record processing profiler.
+ *
+ * While dbProcessProfiling is set, dbProcess() times each call of the
+ * record's process() routine with epicsMonotonicGet().  The time spent
+ * in records processed through links from inside process() is kept in
+ * a frame on the stack of the processing thread, so both the total
+ * and the self time of each record are known.
+ *
+ * Profiles are allocated the first time a record is timed, and are
+ * only changed with the record locked.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "dbDefs.h"
+#include "epicsAtomic.h"
+#include "epicsStdio.h"
+#include "epicsThread.h"
+#include "epicsTime.h"
+
+#define epicsExportSharedSymbols
+#include "caeventmask.h"
+#include "dbAccessDefs.h"
+#include "dbBase.h"
+#include "dbCommon.h"
+#include "dbCommonPvt.h"
+#include "dbEvent.h"
+#include "dbLock.h"
+#include "dbProfile.h"
+#include "dbStaticLib.h"
+#include "epicsExport.h"
+
+int dbProcessProfiling = 0;
+epicsExportAddress(int,dbProcessProfiling);
+
+static epicsThreadOnceId frameOnce = EPICS_THREAD_ONCE_INIT;
+static epicsThreadPrivateId frameKey;
+
+static void frameKeyCreate(void *junk)
+{
+    frameKey = epicsThreadPrivateCreate();
+}
+
+static unsigned bucket(epicsUInt64 ns)
+{
+    epicsUInt64 us = ns / 1000u;
+    unsigned n = 0;
+
+    while (us && n < DBPROF_NBUCKETS - 1) {
+        us >>= 1;
+        n++;
+    }
+    return n;
+}
+
+void dbProfileScanRequest(dbCommon *precord, epicsUInt64 requested)
+{
+    dbRec2Pvt(precord)->profRequested = requested;
+}
+
+void dbProfileEnter(dbCommon *precord, dbProfileFrame *pframe)
+{
+    epicsThreadOnce(&frameOnce, frameKeyCreate, NULL);
+
+    pframe->outer = epicsThreadPrivateGet(frameKey);
+    pframe->inner = 0;
+    epicsThreadPrivateSet(frameKey, pframe);
+    pframe->start = epicsMonotonicGet();
+}
+
+void dbProfileLeave(dbCommon *precord, dbProfileFrame *pframe)
+{
+    dbCommonPvt *ppvt = dbRec2Pvt(precord);
+    dbProcessProfile *pprof = ppvt->prof;
+    epicsUInt64 now = epicsMonotonicGet();
+    epicsUInt64 elapsed = now - pframe->start;
+
+    epicsThreadPrivateSet(frameKey, pframe->outer);
+    if (pframe->outer)
+        pframe->outer->inner += elapsed;
+
+    if (!pprof) {
+        pprof = ppvt->prof = calloc(1, sizeof(*pprof));
+        if (!pprof)
+            return;
+    }
+
+    pprof->count++;
+    pprof->total += elapsed;
+    pprof->self += elapsed - pframe->inner;
+    if (elapsed > pprof->max)
+        pprof->max = elapsed;
+    pprof->hist[bucket(elapsed)]++;
+
+    if (ppvt->profRequested) {
+        epicsUInt64 delay = pframe->start - ppvt->profRequested;
+
+        ppvt->profRequested = 0;
+        pprof->delayCount++;
+        pprof->delayTotal += delay;
+        if (delay > pprof->delayMax)
+            pprof->delayMax = delay;
+        pprof->delayHist[bucket(delay)]++;
+    }
+
+    precord->ptim = elapsed * 1e-3;
+    if (epicsAtomicGetIntT(&ppvt->ptimMonitors))
+        db_post_events(precord, &precord->ptim, DBE_VALUE | DBE_LOG);
+}
+
+long dbProcessProfileGet(dbCommon *precord, dbProcessProfile *pprof)
+{
+    long status = -1;
+
+    dbScanLock(precord);
+    if (dbRec2Pvt(precord)->prof) {
+        *pprof = *dbRec2Pvt(precord)->prof;
+        status = 0;
+    }
+    dbScanUnlock(precord);
+    return status;
+}
+
+typedef struct {
+    dbCommon *precord;
+    dbProcessProfile prof;
+} topEntry;
+
+static int topcompare(const void *rawA, const void *rawB)
+{
+    const topEntry *A = rawA, *B = rawB;
+    /* descending */
+    if (A->prof.total > B->prof.total)
+        return -1;
+    else if (A->prof.total < B->prof.total)
+        return 1;
+    return 0;
+}
+
+long dbtop(int count)
+{
+    DBENTRY dbentry;
+    DBENTRY *pdbentry = &dbentry;
+    topEntry *entries = NULL;
+    size_t i, n = 0, nmax = 0;
+    long status;
+
+    if (!pdbbase) {
+        printf("No database loaded\n");
+        return 0;
+    }
+    if (count <= 0)
+        count = 10;
+    if (!dbProcessProfiling)
+        printf("Record profiling is off, set dbProcessProfiling to 1\n");
+
+    dbInitEntry(pdbbase, pdbentry);
+    for (status = dbFirstRecordType(pdbentry); !status;
+         status = dbNextRecordType(pdbentry)) {
+        for (status = dbFirstRecord(pdbentry); !status;
+             status = dbNextRecord(pdbentry)) {
+            dbCommon *precord = pdbentry->precnode->precord;
+
+            if (dbIsAlias(pdbentry) || !precord || !dbRec2Pvt(precord)->prof)
+                continue;
+            if (n == nmax) {
+                size_t newmax = nmax ? 2 * nmax : 64;
+                topEntry *pnew = realloc(entries, newmax * sizeof(*entries));
+
+                if (!pnew) {
+                    printf("Out of memory\n");
+                    dbFinishEntry(pdbentry);
+                    free(entries);
+                    return -1;
+                }
+                entries = pnew;
+                nmax = newmax;
+            }
+            entries[n].precord = precord;
+            if (dbProcessProfileGet(precord, &entries[n].prof) == 0)
+                n++;
+        }
+    }
+    dbFinishEntry(pdbentry);
+
+    qsort(entries, n, sizeof(*entries), &topcompare);
+
+    printf("%10s %10s %10s %9s %9s %9s %9s  %s\n",
+           "Count", "Total ms", "Self ms", "Mean us", "Max us",
+           "Delay us", "Max delay", "Record");
+    for (i = 0; i < n && i < (size_t)count; i++) {
+        const dbProcessProfile *pprof = &entries[i].prof;
+        double delay = pprof->delayCount ?
+            pprof->delayTotal * 1e-3 / pprof->delayCount : 0.0;
+
+        printf("%10llu %10.3f %10.3f %9.1f %9.1f %9.1f %9.1f  %s\n",
+               (unsigned long long)pprof->count,
+               pprof->total * 1e-6, pprof->self * 1e-6,
+               pprof->count ? pprof->total * 1e-3 / pprof->count : 0.0,
+               pprof->max * 1e-3, delay, pprof->delayMax * 1e-3,
+               entries[i].precord->name);
+    }
+    free(entries);
+    return 0;
+}
+
+static void printHist(const char *title, const epicsUInt32 *hist)
+{
+    unsigned i, last = 0;
+
+    for (i = 0; i < DBPROF_NBUCKETS; i++)
+        if (hist[i])
+            last = i;
+
+    printf("%s\n", title);
+    for (i = 0; i <= last; i++) {
+        if (i == 0)
+            printf("  %10s < %8u us %10u\n", "", 1u, (unsigned)hist[i]);
+        else if (i == DBPROF_NBUCKETS - 1)
+            printf("  %10u us and more   %10u\n", 1u << (i - 1),
+                   (unsigned)hist[i]);
+        else
+            printf("  %10u - %8u us %10u\n", 1u << (i - 1), 1u << i,
+                   (unsigned)hist[i]);
+    }
+}
+
+long dbtophist(const char *recordname)
+{
+    DBENTRY dbentry;
+    dbCommon *precord = NULL;
+    dbProcessProfile prof;
+
+    if (!pdbbase) {
+        printf("No database loaded\n");
+        return 0;
+    }
+    if (!recordname || !*recordname) {
+        printf("Usage: dbtophist \"record name\"\n");
+        return -1;
+    }
+
+    dbInitEntry(pdbbase, &dbentry);
+    if (dbFindRecord(&dbentry, recordname) == 0)
+        precord = dbentry.precnode->precord;
+    dbFinishEntry(&dbentry);
+    if (!precord) {
+        printf("Record '%s' not found\n", recordname);
+        return -1;
+    }
+    if (dbProcessProfileGet(precord, &prof)) {
+        printf("Record '%s' has no profile\n", precord->name);
+        return 0;
+    }
+
+    printf("%s: %llu calls, self %.3f ms, total %.3f ms, max %.1f us\n",
+           precord->name, (unsigned long long)prof.count,
+           prof.self * 1e-6, prof.total * 1e-6, prof.max * 1e-3);
+    printHist("process() time", prof.hist);
+    if (prof.delayCount)
+        printHist("Scan request to process() delay", prof.delayHist);
+    return 0;
+}
+
+void dbtopReset(void)
+{
+    DBENTRY dbentry;
+    DBENTRY *pdbentry = &dbentry;
+    long status;
+
+    if (!pdbbase)
+        return;
+
+    dbInitEntry(pdbbase, pdbentry);
+    for (status = dbFirstRecordType(pdbentry); !status;
+         status = dbNextRecordType(pdbentry)) {
+        for (status = dbFirstRecord(pdbentry); !status;
+             status = dbNextRecord(pdbentry)) {
+            dbCommon *precord = pdbentry->precnode->precord;
+
+            if (dbIsAlias(pdbentry) || !precord || !dbRec2Pvt(precord)->prof)
+                continue;
+            dbScanLock(precord);
+            memset(dbRec2Pvt(precord)->prof, 0, sizeof(dbProcessProfile));
+            dbScanUnlock(precord);
+        }
+    }
+    dbFinishEntry(pdbentry);
+}
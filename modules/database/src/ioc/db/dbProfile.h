@@ -0,0 +1,75 @@
+/*************************************************************************\
+* EPICS BASE is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+
+/* Record processing profiler, active while dbProcessProfiling is set */
+
+#ifndef INC_dbProfile_H
+#define INC_dbProfile_H
+
+#include "epicsTypes.h"
+#include "shareLib.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct dbCommon;
+
+/* Histogram bucket 0 counts times below 1 us, bucket n times from
+ * 2^(n-1) up to 2^n us, and the last bucket anything longer.
+ */
+#define DBPROF_NBUCKETS 24
+
+typedef struct dbProcessProfile {
+    epicsUInt64 count;      /* process() calls timed */
+    epicsUInt64 total;      /* ns in process(), including linked records */
+    epicsUInt64 self;       /* ns in process(), excluding linked records */
+    epicsUInt64 max;        /* longest process() call, ns */
+    epicsUInt32 hist[DBPROF_NBUCKETS];
+    epicsUInt64 delayCount; /* scan requests timed */
+    epicsUInt64 delayTotal; /* ns from scan request to process() */
+    epicsUInt64 delayMax;
+    epicsUInt32 delayHist[DBPROF_NBUCKETS];
+} dbProcessProfile;
+
+/* One per process() call on the stack of the processing thread.
+ * Records processed synchronously through links are timed in
+ * their own frame, which is charged to the frame outside it.
+ */
+typedef struct dbProfileFrame {
+    struct dbProfileFrame *outer;
+    epicsUInt64 start;
+    epicsUInt64 inner;      /* ns spent in frames inside this one */
+} dbProfileFrame;
+
+epicsShareExtern int dbProcessProfiling;
+
+/* Show the count records using the most processing time */
+epicsShareFunc long dbtop(int count);
+/* Show the histograms of one record */
+epicsShareFunc long dbtophist(const char *recordname);
+epicsShareFunc void dbtopReset(void);
+
+/* Copy a record's profile, returns -1 if there is none */
+epicsShareFunc long dbProcessProfileGet(struct dbCommon *precord,
+    dbProcessProfile *pprof);
+
+/* Called by the scan tasks with the record locked, passing the
+ * epicsMonotonicGet() time at which its processing was requested.
+ */
+epicsShareFunc void dbProfileScanRequest(struct dbCommon *precord,
+    epicsUInt64 requested);
+
+/* Called by dbProcess() with the record locked, around process() */
+epicsShareFunc void dbProfileEnter(struct dbCommon *precord,
+    dbProfileFrame *pframe);
+epicsShareFunc void dbProfileLeave(struct dbCommon *precord,
+    dbProfileFrame *pframe);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* INC_dbProfile_H */
@@ -28,8 +28,9 @@
 #include "epicsAtomic.h"
 #include "epicsEvent.h"
 #include "epicsMutex.h"
+#include "epicsInterrupt.h"
 #include "epicsPrint.h"
-#include "epicsRingBytes.h"
+#include "epicsSpin.h"
 #include "epicsStdio.h"
 #include "epicsStdlib.h"
 #include "epicsString.h"
@@ -43,11 +44,14 @@
 #include "dbAddr.h"
 #include "dbBase.h"
 #include "dbCommon.h"
+#include "dbCommonPvt.h"
 #include "dbFldTypes.h"
 #include "dbLock.h"
+#include "dbProfile.h"
 #include "dbScan.h"
 #include "dbStaticLib.h"
 #include "devSup.h"
+#include "epicsExport.h"
 #include "link.h"
 #include "recGbl.h"
 
@@ -62,10 +66,42 @@ static volatile enum ctl scanCtl;
 
 /* SCAN ONCE */
 
+typedef struct {
+    struct dbCommon *prec;
+    once_complete cb;
+    void *usr;
+    int pending;    /* this entry set the record's oncePending flag */
+    epicsUInt64 requested;  /* while dbProcessProfiling, else 0 */
+} onceEntry;
+
+/* A completion callback chained onto a coalesced request */
+typedef struct onceWaiter {
+    struct onceWaiter *next;
+    once_complete cb;
+    void *usr;
+} onceWaiter;
+
+/* Fold scanOnce() requests for a record that is already queued
+ * into the queued request.
+ */
+int scanOnceCoalesce = 0;
+epicsExportAddress(int,scanOnceCoalesce);
+
 static int onceQueueSize = 1000;
+static int onceQueueLimit = 1000;   /* use atomic */
+static int onceQueuePolicy = queueFullDrop;  /* use atomic */
 static epicsEventId onceSem;
-static epicsRingBytesId onceQ;
+static epicsEventId onceSpace;
+static epicsSpinId onceLock;
+static onceEntry *onceQ;        /* circular buffer guarded by onceLock */
+static int onceQSize;
+static int onceQHead;           /* next entry to take */
+static int onceQUsed;
+static int onceQMaxUsed;
 static int onceQOverruns = 0;
+static int onceQCoalesced = 0;
+static int onceQGrowths = 0;
+static int onceQBlocked = 0;
 static epicsThreadId onceTaskId;
 static void *exitOnce;
 
@@ -88,6 +124,22 @@ typedef struct scan_element{
 
 #define OVERRUN_REPORT_DELAY 10.0   /* Time between initial reports */
 #define OVERRUN_REPORT_MAX 3600.0   /* Maximum time between reports */
+struct periodic_scan_list;
+
+/* One share of a periodic scan list when it is split between several
+ * threads.  Worker 0 is run by the periodic scan thread itself.
+ */
+typedef struct periodic_scan_worker {
+    struct periodic_scan_list *ppsl;
+    epicsEventId        loopEvent;
+    struct dbCommon     **precs;    /* records to process in this pass */
+    size_t              nrecs;
+    size_t              maxrecs;
+    double              elapsed;    /* seconds taken by the last pass */
+    double              elapsedMax;
+    unsigned long       overruns;
+} periodic_scan_worker;
+
 typedef struct periodic_scan_list {
     scan_list           scan_list;
     double              period;
@@ -95,12 +147,20 @@ typedef struct periodic_scan_list {
     unsigned long       overruns;
     volatile enum ctl   scanCtl;
     epicsEventId        loopEvent;
+    int                 nWorkers;
+    periodic_scan_worker *pworkers; /* NULL unless nWorkers > 1 */
+    int                 workersBusy; /* use atomic */
+    epicsEventId        workersDone;
 } periodic_scan_list;
 
 static int nPeriodic = 0;
 static periodic_scan_list **papPeriodic; /* pointer to array of pointers */
 static epicsThreadId *periodicTaskId;    /* array of thread ids */
 
+/* Worker counts set by scanPeriodicWorkers(), indexed by menuScan choice */
+static int *periodicWorkersConfigured;
+static int nPeriodicWorkersConfigured;
+
 
 static char *priorityName[NUM_CALLBACK_PRIORITIES] = {
     "Low", "Medium", "High"
@@ -123,6 +183,7 @@ static epicsMutexId event_lock;
 typedef struct io_scan_list {
     epicsCallback callback;
     scan_list scan_list;
+    int drops;      /* requests dropped, not yet counted, use atomic */
 } io_scan_list;
 
 typedef struct ioscan_head {
@@ -139,6 +200,9 @@ static epicsMutexId ioscan_lock;
 static void onceTask(void *);
 static void initOnce(void);
 static void periodicTask(void *arg);
+static void periodicWorkerTask(void *arg);
+static void scanListParallel(periodic_scan_list *ppsl);
+static void scanRecords(periodic_scan_worker *pw);
 static void initPeriodic(void);
 static void deletePeriodic(void);
 static void spawnPeriodic(int ind);
@@ -148,6 +212,8 @@ static void ioscanCallback(epicsCallback *pcallback);
 static void ioscanDestroy(void);
 static void printList(scan_list *psl, char *message);
 static void scanList(scan_list *psl);
+static void countDrop(struct dbCommon *precord);
+static void countListDrops(io_scan_list *piosl);
 static void buildScanLists(void);
 static void addToList(struct dbCommon *precord, scan_list *psl);
 static void deleteFromList(struct dbCommon *precord, scan_list *psl);
@@ -180,11 +246,17 @@ void scanCleanup(void)
     deletePeriodic();
     ioscanDestroy();
 
-    epicsRingBytesDelete(onceQ);
+    free(onceQ);
+    onceQ = NULL;
+    epicsSpinDestroy(onceLock);
 
     free(periodicTaskId);
     papPeriodic = NULL;
     periodicTaskId = NULL;
+
+    free(periodicWorkersConfigured);
+    periodicWorkersConfigured = NULL;
+    nPeriodicWorkersConfigured = 0;
 }
 
 long scanInit(void)
@@ -401,10 +473,70 @@ int scanppl(double period)      /* print periodic scan list(s) */
         sprintf(message, "Records with SCAN = '%s' (%lu over-runs):",
             ppsl->name, ppsl->overruns);
         printList(&ppsl->scan_list, message);
+
+        if (ppsl->pworkers) {
+            int w;
+
+            for (w = 0; w < ppsl->nWorkers; w++) {
+                periodic_scan_worker *pw = &ppsl->pworkers[w];
+
+                printf("    Worker %d: %lu records, last %.3f s, max %.3f s,"
+                    " %lu over-runs\n", w, (unsigned long)pw->nrecs,
+                    pw->elapsed, pw->elapsedMax, pw->overruns);
+            }
+        }
     }
     return 0;
 }
 
+int scanPeriodicWorkers(int count, const char *rate)
+{
+    dbMenu *pmenu;
+    int i;
+
+    if (papPeriodic) {
+        fprintf(stderr, "scanPeriodicWorkers: Scan system already initialized\n");
+        return -1;
+    }
+
+    if (count < 0)
+        count = epicsThreadGetCPUs() + count;
+    else if (count == 0)
+        count = epicsThreadGetCPUs();
+    if (count < 1) count = 1;
+
+    if (!pdbbase) {
+        fprintf(stderr, "scanPeriodicWorkers: pdbbase not set\n");
+        return -1;
+    }
+
+    pmenu = dbFindMenu(pdbbase, "menuScan");
+    if (!pmenu) {
+        fprintf(stderr, "scanPeriodicWorkers: menuScan not present\n");
+        return -1;
+    }
+
+    if (!periodicWorkersConfigured) {
+        periodicWorkersConfigured = dbCalloc(pmenu->nChoice, sizeof(int));
+        nPeriodicWorkersConfigured = pmenu->nChoice;
+    }
+
+    if (!rate || *rate == 0 || strcmp(rate, "*") == 0) {
+        for (i = SCAN_1ST_PERIODIC; i < nPeriodicWorkersConfigured; i++)
+            periodicWorkersConfigured[i] = count;
+        return 0;
+    }
+
+    for (i = SCAN_1ST_PERIODIC; i < nPeriodicWorkersConfigured; i++) {
+        if (epicsStrCaseCmp(rate, pmenu->papChoiceValue[i]) == 0) {
+            periodicWorkersConfigured[i] = count;
+            return 0;
+        }
+    }
+    fprintf(stderr, "scanPeriodicWorkers: Unknown scan rate \"%s\"\n", rate);
+    return -1;
+}
+
 int scanpel(const char* eventname)   /* print event list */
 {
     char message[80];
@@ -617,9 +749,12 @@ unsigned int scanIoRequest(IOSCANPVT piosh)
     for (prio = 0; prio < NUM_CALLBACK_PRIORITIES; prio++) {
         io_scan_list *piosl = &piosh->iosl[prio];
 
-        if (ellCount(&piosl->scan_list.list) > 0)
+        if (ellCount(&piosl->scan_list.list) > 0) {
             if (!callbackRequest(&piosl->callback))
                 queued |= 1 << prio;
+            else
+                epicsAtomicIncrIntT(&piosl->drops);
+        }
     }
 
     return queued;
@@ -658,28 +793,252 @@ int scanOnce(struct dbCommon *precord) {
     return scanOnceCallback(precord, NULL, NULL);
 }
 
-typedef struct {
-    struct dbCommon *prec;
-    once_complete cb;
-    void *usr;
-} onceEntry;
+static void countDrop(struct dbCommon *precord)
+{
+    if (precord && precord != (void *)&exitOnce)
+        epicsAtomicIncrIntT(&dbRec2Pvt(precord)->dropCount);
+}
+
+/* Entries with a completion callback are never counted, so those are
+ * never taken for a request for the same record without one.
+ */
+static int onceCounted(const onceEntry *pent)
+{
+    return !pent->cb && pent->prec != (void *)&exitOnce;
+}
+
+/* Clear the record's pending flag, returning the completions chained
+ * onto its request.  Done under the lock so none can be added after.
+ */
+static onceWaiter * onceTakeWaiters(struct dbCommon *precord)
+{
+    dbCommonPvt *ppvt = dbRec2Pvt(precord);
+    onceWaiter *pwait;
+
+    epicsSpinLock(onceLock);
+    epicsAtomicSetIntT(&ppvt->oncePending, 0);
+    pwait = ppvt->onceWaiters;
+    ppvt->onceWaiters = NULL;
+    epicsSpinUnlock(onceLock);
+    return pwait;
+}
+
+static void onceCallWaiters(onceWaiter *pwait, struct dbCommon *precord)
+{
+    while (pwait) {
+        onceWaiter *pnext = pwait->next;
+
+        pwait->cb(pwait->usr, precord);
+        free(pwait);
+        pwait = pnext;
+    }
+}
+
+/* Chain a completion onto the record's queued request, if it still
+ * has one which hasn't been taken by the scanOnce thread yet.
+ */
+static int onceChainWaiter(struct dbCommon *precord, once_complete cb,
+    void *usr)
+{
+    dbCommonPvt *ppvt = dbRec2Pvt(precord);
+    onceWaiter *pwait = malloc(sizeof(onceWaiter));
+    int chained = FALSE;
+
+    if (!pwait)
+        return FALSE;
+    pwait->cb = cb;
+    pwait->usr = usr;
+
+    epicsSpinLock(onceLock);
+    if (epicsAtomicGetIntT(&ppvt->oncePending)) {
+        pwait->next = ppvt->onceWaiters;
+        ppvt->onceWaiters = pwait;
+        chained = TRUE;
+    }
+    epicsSpinUnlock(onceLock);
+
+    if (!chained)
+        free(pwait);
+    return chained;
+}
+
+/* The completions chained onto a dropped request are still called,
+ * their callers were told the request had been accepted.
+ */
+static void onceDrop(const onceEntry *pent)
+{
+    if (pent->pending)
+        onceCallWaiters(onceTakeWaiters(pent->prec), pent->prec);
+    countDrop(pent->prec);
+}
+
+static int oncePush(const onceEntry *pent)
+{
+    int pushed = FALSE;
+
+    epicsSpinLock(onceLock);
+    if (onceQUsed < onceQSize) {
+        onceQ[(onceQHead + onceQUsed) % onceQSize] = *pent;
+        if (onceCounted(pent))
+            epicsAtomicIncrIntT(&dbRec2Pvt(pent->prec)->onceQueued);
+        if (++onceQUsed > onceQMaxUsed)
+            onceQMaxUsed = onceQUsed;
+        pushed = TRUE;
+    }
+    epicsSpinUnlock(onceLock);
+    return pushed;
+}
+
+static int oncePop(onceEntry *pent)
+{
+    int popped = FALSE;
+
+    epicsSpinLock(onceLock);
+    if (onceQUsed > 0) {
+        *pent = onceQ[onceQHead];
+        onceQHead = (onceQHead + 1) % onceQSize;
+        onceQUsed--;
+        if (onceCounted(pent))
+            epicsAtomicDecrIntT(&dbRec2Pvt(pent->prec)->onceQueued);
+        popped = TRUE;
+    }
+    epicsSpinUnlock(onceLock);
+    return popped;
+}
+
+/* Like oncePop(), but only takes a request without a completion
+ * callback, the caller of one with a callback is owed that call.
+ * The shutdown request is never taken either.
+ */
+static int onceDropOldest(onceEntry *pent)
+{
+    int popped = FALSE;
+
+    epicsSpinLock(onceLock);
+    if (onceQUsed > 0 && onceCounted(&onceQ[onceQHead]) &&
+        !(onceQ[onceQHead].pending &&
+          dbRec2Pvt(onceQ[onceQHead].prec)->onceWaiters)) {
+        *pent = onceQ[onceQHead];
+        onceQHead = (onceQHead + 1) % onceQSize;
+        onceQUsed--;
+        epicsAtomicDecrIntT(&dbRec2Pvt(pent->prec)->onceQueued);
+        popped = TRUE;
+    }
+    epicsSpinUnlock(onceLock);
+    return popped;
+}
+
+/* Double the queue size, up to the limit */
+static int onceGrow(void)
+{
+    int limit = epicsAtomicGetIntT(&onceQueueLimit);
+    int size, newSize, i;
+    onceEntry *pnew, *pold = NULL;
+
+    if (epicsInterruptIsInterruptContext())
+        return FALSE;
+
+    epicsSpinLock(onceLock);
+    size = onceQSize;
+    epicsSpinUnlock(onceLock);
+    if (size >= limit)
+        return FALSE;
+
+    newSize = (2 * size < limit) ? 2 * size : limit;
+    pnew = malloc(newSize * sizeof(onceEntry));
+    if (!pnew)
+        return FALSE;
+
+    epicsSpinLock(onceLock);
+    if (onceQSize == size) {
+        for (i = 0; i < onceQUsed; i++)
+            pnew[i] = onceQ[(onceQHead + i) % onceQSize];
+        pold = onceQ;
+        onceQ = pnew;
+        onceQSize = newSize;
+        onceQHead = 0;
+        pnew = NULL;
+        onceQGrowths++;
+    }
+    epicsSpinUnlock(onceLock);
+
+    free(pold);
+    free(pnew); /* someone else grew it first */
+    return TRUE;
+}
 
 int scanOnceCallback(struct dbCommon *precord, once_complete cb, void *usr)
 {
     static int newOverflow = TRUE;
     onceEntry ent;
+    int policy = epicsAtomicGetIntT(&onceQueuePolicy);
     int pushOK;
 
     ent.prec = precord;
     ent.cb = cb;
     ent.usr = usr;
+    ent.pending = FALSE;
+    ent.requested = dbProcessProfiling ? epicsMonotonicGet() : 0;
 
-    pushOK = epicsRingBytesPut(onceQ, (void*)&ent, sizeof(ent));
+    /* A request with a completion callback is folded by chaining the
+     * callback onto the queued request, which needs memory.  Failing
+     * that, or from interrupt context, it gets its own queue entry.
+     */
+    if (scanOnceCoalesce && precord != (void *)&exitOnce &&
+        (!cb || !epicsInterruptIsInterruptContext())) {
+        if (epicsAtomicCmpAndSwapIntT(&dbRec2Pvt(precord)->oncePending,
+                0, 1) == 0) {
+            ent.pending = TRUE;
+        }
+        else if (!cb || onceChainWaiter(precord, cb, usr)) {
+            epicsAtomicIncrIntT(&onceQCoalesced);
+            return 0;
+        }
+    }
+
+    while (!(pushOK = oncePush(&ent))) {
+        onceEntry old;
+
+        if (onceGrow())
+            continue;
+        if (policy == queueFullCoalesce) {
+            /* A request with a completion callback needs its own entry */
+            if (onceCounted(&ent) &&
+                epicsAtomicGetIntT(&dbRec2Pvt(precord)->onceQueued) > 0) {
+                /* the request already queued processes the record */
+                if (ent.pending)
+                    onceCallWaiters(onceTakeWaiters(precord), precord);
+                epicsAtomicIncrIntT(&onceQCoalesced);
+                epicsEventSignal(onceSem);
+                return 0;
+            }
+        }
+        else if (policy == queueFullDropOldest) {
+            if (onceDropOldest(&old)) {
+                epicsAtomicIncrIntT(&onceQOverruns);
+                onceDrop(&old);
+                continue;
+            }
+        }
+        else if (policy == queueFullBlock &&
+                 !epicsInterruptIsInterruptContext() &&
+                 epicsThreadGetIdSelf() != onceTaskId &&
+                 scanCtl != ctlExit) {
+            /* The scanOnce thread must not wait for itself */
+            epicsAtomicIncrIntT(&onceQBlocked);
+            epicsEventSignal(onceSem);
+            epicsEventWaitWithTimeout(onceSpace, 1.0);
+            epicsAtomicDecrIntT(&onceQBlocked);
+            continue;
+        }
+        break;
+    }
 
     if (!pushOK) {
         if (newOverflow) errlogPrintf("scanOnce: Ring buffer overflow\n");
         newOverflow = FALSE;
         epicsAtomicIncrIntT(&onceQOverruns);
+        onceDrop(&ent);
     } else {
         newOverflow = TRUE;
     }
@@ -694,24 +1053,27 @@ static void onceTask(void *arg)
     epicsEventSignal(startStopEvent);
 
     while (TRUE) {
+        onceEntry ent;
 
         epicsEventMustWait(onceSem);
-        while(1) {
-            onceEntry ent;
-            int bytes = epicsRingBytesGet(onceQ, (void*)&ent, sizeof(ent));
-            if(bytes==0)
-                break;
-            if(bytes!=sizeof(ent)) {
-                errlogPrintf("onceTask: received incomplete %d of %u\n",
-                             bytes, (unsigned)sizeof(ent));
-                continue; /* what to do? */
-            } else if (ent.prec == (void*)&exitOnce) goto shutdown;
+        while (oncePop(&ent)) {
+            onceWaiter *pwait = NULL;
 
+            if (epicsAtomicGetIntT(&onceQBlocked))
+                epicsEventSignal(onceSpace);
+            if (ent.prec == (void*)&exitOnce) goto shutdown;
+
+            /* Requests arriving from now on need another pass */
+            if (ent.pending)
+                pwait = onceTakeWaiters(ent.prec);
             dbScanLock(ent.prec);
+            if (ent.requested)
+                dbProfileScanRequest(ent.prec, ent.requested);
             dbProcess(ent.prec);
             dbScanUnlock(ent.prec);
             if(ent.cb)
                 ent.cb(ent.usr, ent.prec);
+            onceCallWaiters(pwait, ent.prec);
         }
     }
 
@@ -723,6 +1085,26 @@ shutdown:
 int scanOnceSetQueueSize(int size)
 {
     onceQueueSize = size;
+    if (epicsAtomicGetIntT(&onceQueueLimit) < size)
+        epicsAtomicSetIntT(&onceQueueLimit, size);
+    return 0;
+}
+
+int scanOnceSetQueueLimit(int limit, const char *policy)
+{
+    if (policy && *policy) {
+        int i = callbackParseQueuePolicy(policy);
+
+        if (i < 0) {
+            fprintf(stderr, "scanOnceSetQueueLimit: Unknown policy \"%s\"\n",
+                policy);
+            return -1;
+        }
+        epicsAtomicSetIntT(&onceQueuePolicy, i);
+    }
+    if (limit < onceQueueSize)
+        limit = onceQueueSize;
+    epicsAtomicSetIntT(&onceQueueLimit, limit);
     return 0;
 }
 
@@ -731,23 +1113,42 @@ int scanOnceQueueStatus(const int reset, scanOnceQueueStats *result)
     int ret;
     if (!onceQ) return -1;
     if (result) {
-        result->size = epicsRingBytesSize(onceQ) / sizeof(onceEntry);
-        result->numUsed = epicsRingBytesUsedBytes(onceQ) / sizeof(onceEntry);
-        result->maxUsed = epicsRingBytesHighWaterMark(onceQ) / sizeof(onceEntry);
+        epicsSpinLock(onceLock);
+        result->size = onceQSize;
+        result->numUsed = onceQUsed;
+        result->maxUsed = onceQMaxUsed;
+        epicsSpinUnlock(onceLock);
         result->numOverflow = epicsAtomicGetIntT(&onceQOverruns);
         ret = 0;
     } else {
         ret = -2;
     }
     if (reset) {
-        epicsRingBytesResetHighWaterMark(onceQ);
+        epicsSpinLock(onceLock);
+        onceQMaxUsed = onceQUsed;
+        epicsSpinUnlock(onceLock);
     }
     return ret;
 }
 
+int scanOnceQueueExtStatus(scanOnceQueueExtStats *result)
+{
+    if (!onceQ) return -1;
+    if (!result) return -2;
+    epicsSpinLock(onceLock);
+    result->numGrowths = onceQGrowths;
+    epicsSpinUnlock(onceLock);
+    result->numCoalesced = epicsAtomicGetIntT(&onceQCoalesced);
+    result->limit = epicsAtomicGetIntT(&onceQueueLimit);
+    return 0;
+}
+
 void scanOnceQueueShow(const int reset)
 {
     scanOnceQueueStats stats;
+    scanOnceQueueExtStats ext;
+
+    scanOnceQueueExtStatus(&ext);
     if (scanOnceQueueStatus(reset, &stats) == -1) {
         fprintf(stderr, "scanOnce system not initialized, yet. Please run "
             "iocInit before using this command.\n");
@@ -755,18 +1156,72 @@ void scanOnceQueueShow(const int reset)
         double qusage = 100.0 * stats.numUsed / stats.size;
         printf("PRIORITY  HIGH-WATER MARK  ITEMS IN Q  Q SIZE  %% USED  Q OVERFLOWS\n");
         printf("%8s  %15d  %10d  %6d  %6.1f  %11d\n", "scanOnce", stats.maxUsed,
-               stats.numUsed, stats.size, qusage,
-               epicsAtomicGetIntT(&onceQOverruns));
+               stats.numUsed, stats.size, qusage, stats.numOverflow);
+        printf("Queue limit %d, grown %d times, %d requests coalesced\n",
+               ext.limit, ext.numGrowths, ext.numCoalesced);
     }
 }
 
-static void initOnce(void)
+int scanDropShow(const int reset)
 {
-    if ((onceQ = epicsRingBytesLockedCreate(sizeof(onceEntry)*onceQueueSize)) == NULL) {
-        cantProceed("initOnce: Ring buffer create failed\n");
+    dbRecordType *pdbRecordType;
+    ioscan_head *piosh;
+
+    if (!pdbbase) {
+        printf("scanDropShow: No database loaded\n");
+        return -1;
+    }
+
+    ioscanInit();
+    epicsMutexMustLock(ioscan_lock);
+    for (piosh = pioscan_list; piosh; piosh = piosh->next) {
+        int prio;
+
+        for (prio = 0; prio < NUM_CALLBACK_PRIORITIES; prio++)
+            countListDrops(&piosh->iosl[prio]);
+    }
+    epicsMutexUnlock(ioscan_lock);
+
+    for (pdbRecordType = (dbRecordType *)ellFirst(&pdbbase->recordTypeList);
+         pdbRecordType;
+         pdbRecordType = (dbRecordType *)ellNext(&pdbRecordType->node)) {
+        dbRecordNode *pdbRecordNode;
+
+        for (pdbRecordNode = (dbRecordNode *)ellFirst(&pdbRecordType->recList);
+             pdbRecordNode;
+             pdbRecordNode = (dbRecordNode *)ellNext(&pdbRecordNode->node)) {
+            dbCommon *precord = pdbRecordNode->precord;
+            int *pcount;
+            int drops;
+
+            if (!precord->name[0] ||
+                pdbRecordNode->flags & DBRN_FLAGS_ISALIAS)
+                continue;
+
+            pcount = &dbRec2Pvt(precord)->dropCount;
+            drops = epicsAtomicGetIntT(pcount);
+            if (!drops)
+                continue;
+            printf("    %-28s %d requests dropped\n", precord->name, drops);
+            if (reset)
+                epicsAtomicAddIntT(pcount, -drops);
+        }
     }
+    return 0;
+}
+
+static void initOnce(void)
+{
+    if (onceQueueSize < 1)
+        onceQueueSize = 1;
+    onceQ = callocMustSucceed(onceQueueSize, sizeof(onceEntry), "initOnce");
+    onceQSize = onceQueueSize;
+    onceQHead = onceQUsed = onceQMaxUsed = 0;
+    onceLock = epicsSpinMustCreate();
     if(!onceSem)
         onceSem = epicsEventMustCreate(epicsEventEmpty);
+    if(!onceSpace)
+        onceSpace = epicsEventMustCreate(epicsEventEmpty);
     onceTaskId = epicsThreadCreate("scanOnce",
         epicsThreadPriorityScanLow + nPeriodic,
         epicsThreadGetStackSize(epicsThreadStackBig), onceTask, 0);
@@ -795,8 +1250,12 @@ static void periodicTask(void *arg)
         double delay;
         epicsTimeStamp now;
 
-        if (ppsl->scanCtl == ctlRun)
-            scanList(&ppsl->scan_list);
+        if (ppsl->scanCtl == ctlRun) {
+            if (ppsl->pworkers)
+                scanListParallel(ppsl);
+            else
+                scanList(&ppsl->scan_list);
+        }
 
         epicsTimeAddSeconds(&next, ppsl->period);
         epicsTimeGetMonotonic(&now);
@@ -824,6 +1283,17 @@ static void periodicTask(void *arg)
                     "\tTo fix this, move some records to a slower scan rate.\n",
                     ppsl->name, ppsl->period + overtime / overruns,
                     ppsl->period + over_min, ppsl->period + over_max, overruns);
+                if (ppsl->pworkers) {
+                    int w;
+
+                    for (w = 0; w < ppsl->nWorkers; w++) {
+                        periodic_scan_worker *pw = &ppsl->pworkers[w];
+
+                        errlogPrintf("\tWorker %d took %.3f seconds "
+                            "(max %.3f) for %lu records.\n", w, pw->elapsed,
+                            pw->elapsedMax, (unsigned long)pw->nrecs);
+                    }
+                }
 
                 reported = now;
                 if (report_delay < (OVERRUN_REPORT_MAX / 2))
@@ -841,10 +1311,44 @@ static void periodicTask(void *arg)
         epicsEventWaitWithTimeout(ppsl->loopEvent, delay);
     }
 
+    if (ppsl->nWorkers > 1) {
+        int w;
+
+        /* Workers see scanCtl == ctlExit and report back once */
+        epicsAtomicSetIntT(&ppsl->workersBusy, ppsl->nWorkers - 1);
+        for (w = 1; w < ppsl->nWorkers; w++)
+            epicsEventMustTrigger(ppsl->pworkers[w].loopEvent);
+        epicsEventMustWait(ppsl->workersDone);
+    }
+
     taskwdRemove(0);
     epicsEventSignal(startStopEvent);
 }
 
+static void periodicWorkerTask(void *arg)
+{
+    periodic_scan_worker *pw = (periodic_scan_worker *)arg;
+    periodic_scan_list *ppsl = pw->ppsl;
+
+    taskwdInsert(0, NULL, NULL);
+    epicsEventSignal(startStopEvent);
+
+    while (TRUE) {
+        int exiting;
+
+        epicsEventMustWait(pw->loopEvent);
+        exiting = (ppsl->scanCtl == ctlExit);
+        if (!exiting)
+            scanRecords(pw);
+        if (!epicsAtomicDecrIntT(&ppsl->workersBusy))
+            epicsEventMustTrigger(ppsl->workersDone);
+        if (exiting)
+            break;
+    }
+
+    taskwdRemove(0);
+}
+
 
 static void initPeriodic(void)
 {
@@ -900,6 +1404,22 @@ static void initPeriodic(void)
         ppsl->scanCtl = ctlPause;
         ppsl->loopEvent = epicsEventMustCreate(epicsEventEmpty);
 
+        ppsl->nWorkers = 1;
+        if (i + SCAN_1ST_PERIODIC < nPeriodicWorkersConfigured &&
+            periodicWorkersConfigured[i + SCAN_1ST_PERIODIC] > 1) {
+            int w;
+
+            ppsl->nWorkers = periodicWorkersConfigured[i + SCAN_1ST_PERIODIC];
+            ppsl->pworkers = dbCalloc(ppsl->nWorkers,
+                sizeof(periodic_scan_worker));
+            ppsl->workersDone = epicsEventMustCreate(epicsEventEmpty);
+            for (w = 0; w < ppsl->nWorkers; w++) {
+                ppsl->pworkers[w].ppsl = ppsl;
+                ppsl->pworkers[w].loopEvent =
+                    epicsEventMustCreate(epicsEventEmpty);
+            }
+        }
+
         number = ppsl->period / quantum;
         if ((ppsl->period < 2 * quantum) ||
             (number / floor(number) > 1.1)) {
@@ -919,6 +1439,16 @@ static void deletePeriodic(void)
         periodic_scan_list *ppsl = papPeriodic[i];
 
         if (!ppsl) continue;
+        if (ppsl->pworkers) {
+            int w;
+
+            for (w = 0; w < ppsl->nWorkers; w++) {
+                epicsEventDestroy(ppsl->pworkers[w].loopEvent);
+                free(ppsl->pworkers[w].precs);
+            }
+            free(ppsl->pworkers);
+            epicsEventDestroy(ppsl->workersDone);
+        }
         ellFree(&ppsl->scan_list.list);
         epicsEventDestroy(ppsl->loopEvent);
         epicsMutexDestroy(ppsl->scan_list.lock);
@@ -932,10 +1462,28 @@ static void deletePeriodic(void)
 static void spawnPeriodic(int ind)
 {
     periodic_scan_list *ppsl = papPeriodic[ind];
-    char taskName[20];
+    char taskName[32];
+    int w;
 
     if (!ppsl) return;
 
+    for (w = 1; w < ppsl->nWorkers; w++) {
+        epicsThreadId tid;
+
+        sprintf(taskName, "scan-%g-%d", ppsl->period, w);
+        tid = epicsThreadCreate(
+            taskName, epicsThreadPriorityScanLow + ind,
+            epicsThreadGetStackSize(epicsThreadStackBig),
+            periodicWorkerTask, (void *)&ppsl->pworkers[w]);
+        if (!tid) {
+            errlogPrintf("spawnPeriodic: Failed to spawn %s, "
+                "using %d workers\n", taskName, w);
+            ppsl->nWorkers = w;
+            break;
+        }
+        epicsEventWait(startStopEvent);
+    }
+
     sprintf(taskName, "scan-%g", ppsl->period);
     periodicTaskId[ind] = epicsThreadCreate(
         taskName, epicsThreadPriorityScanLow + ind,
@@ -952,6 +1500,7 @@ static void ioscanCallback(epicsCallback *pcallback)
 
     callbackGetUser(piosh, pcallback);
     callbackGetPriority(prio, pcallback);
+    countListDrops(&piosh->iosl[prio]);
     scanList(&piosh->iosl[prio].scan_list);
     if (piosh->cb)
         piosh->cb(piosh->arg, piosh, prio);
@@ -991,6 +1540,7 @@ static void scanList(scan_list *psl)
     scan_element *pse;
     scan_element *prev = NULL;
     scan_element *next = NULL;
+    epicsUInt64 requested = dbProcessProfiling ? epicsMonotonicGet() : 0;
 
     epicsMutexMustLock(psl->lock);
     psl->modified = FALSE;
@@ -1002,6 +1552,8 @@ static void scanList(scan_list *psl)
         struct dbCommon *precord = pse->precord;
 
         dbScanLock(precord);
+        if (requested)
+            dbProfileScanRequest(precord, requested);
         dbProcess(precord);
         dbScanUnlock(precord);
 
@@ -1039,6 +1591,119 @@ static void scanList(scan_list *psl)
     }
 }
 
+/* Split a periodic scan list between its workers.  All records in
+ * the same lock set go to the same worker, so workers rarely contend
+ * for lock sets and the PHAS order is kept within each lock set.
+ * The split is only redone after records join or leave the list, lock
+ * sets merged or split since then just cost some contention.
+ */
+static void partitionList(periodic_scan_list *ppsl)
+{
+    scan_list *psl = &ppsl->scan_list;
+    scan_element *pse;
+    int w;
+
+    epicsMutexMustLock(psl->lock);
+    if (!psl->modified) {
+        epicsMutexUnlock(psl->lock);
+        return;
+    }
+    psl->modified = FALSE;
+    for (w = 0; w < ppsl->nWorkers; w++)
+        ppsl->pworkers[w].nrecs = 0;
+    for (pse = (scan_element *)ellFirst(&psl->list); pse;
+         pse = (scan_element *)ellNext(&pse->node)) {
+        periodic_scan_worker *pw =
+            &ppsl->pworkers[dbLockGetLockId(pse->precord) % ppsl->nWorkers];
+
+        if (pw->nrecs == pw->maxrecs) {
+            size_t newmax = pw->maxrecs ? 2 * pw->maxrecs : 64;
+            struct dbCommon **pnew = realloc(pw->precs,
+                newmax * sizeof(struct dbCommon *));
+
+            if (!pnew) {
+                errlogPrintf("dbScan: No memory to partition '%s' list\n",
+                    ppsl->name);
+                psl->modified = TRUE;   /* try again next time */
+                break;
+            }
+            pw->precs = pnew;
+            pw->maxrecs = newmax;
+        }
+        pw->precs[pw->nrecs++] = pse->precord;
+    }
+    epicsMutexUnlock(psl->lock);
+}
+
+static void scanRecords(periodic_scan_worker *pw)
+{
+    scan_list *psl = &pw->ppsl->scan_list;
+    epicsTimeStamp start, end;
+    epicsUInt64 requested = dbProcessProfiling ? epicsMonotonicGet() : 0;
+    size_t i;
+
+    epicsTimeGetMonotonic(&start);
+    for (i = 0; i < pw->nrecs; i++) {
+        struct dbCommon *precord = pw->precs[i];
+        scan_element *pse;
+
+        dbScanLock(precord);
+        /* SCAN is only changed with the record locked, skip records
+         * that have left this list since it was partitioned.
+         */
+        pse = precord->spvt;
+        if (pse && pse->pscan_list == psl) {
+            if (requested)
+                dbProfileScanRequest(precord, requested);
+            dbProcess(precord);
+        }
+        dbScanUnlock(precord);
+    }
+    epicsTimeGetMonotonic(&end);
+
+    pw->elapsed = epicsTimeDiffInSeconds(&end, &start);
+    if (pw->elapsed > pw->elapsedMax)
+        pw->elapsedMax = pw->elapsed;
+    if (pw->elapsed > pw->ppsl->period)
+        pw->overruns++;
+}
+
+static void scanListParallel(periodic_scan_list *ppsl)
+{
+    int w;
+
+    partitionList(ppsl);
+
+    epicsAtomicSetIntT(&ppsl->workersBusy, ppsl->nWorkers - 1);
+    for (w = 1; w < ppsl->nWorkers; w++)
+        epicsEventMustTrigger(ppsl->pworkers[w].loopEvent);
+
+    scanRecords(&ppsl->pworkers[0]);
+
+    if (ppsl->nWorkers > 1)
+        epicsEventMustWait(ppsl->workersDone);
+}
+
+/* Charge the drops counted by scanIoRequest(), which may run in an
+ * interrupt handler, to the records on the list.
+ */
+static void countListDrops(io_scan_list *piosl)
+{
+    scan_list *psl = &piosl->scan_list;
+    scan_element *pse;
+    int drops = epicsAtomicGetIntT(&piosl->drops);
+
+    if (!drops)
+        return;
+    epicsAtomicAddIntT(&piosl->drops, -drops);
+
+    epicsMutexMustLock(psl->lock);
+    for (pse = (scan_element *)ellFirst(&psl->list); pse;
+         pse = (scan_element *)ellNext(&pse->node))
+        epicsAtomicAddIntT(&dbRec2Pvt(pse->precord)->dropCount, drops);
+    epicsMutexUnlock(psl->lock);
+}
+
 static void buildScanLists(void)
 {
     dbRecordType *pdbRecordType;
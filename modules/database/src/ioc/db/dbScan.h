@@ -50,6 +50,13 @@ typedef struct scanOnceQueueStats {
     int numOverflow;
 } scanOnceQueueStats;
 
+/* More statistics, kept apart so scanOnceQueueStats doesn't change */
+typedef struct scanOnceQueueExtStats {
+    int numCoalesced;
+    int numGrowths;
+    int limit;
+} scanOnceQueueExtStats;
+
 epicsShareFunc long scanInit(void);
 epicsShareFunc void scanRun(void);
 epicsShareFunc void scanPause(void);
@@ -65,8 +72,12 @@ epicsShareFunc double scanPeriod(int scan);
 epicsShareFunc int scanOnce(struct dbCommon *);
 epicsShareFunc int scanOnceCallback(struct dbCommon *, once_complete cb, void *usr);
 epicsShareFunc int scanOnceSetQueueSize(int size);
+epicsShareFunc int scanOnceSetQueueLimit(int limit, const char *policy);
 epicsShareFunc int scanOnceQueueStatus(const int reset, scanOnceQueueStats *result);
+epicsShareFunc int scanOnceQueueExtStatus(scanOnceQueueExtStats *result);
 epicsShareFunc void scanOnceQueueShow(const int reset);
+epicsShareFunc int scanPeriodicWorkers(int count, const char *rate);
+epicsShareFunc int scanDropShow(const int reset);
 
 /*print periodic lists*/
 epicsShareFunc int scanppl(double rate);
@@ -155,7 +155,7 @@ int dbChannel_get_count(
     * in the dbAccess.c dbGet() and getOptions() routines.
     */
 
-    dbScanLock(dbChannelRecord(chan));
+    dbScanLockRead(dbChannelRecord(chan));
 
     switch(buffer_type) {
     case(oldDBR_STRING):
@@ -799,7 +799,7 @@ int dbChannel_get_count(
         break;
     }
 
-    dbScanUnlock(dbChannelRecord(chan));
+    dbScanUnlockRead(dbChannelRecord(chan));
 
     if (status) return -1;
     return 0;
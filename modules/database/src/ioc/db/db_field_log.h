@@ -104,6 +104,9 @@ typedef struct db_field_log {
         struct dbfl_val v;
         struct dbfl_ref r;
     } u;
+    /* kept last so the members above stay where they were */
+    epicsUInt64    postTime;  /* epicsMonotonicGet() when posted, while
+                               * dbLatencyTracing is set, else 0 */
 } db_field_log;
 
 /*
@@ -17,6 +17,7 @@
 
 #include "dbDefs.h"
 #include "ellLib.h"
+#include "epicsAtomic.h"
 #include "epicsMutex.h"
 #include "epicsStdio.h"
 #include "epicsString.h"
@@ -39,6 +40,9 @@ typedef struct dbPvd {
 
 unsigned int dbPvdHashTableSize = 0;
 
+/* Changed whenever a name is added */
+static int dbPvdGen;
+
 #define MIN_SIZE 256
 #define DEFAULT_SIZE 512
 #define MAX_SIZE 65536
@@ -135,9 +139,15 @@ PVDENTRY *dbPvdAdd(dbBase *pdbbase, dbRecordType *precordType,
     ppvdNode->precnode = precnode;
     ellAdd(&pbucket->list, (ELLNODE *)ppvdNode);
     epicsMutexUnlock(pbucket->lock);
+    epicsAtomicIncrIntT(&dbPvdGen);
     return ppvdNode;
 }
 
+int dbPvdGeneration(void)
+{
+    return epicsAtomicGetIntT(&dbPvdGen);
+}
+
 void dbPvdDelete(dbBase *pdbbase, dbRecordNode *precnode)
 {
     dbPvd *ppvd = pdbbase->ppvd;
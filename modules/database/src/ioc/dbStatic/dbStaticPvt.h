@@ -107,6 +107,10 @@ void dbPvdInitPvt(DBBASE *pdbbase);
 PVDENTRY *dbPvdFind(DBBASE *pdbbase,const char *name,size_t lenname);
 PVDENTRY *dbPvdAdd(DBBASE *pdbbase,dbRecordType *precordType,dbRecordNode *precnode);
 void dbPvdDelete(DBBASE *pdbbase,dbRecordNode *precnode);
+/* Changes when a record or alias name is added, so results of
+ * failed name lookups can be kept until it does.
+ */
+epicsShareFunc int dbPvdGeneration(void);
 void dbPvdFreeMem(DBBASE *pdbbase);
 
 #ifdef __cplusplus
@@ -36,6 +36,7 @@
 #include "osiSock.h"
 
 #include "caerr.h"
+#include "caShm.h"
 #include "net_convert.h"
 
 #define epicsExportSharedSymbols
@@ -46,7 +47,10 @@
 #include "dbChannel.h"
 #include "dbCommon.h"
 #include "dbEvent.h"
+#include "db_convert.h"
 #include "db_field_log.h"
+#include "dbLatency.h"
+#include "dbLock.h"
 #include "dbNotify.h"
 #include "rsrv.h"
 #include "server.h"
@@ -420,6 +424,101 @@ static int tcp_echo_action ( caHdrLargeArray *mp,
     return RSRV_OK;
 }
 
+/*
+ * casClientIsLocal()
+ *
+ * Both ends of a TCP circuit have the same address only when
+ * the client runs on this host
+ */
+static int casClientIsLocal ( struct client *pClient )
+{
+    osiSockAddr local;
+    osiSocklen_t size = sizeof ( local );
+
+    if ( getsockname ( pClient->sock, &local.sa, &size ) < 0 ||
+            local.sa.sa_family != AF_INET ) {
+        return FALSE;
+    }
+    return local.ia.sin_addr.s_addr == pClient->addr.sin_addr.s_addr;
+}
+
+/*
+ * shm_action()
+ *
+ * Moves a circuit from a client on this host to shared memory rings,
+ * see caShm.h.  The client asks for a segment, maps the one offered
+ * and acknowledges over TCP, and only sends through the ring after
+ * that.  The acknowledgement is the last request read from the socket
+ * here, and the switch message the last reply sent over it.  Clients
+ * served by the rsrvIoThreads pool stay on TCP, their thread must not
+ * block waiting for the ring.
+ */
+static int shm_action ( caHdrLargeArray *mp, void *pPayload,
+    struct client *pClient )
+{
+    char *pName;
+    int status;
+
+    switch ( mp->m_dataType ) {
+    case CA_SHM_REQUEST:
+        status = ECA_NOSUPPORT;
+        if ( ! pClient->pShm && rsrvShmRingSize > 0 && caShmSupported () &&
+                ! pClient->ioPool && casClientIsLocal ( pClient ) ) {
+            pClient->pShm = caShmCreate ( (unsigned) rsrvShmRingSize );
+            status = pClient->pShm ? ECA_NORMAL : ECA_ALLOCMEM;
+        }
+        SEND_LOCK ( pClient );
+        if ( status == ECA_NORMAL ) {
+            status = cas_copy_in_header ( pClient, CA_PROTO_SHM,
+                CA_SHM_NAME_SIZE, CA_SHM_OFFER, 0u, ECA_NORMAL,
+                caShmRingSize ( pClient->pShm ), ( void * ) &pName );
+            if ( status == ECA_NORMAL ) {
+                memset ( pName, 0, CA_SHM_NAME_SIZE );
+                strcpy ( pName, caShmName ( pClient->pShm ) );
+                cas_commit_msg ( pClient, CA_SHM_NAME_SIZE );
+            }
+        }
+        else {
+            status = cas_copy_in_header ( pClient, CA_PROTO_SHM, 0u,
+                CA_SHM_OFFER, 0u, status, 0u, NULL );
+            if ( status == ECA_NORMAL ) {
+                cas_commit_msg ( pClient, 0u );
+            }
+        }
+        SEND_UNLOCK ( pClient );
+        return RSRV_OK;
+
+    case CA_SHM_ACK:
+        if ( ! pClient->pShm || pClient->shmRecv ) {
+            break;
+        }
+        caShmUnlink ( pClient->pShm );
+        if ( mp->m_cid != ECA_NORMAL ) {
+            caShmDestroy ( pClient->pShm );
+            pClient->pShm = NULL;
+            return RSRV_OK;
+        }
+        pClient->shmRecv = TRUE;
+
+        SEND_LOCK ( pClient );
+        status = cas_copy_in_header ( pClient, CA_PROTO_SHM, 0u,
+            CA_SHM_SWITCH, 0u, ECA_NORMAL, 0u, NULL );
+        if ( status == ECA_NORMAL ) {
+            cas_commit_msg ( pClient, 0u );
+            cas_send_bs_msg ( pClient, FALSE );
+            pClient->shmSend = TRUE;
+        }
+        SEND_UNLOCK ( pClient );
+        return status == ECA_NORMAL ? RSRV_OK : RSRV_ERROR;
+
+    default:
+        break;
+    }
+
+    log_header ( "CAS: bad shared memory request", pClient, mp, pPayload, 0 );
+    return RSRV_ERROR;
+}
+
 /*
  * events_on_action ()
  */
@@ -480,15 +579,253 @@ static void no_read_access_event ( struct client *pClient,
     }
 }
 
+static void stream_copy_free ( db_field_log *pfl )
+{
+    free ( pfl->u.r.field );
+}
+
 /*
- *  read_reply()
+ *  stream_copy_array()
+ *
+ *  Turn a record type field log into a reference to a copy of the
+ *  array, converted to the type requested, and the alarm and time
+ *  stamp that go with it.  Takes the record's read lock once, so the
+ *  reply can't mix two updates.  Returns a CA status.
  */
-static void read_reply ( void *pArg, struct dbChannel *dbch,
-                       int eventsRemaining, db_field_log *pfl )
+static int stream_copy_array ( struct dbChannel *dbch, db_field_log *pfl,
+    short dbrType, unsigned valSize )
+{
+    struct dbCommon *prec = dbChannelRecord ( dbch );
+    long n = dbch->addr.no_elements;
+    int status = ECA_ALLOCMEM;
+    void *p = calloc ( n > 0 ? n : 1, valSize );
+
+    pfl->type = dbfl_type_ref;
+    pfl->field_type = dbrType;
+    pfl->field_size = valSize;
+    pfl->no_elements = 0;
+    pfl->u.r.dtor = stream_copy_free;
+    pfl->u.r.pvt = NULL;
+    pfl->u.r.field = p;
+
+    dbScanLockRead ( prec );
+    pfl->stat = prec->stat;
+    pfl->sevr = prec->sevr;
+    pfl->time = prec->time;
+    if ( p ) {
+        if ( dbChannelGet ( dbch, dbrType, p, NULL, &n, NULL ) == 0 ) {
+            pfl->no_elements = n;
+            status = ECA_NORMAL;
+        }
+        else {
+            status = ECA_GETFAIL;
+        }
+    }
+    dbScanUnlockRead ( prec );
+    return status;
+}
+
+/*
+ *  stream_write()
+ *
+ *  Append size bytes to the payload being streamed
+ */
+static void stream_write ( struct client *pClient, const void *pData,
+    unsigned size )
+{
+    while ( size && ! pClient->disconnect ) {
+        unsigned space;
+        char *p = cas_stream_space ( pClient, size, &space );
+
+        if ( ! p ) {
+            pClient->disconnect = TRUE;
+            break;
+        }
+        if ( space > size ) {
+            space = size;
+        }
+        memcpy ( p, pData, space );
+        cas_stream_commit ( pClient, space );
+        pData = (const char *) pData + space;
+        size -= space;
+    }
+}
+
+/*
+ *  read_reply_stream()
+ *
+ *  Read (or subscription update) response for an array too large for
+ *  the small send buffers.  The value is converted straight into the
+ *  send buffers a piece at a time, full ones are queued or sent
+ *  meanwhile, so no buffer of the size of the whole message is needed.
+ *
+ *  The elements come from a stable copy: the snapshot or filtered
+ *  array of the field log, else a copy of the record's array made
+ *  here with its alarm and time stamp, under one read lock.  The
+ *  metadata and the first element are fetched from that copy before
+ *  the header is sent, so that a failure can still be reported in it.
+ *
+ *  The caller holds the send lock.
+ */
+static void read_reply_stream ( struct event_ext *pevext,
+    struct dbChannel *dbch, db_field_log *pfl, long item_count,
+    int autosize, ca_uint32_t payload_size )
+{
+    struct client *pClient = pevext->pciu->client;
+    const unsigned dataType = pevext->msg.m_dataType;
+    const unsigned plainType = dataType % ( LAST_TYPE + 1 );
+    const short dbrType = dbDBRoldToDBFnew[plainType];
+    const unsigned valSize = dbr_value_size[plainType];
+    union db_access_val scratch;
+    db_field_log *pcopy = NULL;
+    ca_uint32_t cid = ECA_NORMAL;
+    long nData = 0, nFirst, i;
+    unsigned firstSize;
+    int status;
+
+    if ( rsrvLargeBufFreeListTCP && payload_size >
+            rsrvSizeofLargeBufTCP - sizeof ( caHdr ) - 2 * sizeof ( ca_uint32_t ) ) {
+        send_err ( &pevext->msg, ECA_TOLARGE, pClient,
+            "server unable to load read (or subscription update) response "
+            "into protocol buffer PV=\"%s\" dbf=%u count=%ld avail=%u max bytes=%u",
+            RECORD_NAME ( dbch ), dataType, item_count, pevext->msg.m_available, rsrvSizeofLargeBufTCP );
+        return;
+    }
+
+    if ( ! asCheckGet ( pevext->pciu->asClientPVT ) ) {
+        status = cas_stream_header ( pClient, pevext->msg.m_cmmd, pevext->size,
+            dataType, pevext->msg.m_count, ECA_NORDACCESS,
+            pevext->msg.m_available );
+        if ( status == ECA_NORMAL ) {
+            cas_stream_end ( pClient );
+        }
+        else {
+            send_err ( &pevext->msg, status, pClient,
+                "server unable to load read access denied response into protocol buffer PV=\"%s\" dbf=%u count=%u avail=%u max bytes=%u",
+                RECORD_NAME ( dbch ), dataType, pevext->msg.m_count, pevext->msg.m_available, rsrvSizeofLargeBufTCP );
+        }
+        return;
+    }
+
+    /* a read runs the filters here, see read_reply_locked() */
+    if ( ! pfl ) {
+        pfl = pcopy = db_create_read_log ( dbch );
+        if ( pcopy && ( ellCount ( &dbch->pre_chain ) ||
+                ellCount ( &dbch->post_chain ) ) ) {
+            pcopy = dbChannelRunPreChain ( dbch, pcopy );
+            if ( pcopy ) {
+                pcopy = dbChannelRunPostChain ( dbch, pcopy );
+            }
+            if ( ! pcopy ) {
+                /* dropped by a filter, read the record instead */
+                pcopy = db_create_read_log ( dbch );
+            }
+            pfl = pcopy;
+        }
+    }
+    if ( pfl && pfl->type == dbfl_type_rec ) {
+        if ( ! pcopy ) {
+            pfl = pcopy = db_create_read_log ( dbch );
+        }
+        if ( pcopy ) {
+            cid = stream_copy_array ( dbch, pcopy, dbrType, valSize );
+        }
+    }
+    if ( ! pfl ) {
+        cid = ECA_ALLOCMEM;
+    }
+
+    if ( cid == ECA_NORMAL ) {
+        nData = pfl->no_elements;
+        if ( ! autosize && nData > item_count ) {
+            nData = item_count;
+        }
+
+        /* metadata and first element */
+        memset ( &scratch, 0, sizeof ( scratch ) );
+        nFirst = nData > 0 ? 1 : 0;
+        if ( dbChannel_get_count ( dbch, dataType, &scratch, &nFirst, pfl ) < 0 ) {
+            cid = ECA_GETFAIL;
+        }
+        else {
+            if ( nFirst < 1 ) {
+                nData = 0;
+            }
+            cid = caNetConvert ( dataType, &scratch, &scratch,
+                TRUE /* host -> net format */, 1 );
+        }
+    }
+    if ( cid != ECA_NORMAL ) {
+        /* as in read_reply_locked() */
+        nData = 0;
+    }
+    if ( autosize ) {
+        item_count = nData;
+        payload_size = dbr_size_n ( dataType, nData );
+    }
+
+    status = cas_stream_header ( pClient, pevext->msg.m_cmmd, payload_size,
+        dataType, item_count, cid, pevext->msg.m_available );
+    if ( status != ECA_NORMAL ) {
+        send_err ( &pevext->msg, status, pClient,
+            "server unable to load read (or subscription update) response "
+            "into protocol buffer PV=\"%s\" dbf=%u count=%ld avail=%u max bytes=%u",
+            RECORD_NAME ( dbch ), dataType, item_count, pevext->msg.m_available, rsrvSizeofLargeBufTCP );
+        if ( pcopy ) {
+            db_delete_field_log ( pcopy );
+        }
+        return;
+    }
+
+    if ( cid == ECA_NORMAL ) {
+        firstSize = dbr_size_n ( dataType, nData > 0 ? 1 : 0 );
+        stream_write ( pClient, &scratch, firstSize );
+
+        /* the remaining elements, converted in place */
+        for ( i = 1; i < nData && ! pClient->disconnect; ) {
+            db_field_log subfl = *pfl;
+            unsigned space;
+            long n;
+            char *p = cas_stream_space ( pClient, valSize, &space );
+
+            if ( ! p ) {
+                pClient->disconnect = TRUE;
+                break;
+            }
+            n = space / valSize;
+            if ( n > nData - i ) {
+                n = nData - i;
+            }
+            subfl.u.r.field = (char *) pfl->u.r.field + i * pfl->field_size;
+            subfl.u.r.dtor = NULL;
+            subfl.no_elements = pfl->no_elements - i;
+            if ( dbChannelGet ( dbch, dbrType, p, NULL, &n, &subfl ) ||
+                    caNetConvert ( plainType, p, p, TRUE, n ) != ECA_NORMAL ) {
+                /* the header is gone, just zero the rest */
+                break;
+            }
+            cas_stream_commit ( pClient, n * valSize );
+            i += n;
+        }
+    }
+    cas_stream_end ( pClient );
+
+    if ( pcopy ) {
+        db_delete_field_log ( pcopy );
+    }
+}
+
+/*
+ *  read_reply_copy()
+ *
+ *  Copy one read (or subscription update) response into the send buffer.
+ *  The caller holds the send lock and decides when to flush.
+ */
+static void read_reply_copy ( struct event_ext *pevext,
+                       struct dbChannel *dbch, db_field_log *pfl )
 {
     ca_uint32_t cid;
     void *pPayload;
-    struct event_ext *pevext = pArg;
     struct client *pClient = pevext->pciu->client;
     struct channel_in_use *pciu = pevext->pciu;
     const int readAccess = asCheckGet ( pciu->asClientPVT );
@@ -499,8 +836,6 @@ static void read_reply ( void *pArg, struct dbChannel *dbch,
     ca_uint32_t payload_size;
     dbAddr *paddr=&dbch->addr;
 
-    SEND_LOCK ( pClient );
-
     cid = ECA_NORMAL;
 
     /* If the client has requested a zero element count we interpret this as a
@@ -510,6 +845,18 @@ static void read_reply ( void *pArg, struct dbChannel *dbch,
     item_count =
         autosize ? paddr->no_elements : pevext->msg.m_count;
     payload_size = dbr_size_n(pevext->msg.m_dataType, item_count);
+
+    /* Arrays larger than the small buffers are streamed */
+    if ( pClient->proto == IPPROTO_TCP &&
+            payload_size > MAX_TCP - sizeof ( caHdr ) - 2 * sizeof ( ca_uint32_t ) &&
+            pevext->msg.m_dataType <= DBR_CTRL_DOUBLE &&
+            paddr->field_type <= newDBF_DEVICE &&
+            paddr->special != SPC_ATTRIBUTE ) {
+        read_reply_stream ( pevext, dbch, pfl, item_count, autosize,
+            payload_size );
+        return;
+    }
+
     status = cas_copy_in_header(
         pClient, pevext->msg.m_cmmd, payload_size,
         pevext->msg.m_dataType, item_count, cid, pevext->msg.m_available,
@@ -519,9 +866,6 @@ static void read_reply ( void *pArg, struct dbChannel *dbch,
             "server unable to load read (or subscription update) response "
             "into protocol buffer PV=\"%s\" dbf=%u count=%ld avail=%u max bytes=%u",
             RECORD_NAME ( dbch ), pevext->msg.m_dataType, item_count, pevext->msg.m_available, rsrvSizeofLargeBufTCP );
-        if ( ! eventsRemaining )
-            cas_send_bs_msg ( pClient, FALSE );
-        SEND_UNLOCK ( pClient );
         return;
     }
 
@@ -530,9 +874,6 @@ static void read_reply ( void *pArg, struct dbChannel *dbch,
      */
     if ( ! readAccess ) {
         no_read_access_event ( pClient, pevext );
-        if ( ! eventsRemaining )
-            cas_send_bs_msg ( pClient, FALSE );
-        SEND_UNLOCK ( pClient );
         return;
     }
 
@@ -594,6 +935,45 @@ static void read_reply ( void *pArg, struct dbChannel *dbch,
         }
         cas_commit_msg ( pClient, payload_size );
     }
+}
+
+/*
+ *  read_reply_locked()
+ *
+ *  read_reply_copy(), timing the updates traced by dbLatencyTracing
+ */
+static void read_reply_locked ( struct event_ext *pevext,
+                       struct dbChannel *dbch, db_field_log *pfl )
+{
+    struct client *pClient = pevext->pciu->client;
+    epicsUInt64 start;
+
+    if ( ! pfl || ! pfl->postTime ) {
+        read_reply_copy ( pevext, dbch, pfl );
+        return;
+    }
+
+    /* before the copy, which may send a large array */
+    if ( ! pClient->tracePosted || pfl->postTime < pClient->tracePosted ) {
+        pClient->tracePosted = pfl->postTime;
+    }
+    start = epicsMonotonicGet ();
+    read_reply_copy ( pevext, dbch, pfl );
+    dbLatencySample ( dbLatSerialize, start, epicsMonotonicGet () );
+}
+
+/*
+ *  read_reply()
+ */
+static void read_reply ( void *pArg, struct dbChannel *dbch,
+                       int eventsRemaining, db_field_log *pfl )
+{
+    struct event_ext *pevext = pArg;
+    struct client *pClient = pevext->pciu->client;
+
+    SEND_LOCK ( pClient );
+
+    read_reply_locked ( pevext, dbch, pfl );
 
     /*
      * Ensures timely response for events, but does queue
@@ -604,7 +984,43 @@ static void read_reply ( void *pArg, struct dbChannel *dbch,
 
     SEND_UNLOCK ( pClient );
 
-    return;
+    if ( ! eventsRemaining )
+        casSendThrottle ( pClient );
+}
+
+/*
+ *  rsrv_event_batch()
+ *
+ *  Subscription updates from the event task, taking the send lock
+ *  once for the whole batch.
+ */
+void rsrv_event_batch ( void *pArg, dbEventBatchEntry *pEntries,
+                       unsigned count, int eventsRemaining )
+{
+    struct client *pClient = pArg;
+    unsigned i;
+
+    SEND_LOCK ( pClient );
+
+    for ( i = 0; i < count; i++ ) {
+        dbEventBatchEntry *pent = &pEntries[i];
+
+        if ( pent->user_sub == read_reply ) {
+            read_reply_locked ( pent->user_arg, pent->chan, pent->pfl );
+        }
+        else {
+            ( *pent->user_sub ) ( pent->user_arg, pent->chan,
+                TRUE, pent->pfl );
+        }
+    }
+
+    if ( ! eventsRemaining )
+        cas_send_bs_msg ( pClient, FALSE );
+
+    SEND_UNLOCK ( pClient );
+
+    if ( ! eventsRemaining )
+        casSendThrottle ( pClient );
 }
 
 /*
@@ -1454,6 +1870,9 @@ static void write_notify_reply ( struct client * pClient )
      * wakeup the TCP thread if it is waiting for a cb to complete
      */
     epicsEventSignal ( pClient->blockSem );
+    if ( pClient->ioPool ) {
+        casIoPoolResume ( pClient );
+    }
 }
 
 /*
@@ -1501,6 +1920,7 @@ void rsrv_extra_labor ( void * pArg )
     write_notify_reply ( pClient );
     sendAllUpdateAS ( pClient );
     cas_send_bs_msg ( pClient, TRUE );
+    casSendThrottle ( pClient );
 }
 
 /*
@@ -1655,6 +2075,49 @@ void rsrvFreePutNotify ( client *pClient,
      }
 }
 
+/*
+ * putNotifyTimeout()
+ *
+ * Cancel a put callback request which didn't complete in time
+ */
+static void putNotifyTimeout ( struct client *client,
+                               struct channel_in_use *pciu )
+{
+    char busyTmp;
+    void * asWritePvtTmp = 0;
+
+    epicsMutexMustLock(client->putNotifyLock);
+    busyTmp = pciu->pPutNotify->busy;
+    epicsMutexUnlock(client->putNotifyLock);
+
+    /*
+     * if any possibility of put notify still running
+     * then cancel it
+     */
+    if ( busyTmp ) {
+        dbNotifyCancel(&pciu->pPutNotify->dbPutNotify);
+    }
+    epicsMutexMustLock(client->putNotifyLock);
+    busyTmp = pciu->pPutNotify->busy;
+    if ( busyTmp ) {
+        if ( pciu->pPutNotify->onExtraLaborQueue ) {
+            ellDelete ( &client->putNotifyQue,
+                        &pciu->pPutNotify->node );
+        }
+        pciu->pPutNotify->busy = FALSE;
+        asWritePvtTmp = pciu->pPutNotify->asWritePvt;
+        pciu->pPutNotify->asWritePvt = 0;
+    }
+    epicsMutexUnlock(client->putNotifyLock);
+
+    if ( busyTmp ) {
+        log_header("put call back time out", client,
+            &pciu->pPutNotify->msg, pciu->pPutNotify->pbuffer, 0);
+        asTrapWriteAfter ( asWritePvtTmp );
+        putNotifyErrorReply (client, &pciu->pPutNotify->msg, ECA_PUTCBINPROG);
+    }
+}
+
 /*
  * write_notify_action()
  */
@@ -1691,46 +2154,37 @@ static int write_notify_action ( caHdrLargeArray *mp, void *pPayload,
          */
         epicsMutexMustLock(client->putNotifyLock);
         while(pciu->pPutNotify->busy){
+            /* only a completion from now on resumes the client */
+            client->ioWoken = FALSE;
             epicsMutexUnlock(client->putNotifyLock);
-            status = epicsEventWaitWithTimeout(client->blockSem,60.0);
-            if ( status != epicsEventWaitOK ) {
-                char busyTmp;
-                void * asWritePvtTmp = 0;
-
-                epicsMutexMustLock(client->putNotifyLock);
-                busyTmp = pciu->pPutNotify->busy;
-                epicsMutexUnlock(client->putNotifyLock);
-
+            if ( client->ioPool ) {
                 /*
-                 * if any possibility of put notify still running
-                 * then cancel it
+                 * a pool thread doesn't wait, the request is handled
+                 * again when casIoPoolResume() re-arms the client
                  */
-                if ( busyTmp ) {
-                    dbNotifyCancel(&pciu->pPutNotify->dbPutNotify);
-                }
-                epicsMutexMustLock(client->putNotifyLock);
-                busyTmp = pciu->pPutNotify->busy;
-                if ( busyTmp ) {
-                    if ( pciu->pPutNotify->onExtraLaborQueue ) {
-                        ellDelete ( &client->putNotifyQue,
-                                    &pciu->pPutNotify->node );
-                    }
-                    pciu->pPutNotify->busy = FALSE;
-                    asWritePvtTmp = pciu->pPutNotify->asWritePvt;
-                    pciu->pPutNotify->asWritePvt = 0;
-                }
-                epicsMutexUnlock(client->putNotifyLock);
+                epicsUInt64 now = epicsMonotonicGet ();
 
-                if ( busyTmp ) {
-                    log_header("put call back time out", client,
-                        &pciu->pPutNotify->msg, pciu->pPutNotify->pbuffer, 0);
-                    asTrapWriteAfter ( asWritePvtTmp );
-                    putNotifyErrorReply (client, &pciu->pPutNotify->msg, ECA_PUTCBINPROG);
+                if ( ! client->ioPutWaitStart ) {
+                    client->ioPutWaitStart = now;
                 }
+                if ( now - client->ioPutWaitStart <
+                        (epicsUInt64) ( CAS_PUT_NOTIFY_WAIT * 1e9 ) ) {
+                    client->ioStopped = CAS_IO_STOP_PUT;
+                    return RSRV_OK;
+                }
+                status = epicsEventWaitTimeout;
+            }
+            else {
+                status = epicsEventWaitWithTimeout(client->blockSem,
+                    CAS_PUT_NOTIFY_WAIT);
+            }
+            if ( status != epicsEventWaitOK ) {
+                putNotifyTimeout ( client, pciu );
             }
             epicsMutexMustLock(client->putNotifyLock);
         }
         epicsMutexUnlock(client->putNotifyLock);
+        client->ioPutWaitStart = 0u;
     }
     else {
         pciu->pPutNotify = rsrvAllocPutNotify ( pciu );
@@ -1849,6 +2303,22 @@ static int event_add_action (caHdrLargeArray *mp, void *pPayload, struct client
         return RSRV_ERROR;
     }
 
+    /*
+     * if rsrvClientPeriods is set, a client asking for a period between
+     * samples gets only the latest update in each period, unless a
+     * channel filter asks for longer.  Off by default, as clients have
+     * sent anything in m_toval for years without effect.
+     */
+    if ( rsrvClientPeriods ) {
+        ca_float32_t period;
+
+        if ( caNetConvert ( DBR_FLOAT, &pmi->m_toval, &period,
+                FALSE, 1 ) == ECA_NORMAL &&
+                period > pciu->dbch->min_interval ) {
+            db_event_min_interval ( pevext->pdbev, period );
+        }
+    }
+
     /*
      * always send it once at event add
      */
@@ -2191,10 +2661,15 @@ static int search_reply_udp ( caHdrLargeArray *mp, void *pPayload, struct client
     pName[mp->m_postsize-1] = '\0';
 
     /* Exit quickly if channel not on this node */
-    if (dbChannelTest(pName)) {
+    if (casChannelTest(pName)) {
         DLOG ( 2, ( "CAS: Lookup for channel \"%s\" failed\n", pPayLoad ) );
+        CAS_STAT_INCR ( searchMisses );
+        /* clients only ask for this when searching a single server */
+        if (mp->m_dataType == DOREPLY)
+            search_fail_reply ( mp, pPayload, client );
         return RSRV_OK;
     }
+    CAS_STAT_INCR ( searchHits );
 
     /*
      * stop further use of server if memory becomes scarce
@@ -2278,12 +2753,14 @@ static int search_reply_tcp (
     pName[mp->m_postsize-1] = '\0';
 
     /* Exit quickly if channel not on this node */
-    if (dbChannelTest(pName)) {
+    if (casChannelTest(pName)) {
         DLOG ( 2, ( "CAS: Lookup for channel \"%s\" failed\n", pPayLoad ) );
+        CAS_STAT_INCR ( searchMisses );
         if (mp->m_dataType == DOREPLY)
             search_fail_reply ( mp, pPayload, client );
         return RSRV_OK;
     }
+    CAS_STAT_INCR ( searchHits );
 
     /*
      * stop further use of server if memory becomes scarse
@@ -2347,7 +2824,8 @@ static const pProtoStubTCP tcpJumpTable[] =
     bad_tcp_cmd_action,
     bad_tcp_cmd_action,
     bad_tcp_cmd_action,
-    bad_tcp_cmd_action
+    bad_tcp_cmd_action,
+    shm_action
 };
 
 /*
@@ -2383,6 +2861,7 @@ static const pProtoStubUDP udpJumpTable[] =
     bad_udp_cmd_action,
     bad_udp_cmd_action,
     bad_udp_cmd_action,
+    bad_udp_cmd_action,
     bad_udp_cmd_action
 };
 
@@ -2426,6 +2905,13 @@ int camessage ( struct client *client )
             break;
         }
 
+        /* a pool thread leaves the requests of a slow client for later */
+        if ( client->ioPool && casSendBacklog ( client ) ) {
+            client->ioStopped = CAS_IO_STOP_SEND;
+            status = RSRV_OK;
+            break;
+        }
+
         mp = (caHdr *) &client->recv.buf[client->recv.stk];
         msg.m_cmmd      = ntohs ( mp->m_cmmd );
         msg.m_postsize  = ntohs ( mp->m_postsize );
@@ -2525,6 +3011,8 @@ int camessage ( struct client *client )
         }
 
         nmsg++;
+        CAS_STAT_INCR ( msgs[msg.m_cmmd < CAS_STAT_NCMMD ?
+            msg.m_cmmd : CAS_STAT_NCMMD] );
 
         if ( CASDEBUG > 2 )
             log_header (NULL, client, &msg, pBody, nmsg);
@@ -2549,6 +3037,10 @@ int camessage ( struct client *client )
                     status = RSRV_ERROR;
                     break;
                 }
+                /* the request is handled again when the pool resumes */
+                if ( client->ioStopped ) {
+                    break;
+                }
             }
             else {
                 return bad_tcp_cmd_action ( &msg, pBody, client );
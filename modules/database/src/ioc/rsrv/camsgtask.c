@@ -28,6 +28,7 @@
 #include "taskwd.h"
 
 #include "caerr.h"
+#include "caShm.h"
 
 #define epicsExportSharedSymbols
 #include "db_access.h"
@@ -35,123 +36,206 @@
 #include "server.h"
 
 /*
- *  camsgtask()
+ *  camsgrecvShm()
  *
- *  CA server TCP client task (one spawned for each client)
+ *  Receive through the shared memory ring, waiting on the socket
+ *  for a wakeup byte while it is empty.  Returns as recv().
  */
-void camsgtask ( void *pParm )
+static long camsgrecvShm ( struct client *client, char *pBuf, unsigned nBytes )
 {
-    struct client *client = (struct client *) pParm;
+    char wakeup[64];
+    long nchars;
 
-    casAttachThreadToClient ( client );
+    while ( TRUE ) {
+        nchars = (long) caShmRead ( client->pShm, pBuf, nBytes );
+        if ( nchars > 0 ) {
+            return nchars;
+        }
+        if ( caShmWaitArm ( client->pShm ) ) {
+            continue;
+        }
+        nchars = recv ( client->sock, wakeup, sizeof ( wakeup ), 0 );
+        if ( nchars <= 0 ) {
+            return nchars;
+        }
+    }
+}
 
-    while (castcp_ctl == ctlRun && !client->disconnect) {
-        osiSockIoctl_t check_nchars;
-        long nchars;
-        int status;
+/*
+ *  camsgrecv()
+ *
+ *  Receive from a TCP client once, and process any complete messages.
+ *  Returns RSRV_ERROR when the client must be disconnected.
+ */
+int camsgrecv ( struct client *client )
+{
+    osiSockIoctl_t check_nchars;
+    long nchars;
+    int status;
 
-        /*
-         * allow message to batch up if more are comming
-         */
+    /*
+     * allow message to batch up if more are comming,
+     * the I/O pool flushes after receiving instead
+     */
+    if ( client->ioPool ) {
+        status = 0;
+        check_nchars = 1;
+    }
+    else if ( client->shmRecv ) {
+        status = 0;
+        check_nchars = caShmPending ( client->pShm );
+    }
+    else {
         status = socket_ioctl (client->sock, FIONREAD, &check_nchars);
-        if (status < 0) {
-            char sockErrBuf[64];
+    }
+    if (status < 0) {
+        char sockErrBuf[64];
 
-            epicsSocketConvertErrnoToString (
-                sockErrBuf, sizeof ( sockErrBuf ) );
-            errlogPrintf("CAS: FIONREAD error: %s\n",
-                sockErrBuf);
-            cas_send_bs_msg(client, TRUE);
+        epicsSocketConvertErrnoToString (
+            sockErrBuf, sizeof ( sockErrBuf ) );
+        errlogPrintf("CAS: FIONREAD error: %s\n",
+            sockErrBuf);
+        cas_send_bs_msg(client, TRUE);
+    }
+    else if (check_nchars == 0){
+        cas_send_bs_msg(client, TRUE);
+    }
+
+    client->recv.stk = 0;
+    assert ( client->recv.maxstk >= client->recv.cnt );
+    if ( client->shmRecv ) {
+        nchars = camsgrecvShm ( client, &client->recv.buf[client->recv.cnt],
+            client->recv.maxstk - client->recv.cnt );
+    }
+    else {
+        nchars = recv ( client->sock, &client->recv.buf[client->recv.cnt],
+            (int) ( client->recv.maxstk - client->recv.cnt ), 0 );
+    }
+    if ( nchars == 0 ){
+        if ( CASDEBUG > 0 ) {
+            /* convert to u long so that %lu works on both 32 and 64 bit archs */
+            unsigned long cnt = sizeof ( client->recv.buf ) - client->recv.cnt;
+            errlogPrintf ( "CAS: nill message disconnect ( %lu bytes request )\n",
+                cnt );
         }
-        else if (check_nchars == 0){
-            cas_send_bs_msg(client, TRUE);
+        return RSRV_ERROR;
+    }
+    else if ( nchars < 0 ) {
+        int anerrno = SOCKERRNO;
+
+        if ( anerrno == SOCK_EINTR ) {
+            return RSRV_OK;
         }
 
-        client->recv.stk = 0;
-        assert ( client->recv.maxstk >= client->recv.cnt );
-        nchars = recv ( client->sock, &client->recv.buf[client->recv.cnt],
-                (int) ( client->recv.maxstk - client->recv.cnt ), 0 );
-        if ( nchars == 0 ){
-            if ( CASDEBUG > 0 ) {
-                /* convert to u long so that %lu works on both 32 and 64 bit archs */
-                unsigned long cnt = sizeof ( client->recv.buf ) - client->recv.cnt;
-                errlogPrintf ( "CAS: nill message disconnect ( %lu bytes request )\n",
-                    cnt );
-            }
-            break;
+        /* nothing to receive on the non-blocking socket of the I/O pool */
+        if ( anerrno == SOCK_EWOULDBLOCK && client->ioPool ) {
+            return RSRV_OK;
         }
-        else if ( nchars < 0 ) {
-            int anerrno = SOCKERRNO;
 
-            if ( anerrno == SOCK_EINTR ) {
-                continue;
-            }
+        if ( anerrno == SOCK_ENOBUFS ) {
+            errlogPrintf (
+                "CAS: Out of network buffers, retring receive in 15 seconds\n" );
+            epicsThreadSleep ( 15.0 );
+            return RSRV_OK;
+        }
 
-            if ( anerrno == SOCK_ENOBUFS ) {
-                errlogPrintf (
-                    "CAS: Out of network buffers, retring receive in 15 seconds\n" );
-                epicsThreadSleep ( 15.0 );
-                continue;
-            }
+        /*
+         * normal conn lost conditions
+         */
+        if (    ( anerrno != SOCK_ECONNABORTED &&
+            anerrno != SOCK_ECONNRESET &&
+            anerrno != SOCK_ETIMEDOUT ) ||
+            CASDEBUG > 2 ) {
+            char sockErrBuf[64];
 
-            /*
-             * normal conn lost conditions
-             */
-            if (    ( anerrno != SOCK_ECONNABORTED &&
-                anerrno != SOCK_ECONNRESET &&
-                anerrno != SOCK_ETIMEDOUT ) ||
-                CASDEBUG > 2 ) {
-                char sockErrBuf[64];
-
-                epicsSocketConvertErrorToString(
-                    sockErrBuf, sizeof ( sockErrBuf ), anerrno);
-                errlogPrintf ( "CAS: Client disconnected - %s\n",
-                    sockErrBuf );
-            }
-            break;
+            epicsSocketConvertErrorToString(
+                sockErrBuf, sizeof ( sockErrBuf ), anerrno);
+            errlogPrintf ( "CAS: Client disconnected - %s\n",
+                sockErrBuf );
         }
+        return RSRV_ERROR;
+    }
 
-        epicsTimeGetCurrent ( &client->time_at_last_recv );
-        client->recv.cnt += ( unsigned ) nchars;
+    epicsTimeGetCurrent ( &client->time_at_last_recv );
+    client->recv.cnt += ( unsigned ) nchars;
+    CAS_STAT_ADD ( bytesIn, nchars );
+
+    return camsgprocess ( client );
+}
+
+/*
+ *  camsgprocess()
+ *
+ *  Process the complete messages received from a TCP client, keeping
+ *  the rest for later.  Returns RSRV_ERROR when the client must be
+ *  disconnected.
+ */
+int camsgprocess ( struct client *client )
+{
+    int status;
+
+    status = camessage ( client );
+    if (status == 0) {
+        /*
+         * if there is a partial message
+         * align it with the start of the buffer
+         */
+        if (client->recv.cnt > client->recv.stk) {
+            unsigned bytes_left;
+
+            bytes_left = client->recv.cnt - client->recv.stk;
 
-        status = camessage ( client );
-        if (status == 0) {
             /*
-             * if there is a partial message
-             * align it with the start of the buffer
+             * overlapping regions handled
+             * properly by memmove
              */
-            if (client->recv.cnt > client->recv.stk) {
-                unsigned bytes_left;
-
-                bytes_left = client->recv.cnt - client->recv.stk;
-
-                /*
-                 * overlapping regions handled
-                 * properly by memmove
-                 */
-                memmove (client->recv.buf,
-                    &client->recv.buf[client->recv.stk], bytes_left);
-                client->recv.cnt = bytes_left;
-            }
-            else {
-                client->recv.cnt = 0ul;
-            }
+            memmove (client->recv.buf,
+                &client->recv.buf[client->recv.stk], bytes_left);
+            client->recv.cnt = bytes_left;
         }
         else {
-            char buf[64];
+            client->recv.cnt = 0ul;
+        }
+        /* the I/O pool may process the rest without receiving */
+        client->recv.stk = 0;
+    }
+    else {
+        char buf[64];
 
-            /* flush any queued messages before shutdown */
-            cas_send_bs_msg(client, 1);
+        /* flush any queued messages before shutdown */
+        cas_send_bs_msg(client, 1);
 
-            client->recv.cnt = 0ul;
+        client->recv.cnt = 0ul;
 
-            /*
-             * disconnect when there are severe message errors
-             */
-            ipAddrToDottedIP (&client->addr, buf, sizeof(buf));
-            epicsPrintf ("CAS: forcing disconnect from %s\n", buf);
-                break;
-        }
+        /*
+         * disconnect when there are severe message errors
+         */
+        ipAddrToDottedIP (&client->addr, buf, sizeof(buf));
+        epicsPrintf ("CAS: forcing disconnect from %s\n", buf);
+        return RSRV_ERROR;
+    }
+    return RSRV_OK;
+}
+
+/*
+ *  camsgtask()
+ *
+ *  CA server TCP client task (one spawned for each client)
+ */
+void camsgtask ( void *pParm )
+{
+    struct client *client = (struct client *) pParm;
+
+    casAttachThreadToClient ( client );
+
+    while (castcp_ctl == ctlRun && !client->disconnect) {
+        if ( camsgrecv ( client ) != RSRV_OK )
+            break;
+    }
+
+    /* the event task may be waiting for space in the ring */
+    if ( client->pShm ) {
+        client->disconnect = TRUE;
     }
 
     LOCK_CLIENTQ;
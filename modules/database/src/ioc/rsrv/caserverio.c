@@ -20,37 +20,339 @@
 #include <string.h>
 #include <errno.h>
 #include <limits.h>
+#include <math.h>
 
 #include "dbDefs.h"
+#include "epicsAtomic.h"
 #include "epicsSignal.h"
 #include "epicsTime.h"
 #include "errlog.h"
 #include "osiSock.h"
 
 #include "caerr.h"
+#include "caShm.h"
 #include "net_convert.h"
 
 #define epicsExportSharedSymbols
+#include "dbLatency.h"
 #include "server.h"
 
+#if defined(__unix__) || defined(__APPLE__)
+#  include <sys/uio.h>
+#  include <poll.h>
+#  define CAS_HAVE_WRITEV
+#  define CAS_HAVE_POLL
+#endif
+
 /*
- *  cas_send_bs_msg()
- *
- *  (channel access server send message)
- *
+ * Wait for the non-blocking socket of an I/O pool client to take
+ * more, in short naps so that a disconnect isn't missed.
+ */
+static void casSendWaitWritable ( struct client *pclient )
+{
+#ifdef CAS_HAVE_POLL
+    struct pollfd pfd;
+
+    pfd.fd = pclient->sock;
+    pfd.events = POLLOUT;
+    pfd.revents = 0;
+    while ( ! pclient->disconnect && poll ( &pfd, 1, 100 ) == 0 ) {
+    }
+#else
+    epicsThreadSleep ( 0.01 );
+#endif
+}
+
+/*
+ * Bytes queued for sending, including those in the send buffer
+ */
+unsigned casSendPending ( const struct client *pclient )
+{
+    unsigned i, pending = pclient->send.stk - pclient->send.cnt;
+
+    for ( i = 0u; i < pclient->sendQueLen; i++ ) {
+        pending += pclient->sendQue[i].stk - pclient->sendQue[i].cnt;
+    }
+    return pending;
+}
+
+/*
+ * Drop everything queued for sending
+ */
+static void casSendDiscard ( struct client *pclient )
+{
+    unsigned i;
+
+    for ( i = 0u; i < pclient->sendQueLen; i++ ) {
+        casFreeBuffer ( &pclient->sendQue[i] );
+    }
+    pclient->sendQueLen = 0u;
+    pclient->send.stk = 0u;
+    pclient->send.cnt = 0u;
+}
+
+/*
+ * Wake the receive thread of a client whose circuit failed
+ */
+static void casSendWakeReceiver ( struct client *pclient )
+{
+    enum epicsSocketSystemCallInterruptMechanismQueryInfo info  =
+        epicsSocketSystemCallInterruptMechanismQuery ();
+
+    switch ( info ) {
+    case esscimqi_socketCloseRequired:
+        if ( pclient->sock != INVALID_SOCKET ) {
+            epicsSocketDestroy ( pclient->sock );
+            pclient->sock = INVALID_SOCKET;
+        }
+        break;
+    case esscimqi_socketBothShutdownRequired:
+        {
+            int status = shutdown ( pclient->sock, SHUT_RDWR );
+            if ( status ) {
+                char sockErrBuf[64];
+                epicsSocketConvertErrnoToString (
+                    sockErrBuf, sizeof ( sockErrBuf ) );
+                errlogPrintf ("CAS: Socket shutdown error: %s\n",
+                    sockErrBuf );
+            }
+        }
+        break;
+    case esscimqi_socketSigAlarmRequired:
+        epicsSignalRaiseSigAlarm ( pclient->tid );
+        break;
+    default:
+        break;
+    };
+}
+
+/*
+ * Copy what fits of the queued buffers and the send buffer into the
+ * shared memory ring, waiting while it is full.  A client which takes
+ * nothing from the ring for CAS_SHM_SEND_WAIT is disconnected, as the
+ * send lock is held meanwhile.  Returns as send().
+ */
+static int casSendShm ( struct client *pclient )
+{
+    unsigned i, n, total = 0u, attempt = 0u;
+    int wakeup = FALSE;
+    epicsUInt64 start = 0u;
+
+    while ( ! total ) {
+        for ( i = 0u; i <= pclient->sendQueLen; i++ ) {
+            struct message_buffer *pbuf;
+            int w;
+
+            if ( i < pclient->sendQueLen ) {
+                pbuf = &pclient->sendQue[i];
+            }
+            else if ( pclient->send.stk > pclient->send.cnt ) {
+                pbuf = &pclient->send;
+            }
+            else {
+                break;
+            }
+            n = caShmWrite ( pclient->pShm, pbuf->buf + pbuf->cnt,
+                pbuf->stk - pbuf->cnt, &w );
+            wakeup |= w;
+            total += n;
+            if ( n < pbuf->stk - pbuf->cnt ) {
+                break;
+            }
+        }
+        if ( ! total ) {
+            epicsUInt64 now = epicsMonotonicGet ();
+
+            if ( pclient->disconnect ) {
+                return -1;
+            }
+            if ( ! start ) {
+                start = now;
+            }
+            else if ( now - start >= (epicsUInt64) ( CAS_SHM_SEND_WAIT * 1e9 ) ) {
+                char buf[64];
+
+                ipAddrToDottedIP ( &pclient->addr, buf, sizeof(buf) );
+                errlogPrintf ( "CAS: %s read nothing from shared memory "
+                    "for %g sec, disconnecting\n", buf, CAS_SHM_SEND_WAIT );
+                pclient->disconnect = TRUE;
+                casSendWakeReceiver ( pclient );
+                return -1;
+            }
+            caShmBackoff ( attempt++ );
+        }
+    }
+
+    while ( wakeup && send ( pclient->sock, "", 1, 0 ) < 0 ) {
+        if ( SOCKERRNO != SOCK_EINTR ) {
+            return -1;
+        }
+    }
+    return (int) total;
+}
+
+/*
+ * Send the queued buffers and then the send buffer, starting at
+ * the first unsent byte of each.  Returns as send().
+ */
+static int casSendQueue ( struct client *pclient )
+{
+#ifdef CAS_HAVE_WRITEV
+    struct iovec iov[CAS_SEND_QUE_MAX + 1];
+    unsigned i;
+    int n = 0;
+
+    for ( i = 0u; i < pclient->sendQueLen; i++ ) {
+        iov[n].iov_base = pclient->sendQue[i].buf + pclient->sendQue[i].cnt;
+        iov[n].iov_len = pclient->sendQue[i].stk - pclient->sendQue[i].cnt;
+        n++;
+    }
+    if ( pclient->send.stk > pclient->send.cnt ) {
+        iov[n].iov_base = pclient->send.buf + pclient->send.cnt;
+        iov[n].iov_len = pclient->send.stk - pclient->send.cnt;
+        n++;
+    }
+    return writev ( pclient->sock, iov, n );
+#else
+    struct message_buffer *pbuf = pclient->sendQueLen ?
+        &pclient->sendQue[0] : &pclient->send;
+
+    return send ( pclient->sock, pbuf->buf + pbuf->cnt,
+        pbuf->stk - pbuf->cnt, 0 );
+#endif
+}
+
+/*
+ * Account for transferSize bytes sent by casSendQueue(), releasing
+ * the queued buffers which are complete.  Returns TRUE once
+ * nothing is left to send.
+ */
+static int casSendAdvance ( struct client *pclient, unsigned transferSize )
+{
+    unsigned i, done = 0u;
+
+    for ( i = 0u; i < pclient->sendQueLen; i++ ) {
+        struct message_buffer *pbuf = &pclient->sendQue[i];
+        unsigned left = pbuf->stk - pbuf->cnt;
+
+        if ( transferSize < left ) {
+            pbuf->cnt += transferSize;
+            transferSize = 0u;
+            break;
+        }
+        transferSize -= left;
+        casFreeBuffer ( pbuf );
+        done++;
+    }
+    if ( done ) {
+        pclient->sendQueLen -= done;
+        memmove ( pclient->sendQue, &pclient->sendQue[done],
+            pclient->sendQueLen * sizeof ( pclient->sendQue[0] ) );
+    }
+
+    pclient->send.cnt += transferSize;
+    if ( pclient->send.cnt >= pclient->send.stk ) {
+        pclient->send.stk = 0u;
+        pclient->send.cnt = 0u;
+    }
+    return pclient->sendQueLen == 0u && pclient->send.stk == 0u;
+}
+
+/*
+ * Account for bytes sent to the client, with the send lock held
+ */
+static void casSendCount ( struct client *pclient, unsigned bytes )
+{
+    epicsUInt64 now = epicsMonotonicGet ();
+
+    CAS_STAT_ADD ( bytesOut, bytes );
+    epicsAtomicAddSizeT ( &pclient->statSent, bytes );
+    pclient->sendRateBytes += bytes;
+    if ( now - pclient->sendRateTime >= 1000000000u ) {
+        epicsAtomicSetSizeT ( &pclient->statSendRate,
+            (size_t) ( pclient->sendRateBytes * 1e9 /
+                ( now - pclient->sendRateTime ) ) );
+        pclient->sendRateTime = now;
+        pclient->sendRateBytes = 0u;
+    }
+    if ( rsrvClientRateLimit > 0.0 ) {
+        pclient->sendTokens -= bytes;
+    }
+}
+
+/*
+ * The rate limit doubles every 20 CA priority levels
+ */
+double casSendRateLimit ( const struct client *pclient )
+{
+    if ( rsrvClientRateLimit <= 0.0 ) {
+        return 0.0;
+    }
+    return rsrvClientRateLimit * pow ( 2.0, pclient->priority / 20.0 );
+}
+
+#define CAS_THROTTLE_NAP 0.1 /* sec */
+
+/*
+ *  casSendThrottle()
  *
- * Set lock_needed=1 unless SEND_LOCK() is held by caller
+ *  Called by the event task after sending subscription updates,
+ *  without the send lock.  Waits while the client is over its rate
+ *  limit, meanwhile updates are merged in the event queue.  Requests
+ *  from the client are answered without waiting, but the bytes sent
+ *  count against the limit.
  */
-void cas_send_bs_msg ( struct client *pclient, int lock_needed )
+void casSendThrottle ( struct client *pclient )
 {
-    int status;
+    double rate = casSendRateLimit ( pclient );
+    double delay = 0.0;
+    epicsUInt64 now;
 
-    if ( lock_needed ) {
-        SEND_LOCK ( pclient );
+    if ( rate <= 0.0 ) {
+        return;
     }
 
-    if ( CASDEBUG > 2 && pclient->send.stk ) {
-        errlogPrintf ( "CAS: Sending a message of %d bytes\n", pclient->send.stk );
+    SEND_LOCK ( pclient );
+    now = epicsMonotonicGet ();
+    pclient->sendTokens += rate * ( now - pclient->sendTokenTime ) * 1e-9;
+    pclient->sendTokenTime = now;
+    /* allow bursts of up to one second */
+    if ( pclient->sendTokens > rate ) {
+        pclient->sendTokens = rate;
+    }
+    if ( pclient->sendTokens < 0.0 ) {
+        delay = -pclient->sendTokens / rate;
+        pclient->sendThrottled++;
+        pclient->sendThrottleSec += delay;
+    }
+    SEND_UNLOCK ( pclient );
+
+    /*
+     * short naps, so that a disconnect doesn't wait for the
+     * rest of the delay in db_close_events()
+     */
+    while ( delay > 0.0 && ! pclient->disconnect ) {
+        double nap = delay < CAS_THROTTLE_NAP ? delay : CAS_THROTTLE_NAP;
+        epicsThreadSleep ( nap );
+        delay -= nap;
+    }
+}
+
+/*
+ *  casSendFlush()
+ *
+ *  Send what is queued, with the send lock held.  If the socket of
+ *  an I/O pool client can take no more, waits for it unless wait is
+ *  FALSE.  Returns TRUE once nothing is left to send.
+ */
+static int casSendFlush ( struct client *pclient, int wait )
+{
+    epicsUInt64 start, elapsed, usec;
+    int status;
+
+    if ( CASDEBUG > 2 && casSendPending ( pclient ) ) {
+        errlogPrintf ( "CAS: Sending a message of %u bytes\n",
+            casSendPending ( pclient ) );
     }
 
     if ( pclient->disconnect ) {
@@ -58,27 +360,26 @@ void cas_send_bs_msg ( struct client *pclient, int lock_needed )
             errlogPrintf ( "CAS: msg Discard for sock %d addr %x\n",
                 (int)pclient->sock, (unsigned) pclient->addr.sin_addr.s_addr );
         }
-        pclient->send.stk = 0u;
-        if(lock_needed)
-            SEND_UNLOCK(pclient);
-        return;
+        casSendDiscard ( pclient );
+        return TRUE;
     }
 
-    while ( pclient->send.stk && ! pclient->disconnect ) {
-        status = send ( pclient->sock, pclient->send.buf, pclient->send.stk, 0 );
+    if ( ! pclient->sendQueLen && ! pclient->send.stk ) {
+        return TRUE;
+    }
+    start = epicsMonotonicGet ();
+
+    while ( ( pclient->sendQueLen || pclient->send.stk ) &&
+            ! pclient->disconnect ) {
+        status = pclient->shmSend ?
+            casSendShm ( pclient ) : casSendQueue ( pclient );
         if ( status >= 0 ) {
-            unsigned transferSize = (unsigned) status;
-            if ( transferSize >= pclient->send.stk ) {
-                pclient->send.stk = 0;
+            casSendCount ( pclient, (unsigned) status );
+            /* a partial send only advances the offsets */
+            if ( casSendAdvance ( pclient, (unsigned) status ) ) {
                 epicsTimeGetCurrent ( &pclient->time_at_last_send );
                 break;
             }
-            else {
-                unsigned bytesLeft = pclient->send.stk - transferSize;
-                memmove ( pclient->send.buf, &pclient->send.buf[transferSize],
-                    bytesLeft );
-                pclient->send.stk = bytesLeft;
-            }
         }
         else {
             int causeWasSocketHangup = 0;
@@ -86,7 +387,7 @@ void cas_send_bs_msg ( struct client *pclient, int lock_needed )
             char buf[64];
 
             if ( pclient->disconnect ) {
-                pclient->send.stk = 0u;
+                casSendDiscard ( pclient );
                 break;
             }
 
@@ -94,6 +395,14 @@ void cas_send_bs_msg ( struct client *pclient, int lock_needed )
                 continue;
             }
 
+            if ( anerrno == SOCK_EWOULDBLOCK && pclient->ioPool ) {
+                if ( ! wait ) {
+                    break;
+                }
+                casSendWaitWritable ( pclient );
+                continue;
+            }
+
             if ( anerrno == SOCK_ENOBUFS ) {
                 errlogPrintf (
                     "CAS: Out of network buffers, retrying send in 15 seconds\n" );
@@ -118,51 +427,100 @@ void cas_send_bs_msg ( struct client *pclient, int lock_needed )
                     buf, sockErrBuf);
             }
             pclient->disconnect = TRUE;
-            pclient->send.stk = 0u;
+            casSendDiscard ( pclient );
 
             /*
              * wakeup the receive thread
              */
             if ( ! causeWasSocketHangup ) {
-                enum epicsSocketSystemCallInterruptMechanismQueryInfo info  =
-                    epicsSocketSystemCallInterruptMechanismQuery ();
-                switch ( info ) {
-                case esscimqi_socketCloseRequired:
-                    if ( pclient->sock != INVALID_SOCKET ) {
-                        epicsSocketDestroy ( pclient->sock );
-                        pclient->sock = INVALID_SOCKET;
-                    }
-                    break;
-                case esscimqi_socketBothShutdownRequired:
-                    {
-                        int status = shutdown ( pclient->sock, SHUT_RDWR );
-                        if ( status ) {
-                            char sockErrBuf[64];
-                            epicsSocketConvertErrnoToString (
-                                sockErrBuf, sizeof ( sockErrBuf ) );
-                            errlogPrintf ("CAS: Socket shutdown error: %s\n",
-                                sockErrBuf );
-                        }
-                    }
-                    break;
-                case esscimqi_socketSigAlarmRequired:
-                    epicsSignalRaiseSigAlarm ( pclient->tid );
-                    break;
-                default:
-                    break;
-                };
+                casSendWakeReceiver ( pclient );
                 break;
             }
         }
     }
 
+    /* carry the fractions of a microsecond in the client's total */
+    elapsed = epicsMonotonicGet () - start;
+    usec = ( pclient->sendTime + elapsed ) / 1000u - pclient->sendTime / 1000u;
+    CAS_STAT_INCR ( sendCalls );
+    CAS_STAT_ADD ( sendTimeUsec, usec );
+    epicsAtomicAddSizeT ( &pclient->statSendUsec, usec );
+    epicsAtomicSetSizeT ( &pclient->statPending, casSendPending ( pclient ) );
+    pclient->sendTime += elapsed;
+
+    if ( pclient->tracePosted ) {
+        dbLatencySample ( dbLatSend, start, start + elapsed );
+        if ( pclient->disconnect ) {
+            pclient->tracePosted = 0u;
+        }
+        else if ( ! pclient->sendQueLen && ! pclient->send.stk ) {
+            dbLatencySample ( dbLatTotal, pclient->tracePosted,
+                start + elapsed );
+            pclient->tracePosted = 0u;
+        }
+    }
+
+    return ! pclient->sendQueLen && ! pclient->send.stk;
+}
+
+/*
+ *  cas_send_bs_msg()
+ *
+ *  (channel access server send message)
+ *
+ *
+ * Set lock_needed=1 unless SEND_LOCK() is held by caller
+ */
+void cas_send_bs_msg ( struct client *pclient, int lock_needed )
+{
+    if ( lock_needed ) {
+        SEND_LOCK ( pclient );
+    }
+
+    casSendFlush ( pclient, TRUE );
+
     if ( lock_needed ) {
         SEND_UNLOCK(pclient);
     }
 
     DLOG ( 3, ( "------------------------------\n\n" ) );
+}
 
-    return;
+/*
+ *  casSendTry()
+ *
+ *  Send what the socket of an I/O pool client takes without waiting.
+ *  Returns TRUE once nothing is left to send.
+ */
+int casSendTry ( struct client *pclient )
+{
+    int done;
+
+    SEND_LOCK ( pclient );
+    done = casSendFlush ( pclient, FALSE );
+    SEND_UNLOCK ( pclient );
+    return done;
+}
+
+/*
+ *  casSendBacklog()
+ *
+ *  TRUE when full buffers are queued for an I/O pool client and its
+ *  socket doesn't take them, so that replies to further requests
+ *  would have to wait.  Replies which fit the send buffer are still
+ *  batched.
+ */
+int casSendBacklog ( struct client *pclient )
+{
+    int backlog = FALSE;
+
+    SEND_LOCK ( pclient );
+    if ( pclient->sendQueLen ) {
+        casSendFlush ( pclient, FALSE );
+        backlog = pclient->sendQueLen > 0u;
+    }
+    SEND_UNLOCK ( pclient );
+    return backlog;
 }
 
 /*
@@ -200,27 +558,34 @@ void cas_send_dg_msg ( struct client * pclient )
         pDG += sizeof (caHdr);
         sizeDG -= sizeof (caHdr);
     }
+    CAS_STAT_ADD ( bytesOut, sizeDG );
 
-    status = sendto ( pclient->sock, pDG, sizeDG, 0,
-       (struct sockaddr *)&pclient->addr, sizeof(pclient->addr) );
-    if ( status >= 0 ) {
-        if ( status >= sizeDG ) {
-            epicsTimeGetCurrent ( &pclient->time_at_last_send );
+    if ( pclient->pUdpBatch ) {
+        /* sent later by the cast_server() thread */
+        casUdpBatchQueue ( pclient, pDG, sizeDG );
+    }
+    else {
+        status = sendto ( pclient->sock, pDG, sizeDG, 0,
+           (struct sockaddr *)&pclient->addr, sizeof(pclient->addr) );
+        if ( status >= 0 ) {
+            if ( status >= sizeDG ) {
+                epicsTimeGetCurrent ( &pclient->time_at_last_send );
+            }
+            else {
+                errlogPrintf (
+                    "CAS: System failed to send entire udp frame?\n" );
+            }
         }
         else {
-            errlogPrintf (
-                "CAS: System failed to send entire udp frame?\n" );
+            char sockErrBuf[64];
+            char buf[128];
+            epicsSocketConvertErrnoToString (
+                sockErrBuf, sizeof ( sockErrBuf ) );
+            ipAddrToDottedIP ( &pclient->addr, buf, sizeof(buf) );
+            errlogPrintf( "CAS: UDP send to %s failed: %s\n",
+                buf, sockErrBuf);
         }
     }
-    else {
-        char sockErrBuf[64];
-        char buf[128];
-        epicsSocketConvertErrnoToString (
-            sockErrBuf, sizeof ( sockErrBuf ) );
-        ipAddrToDottedIP ( &pclient->addr, buf, sizeof(buf) );
-        errlogPrintf( "CAS: UDP send to %s failed: %s\n",
-            buf, sockErrBuf);
-    }
 
     pclient->send.stk = 0u;
 
@@ -236,6 +601,86 @@ void cas_send_dg_msg ( struct client * pclient )
     return;
 }
 
+/*
+ * Make room for msgSize more bytes in the send buffer, by queueing
+ * or sending what is there.  Send lock must be on.
+ */
+static int cas_make_room ( struct client *pclient, unsigned msgSize )
+{
+    if ( msgSize > pclient->send.maxstk ||
+            pclient->send.stk > pclient->send.maxstk - msgSize ) {
+        if ( pclient->proto == IPPROTO_TCP ) {
+            /*
+             * queue the full buffer rather than sending it now,
+             * or copying it to a larger one
+             */
+            if ( pclient->disconnect ||
+                    ! casQueueSendBuffer ( pclient, msgSize ) ) {
+                if ( ! pclient->disconnect ) {
+                    CAS_STAT_INCR ( sendStalls );
+                }
+                cas_send_bs_msg ( pclient, FALSE );
+                if ( msgSize > pclient->send.maxstk ) {
+                    casExpandSendBuffer ( pclient, msgSize );
+                }
+            }
+        }
+        else if ( pclient->proto == IPPROTO_UDP ) {
+            if ( msgSize > pclient->send.maxstk ) {
+                casExpandSendBuffer ( pclient, msgSize );
+                if ( msgSize > pclient->send.maxstk ) {
+                    return ECA_TOLARGE;
+                }
+            }
+            if ( pclient->send.stk > pclient->send.maxstk - msgSize ) {
+                if ( pclient->disconnect ) {
+                    pclient->send.stk = 0;
+                }
+                else {
+                    cas_send_dg_msg ( pclient );
+                }
+            }
+        }
+        else {
+            return ECA_INTERNAL;
+        }
+        if ( msgSize > pclient->send.maxstk ) {
+            return ECA_TOLARGE;
+        }
+    }
+    return ECA_NORMAL;
+}
+
+/*
+ * Copy a message header to the end of the send buffer, which has room
+ * for it.  Returns a pointer to the message body.
+ */
+static void * cas_put_header (
+    struct client *pclient, ca_uint16_t response,
+    ca_uint32_t alignedPayloadSize, ca_uint16_t dataType, ca_uint32_t nElem,
+    ca_uint32_t cid, ca_uint32_t responseSpecific )
+{
+    caHdr *pMsg = (caHdr *) &pclient->send.buf[pclient->send.stk];
+
+    pMsg->m_cmmd = htons(response);
+    pMsg->m_dataType = htons(dataType);
+    pMsg->m_cid = htonl(cid);
+    pMsg->m_available = htonl(responseSpecific);
+    if (alignedPayloadSize < 0xffff && nElem < 0xffff) {
+        pMsg->m_postsize = htons(((ca_uint16_t) alignedPayloadSize));
+        pMsg->m_count = htons(((ca_uint16_t) nElem));
+        return (void *) (pMsg + 1);
+    }
+    else {
+        ca_uint32_t *pW32 = (ca_uint32_t *) (pMsg + 1);
+        pMsg->m_postsize = htons(0xffff);
+        pMsg->m_count = htons(0u);
+        pW32[0] = htonl(alignedPayloadSize);
+        pW32[1] = htonl(nElem);
+        return (void *) (pW32 + 2);
+    }
+}
+
 /*
  *
  *  cas_copy_in_header()
@@ -255,7 +700,8 @@ int cas_copy_in_header (
 {
     unsigned    msgSize;
     ca_uint32_t alignedPayloadSize;
-    caHdr *pMsg;
+    void        *pPayload;
+    int         status;
 
     if ( payloadSize > UINT_MAX - sizeof ( caHdr ) - 8u ) {
         return ECA_TOLARGE;
@@ -271,54 +717,19 @@ int cas_copy_in_header (
         msgSize += 2 * sizeof ( ca_uint32_t );
     }
 
-    if ( msgSize > pclient->send.maxstk ) {
-        casExpandSendBuffer ( pclient, msgSize );
-        if ( msgSize > pclient->send.maxstk ) {
-            return ECA_TOLARGE;
-        }
+    status = cas_make_room ( pclient, msgSize );
+    if ( status != ECA_NORMAL ) {
+        return status;
     }
 
-    if ( pclient->send.stk > pclient->send.maxstk - msgSize ) {
-        if ( pclient->disconnect ) {
-            pclient->send.stk = 0;
-        }
-        else{
-            if ( pclient->proto == IPPROTO_TCP) {
-                cas_send_bs_msg ( pclient, FALSE );
-            }
-            else if ( pclient->proto == IPPROTO_UDP ) {
-                cas_send_dg_msg ( pclient );
-            }
-            else {
-                return ECA_INTERNAL;
-            }
-        }
-    }
-
-    pMsg = (caHdr *) &pclient->send.buf[pclient->send.stk];
-    pMsg->m_cmmd = htons(response);
-    pMsg->m_dataType = htons(dataType);
-    pMsg->m_cid = htonl(cid);
-    pMsg->m_available = htonl(responseSpecific);
-    if (alignedPayloadSize < 0xffff && nElem < 0xffff) {
-        pMsg->m_postsize = htons(((ca_uint16_t) alignedPayloadSize));
-        pMsg->m_count = htons(((ca_uint16_t) nElem));
-        if (ppPayload)
-            *ppPayload = (void *) (pMsg + 1);
-    }
-    else {
-        ca_uint32_t *pW32 = (ca_uint32_t *) (pMsg + 1);
-        pMsg->m_postsize = htons(0xffff);
-        pMsg->m_count = htons(0u);
-        pW32[0] = htonl(alignedPayloadSize);
-        pW32[1] = htonl(nElem);
-        if (ppPayload)
-            *ppPayload = (void *) (pW32 + 2);
-    }
+    pPayload = cas_put_header ( pclient, response, alignedPayloadSize,
+        dataType, nElem, cid, responseSpecific );
+    if (ppPayload)
+        *ppPayload = pPayload;
 
     /* zero out pad bytes */
     if ( alignedPayloadSize > payloadSize ) {
-        char *p = ( char * ) *ppPayload;
+        char *p = ( char * ) pPayload;
         memset ( p + payloadSize, '\0',
             alignedPayloadSize - payloadSize );
     }
@@ -326,6 +737,99 @@ int cas_copy_in_header (
     return ECA_NORMAL;
 }
 
+/*
+ *  cas_stream_header()
+ *
+ *  Start a TCP message whose payload is appended in pieces with
+ *  cas_stream_space() and cas_stream_commit(), so that it need not
+ *  fit in any one buffer.  Full buffers are queued or sent meanwhile.
+ *  The send lock must be held until cas_stream_end().
+ */
+int cas_stream_header (
+    struct client *pclient, ca_uint16_t response, ca_uint32_t payloadSize,
+    ca_uint16_t dataType, ca_uint32_t nElem, ca_uint32_t cid,
+    ca_uint32_t responseSpecific )
+{
+    unsigned    hdrSize = sizeof ( caHdr );
+    ca_uint32_t alignedPayloadSize;
+    int         status;
+
+    if ( pclient->proto != IPPROTO_TCP ||
+            payloadSize > UINT_MAX - sizeof ( caHdr ) - 8u ) {
+        return ECA_TOLARGE;
+    }
+
+    alignedPayloadSize = CA_MESSAGE_ALIGN ( payloadSize );
+    if ( alignedPayloadSize >= 0xffff || nElem >= 0xffff ) {
+        if ( ! CA_V49 ( pclient->minor_version_number ) ) {
+            return ECA_16KARRAYCLIENT;
+        }
+        hdrSize += 2 * sizeof ( ca_uint32_t );
+    }
+
+    status = cas_make_room ( pclient, hdrSize );
+    if ( status != ECA_NORMAL ) {
+        return status;
+    }
+    cas_put_header ( pclient, response, alignedPayloadSize,
+        dataType, nElem, cid, responseSpecific );
+    pclient->send.stk += hdrSize;
+    pclient->streamLeft = alignedPayloadSize;
+    return ECA_NORMAL;
+}
+
+/*
+ * Returns where the next *pSize bytes of the streamed payload go,
+ * at least minSize of them unless less is left.
+ */
+void * cas_stream_space ( struct client *pclient, unsigned minSize,
+    unsigned *pSize )
+{
+    unsigned space;
+
+    if ( minSize > pclient->streamLeft ) {
+        minSize = pclient->streamLeft;
+    }
+    if ( cas_make_room ( pclient, minSize ) != ECA_NORMAL ) {
+        *pSize = 0u;
+        return NULL;
+    }
+    space = pclient->send.maxstk - pclient->send.stk;
+    *pSize = space < pclient->streamLeft ? space : pclient->streamLeft;
+    return &pclient->send.buf[pclient->send.stk];
+}
+
+void cas_stream_commit ( struct client *pclient, unsigned size )
+{
+    assert ( size <= pclient->streamLeft );
+    pclient->send.stk += size;
+    pclient->streamLeft -= size;
+}
+
+/*
+ * Zero the rest of the streamed payload
+ */
+void cas_stream_end ( struct client *pclient )
+{
+    if ( pclient->disconnect ) {
+        /* nothing more will be sent */
+        pclient->streamLeft = 0u;
+    }
+    while ( pclient->streamLeft ) {
+        unsigned size;
+        void *p = cas_stream_space ( pclient, 8u, &size );
+
+        if ( ! p ) {
+            /* out of the TCP protocol */
+            pclient->disconnect = TRUE;
+            pclient->streamLeft = 0u;
+            break;
+        }
+        memset ( p, 0, size );
+        cas_stream_commit ( pclient, size );
+    }
+}
+
 void cas_set_header_cid ( struct client *pClient, ca_uint32_t cid )
 {
     caHdr *pMsg = ( caHdr * ) &pClient->send.buf[pClient->send.stk];
@@ -22,7 +22,11 @@
 #include <limits.h>
 #include <errno.h>
 
+#define EPICS_PRIVATE_API
+
 #include "addrList.h"
+#include "caShm.h"
+#include "epicsAtomic.h"
 #include "epicsEvent.h"
 #include "epicsMutex.h"
 #include "epicsSignal.h"
@@ -107,6 +111,10 @@ static void req_server (void *pParm)
             ellAdd ( &clientQ, &pClient->node );
             UNLOCK_CLIENTQ;
 
+            if ( rsrvIoThreads > 0 && casIoPoolAdd ( pClient ) == RSRV_OK ) {
+                continue;
+            }
+
             id = epicsThreadCreate ( "CAS-client", epicsThreadPriorityCAServerLow,
                     epicsThreadGetStackSize ( epicsThreadStackBig ),
                     camsgtask, pClient );
@@ -586,6 +594,10 @@ void rsrv_init (void)
         }
     }
 
+    if ( rsrvNegCacheSize > 0 && casNegCacheInit ( rsrvNegCacheSize ) != RSRV_OK ) {
+        rsrvNegCacheSize = 0;
+    }
+
     /* start servers (TCP and UDP(s) for each interface.
      */
     {
@@ -702,6 +714,40 @@ void rsrv_init (void)
 
 #endif /* !(defined(_WIN32) || defined(__CYGWIN__)) */
 
+#if defined(__linux__) && defined(SO_REUSEPORT)
+            /* Linux spreads the unicast datagrams for a port over all
+             * sockets bound to it with SO_REUSEPORT, but delivers every
+             * broadcast to each of them.  So only add receivers when
+             * broadcasts arrive at a separate socket.
+             */
+            if(rsrvUdpThreads>1) {
+                if(conf->udpAddr.ia.sin_addr.s_addr==htonl(INADDR_ANY)) {
+                    fprintf(stderr, "CAS: rsrvUdpThreads needs EPICS_CAS_INTF_ADDR_LIST,"
+                                    " one UDP thread for %s\n", ifaceName);
+                } else {
+                    unsigned j;
+
+                    conf->udpshard = callocMustSucceed(rsrvUdpThreads-1,
+                        sizeof(*conf->udpshard), "rsrv_init");
+                    conf->sclient = callocMustSucceed(rsrvUdpThreads-1,
+                        sizeof(*conf->sclient), "rsrv_init");
+
+                    for(j=0; j<(unsigned)rsrvUdpThreads-1; j++) {
+                        SOCKET sock = epicsSocketCreate(AF_INET, SOCK_DGRAM, 0);
+                        if(sock==INVALID_SOCKET)
+                            break;
+                        epicsSocketEnableAddressUseForDatagramFanout ( sock );
+                        if(tryBind(sock, &conf->udpAddr, "UDP unicast socket")) {
+                            epicsSocketDestroy(sock);
+                            break;
+                        }
+                        conf->udpshard[j] = sock;
+                    }
+                    conf->nudpshard = j;
+                }
+            }
+#endif
+
             ellAdd(&servers, &conf->node);
 
             /* have all sockets, time to start some threads */
@@ -732,12 +778,34 @@ void rsrv_init (void)
             }
 #endif /* !(defined(_WIN32) || defined(__CYGWIN__)) */
 
+            {
+                unsigned j;
+
+                for(j=0; j<conf->nudpshard; j++) {
+                    char name[20];
+
+                    epicsSnprintf(name, sizeof(name), "CAS-UDP-%u", j+1);
+                    conf->startshard = j+1;
+
+                    epicsThreadMustCreate(name, threadPrios[4],
+                            epicsThreadGetStackSize(epicsThreadStackMedium),
+                            &cast_server, conf);
+
+                    epicsEventMustWait(casudp_startStopEvent);
+                }
+                conf->startshard = 0;
+            }
+
             havesometcp = 1;
             continue;
         cleanup:
             epicsSocketDestroy(conf->tcp);
             if(conf->udp!=INVALID_SOCKET) epicsSocketDestroy(conf->udp);
             if(conf->udpbcast!=INVALID_SOCKET) epicsSocketDestroy(conf->udpbcast);
+            while(conf->nudpshard)
+                epicsSocketDestroy(conf->udpshard[--conf->nudpshard]);
+            free(conf->udpshard);
+            free(conf->sclient);
             free(conf);
         }
 
@@ -747,6 +815,10 @@ void rsrv_init (void)
 
     /* servers list is considered read-only from this point */
 
+    if ( rsrvIoThreads > 0 && casIoPoolStart ( rsrvIoThreads ) != RSRV_OK ) {
+        rsrvIoThreads = 0;
+    }
+
     epicsThreadMustCreate("CAS-beacon", threadPrios[3],
             epicsThreadGetStackSize(epicsThreadStackSmall),
             &rsrv_online_notify_task, NULL);
@@ -858,12 +930,49 @@ static void log_one_client (struct client *client, unsigned level)
         printf(
         "\tUnprocessed request bytes = %u, Undelivered response bytes = %u\n",
             client->recv.cnt - client->recv.stk,
-            client->send.stk );
+            casSendPending ( client ) );
+        printf(
+        "\tSent %lu bytes, %lu bytes/sec",
+            (unsigned long) epicsAtomicGetSizeT ( &client->statSent ),
+            (unsigned long) epicsAtomicGetSizeT ( &client->statSendRate ) );
+        if ( casSendRateLimit ( client ) > 0.0 ) {
+            printf( ", limit %.0f bytes/sec, throttled %lu times for %.3f sec",
+                casSendRateLimit ( client ), client->sendThrottled,
+                client->sendThrottleSec );
+        }
+        printf( "\n" );
         printf(
-        "\tState = %s%s%s\n",
+        "\tState = %s%s%s%s\n",
             state[client->disconnect?1:0],
             client->send.type == mbtLargeTCP ? " jumbo-send-buf" : "",
-            client->recv.type == mbtLargeTCP ? " jumbo-recv-buf" : "");
+            client->recv.type == mbtLargeTCP ? " jumbo-recv-buf" : "",
+            client->shmSend ? " shared-memory" : "");
+        if ( client->evuser ) {
+            dbEventQueueStats qstats;
+            dbEventHoldStats hstats;
+
+            db_event_queue_status ( client->evuser, &qstats );
+            db_event_hold_status ( client->evuser, &hstats );
+            printf(
+            "\tEvent queue depth = %u (max %u) of %u entries in %u queue%s\n",
+                qstats.depth, qstats.maxDepth, qstats.size, qstats.nQueues,
+                qstats.nQueues == 1 ? "" : "s" );
+            printf(
+            "\tEvents replaced = %lu, dropped = %lu, queue grown %u shrunk %u times\n",
+                qstats.nReplaced, qstats.nDropped,
+                qstats.nGrowths, qstats.nShrinks );
+            if ( hstats.nHeld || hstats.nCoalesced ) {
+                printf(
+                "\tEvents held for a minimum interval = %u, coalesced = %lu\n",
+                    hstats.nHeld, hstats.nCoalesced );
+            }
+            if ( qstats.nBatches ) {
+                printf(
+                "\t%lu events delivered in %lu batches, %.1f per batch\n",
+                    qstats.nBatched, qstats.nBatches,
+                    (double) qstats.nBatched / qstats.nBatches );
+            }
+        }
     }
 
     if ( level >= 1u ) {
@@ -928,6 +1037,15 @@ void casr (unsigned level)
     }
     UNLOCK_CLIENTQ
 
+    if (level>=1) {
+        casStatsShow ();
+        casIoPoolShow ();
+        casNegCacheShow ();
+        if (rsrvUdpBatch > 1)
+            printf("UDP name searches received and answered up to %d at a time\n",
+                rsrvUdpBatch);
+    }
+
     if (level>=1) {
         rsrv_iface_config *iface = (rsrv_iface_config *) ellFirst ( &servers );
         while (iface) {
@@ -948,9 +1066,16 @@ void casr (unsigned level)
                     log_one_client(iface->client, level - 2);
             }
             else {
+                unsigned j;
+
                 printf("    CAS-UDP unicast name server on %s\n", buf);
                 if (level >= 2)
                     log_one_client(iface->client, level - 2);
+                for (j = 0; j < iface->nudpshard; j++) {
+                    printf("    CAS-UDP-%u unicast name server on %s\n", j + 1, buf);
+                    if (level >= 2 && iface->sclient[j])
+                        log_one_client(iface->sclient[j], level - 2);
+                }
                 ipAddrToDottedIP (&iface->udpbcastAddr.ia, buf, sizeof(buf));
                 printf("    CAS-UDP broadcast name server on %s\n", buf);
                 if (level >= 2)
@@ -1051,7 +1176,8 @@ void destroy_client ( struct client *client )
         return;
     }
 
-    if ( client->tid != 0 ) {
+    /* a pool thread stays with the watchdog after the client has gone */
+    if ( client->tid != 0 && ! client->ioPool ) {
         taskwdRemove ( client->tid );
     }
 
@@ -1060,36 +1186,13 @@ void destroy_client ( struct client *client )
     }
 
     if ( client->proto == IPPROTO_TCP ) {
-        if ( client->send.buf ) {
-            if ( client->send.type == mbtSmallTCP ) {
-                freeListFree ( rsrvSmallBufFreeListTCP,  client->send.buf );
-            }
-            else if ( client->send.type == mbtLargeTCP ) {
-                if(rsrvLargeBufFreeListTCP)
-                    freeListFree ( rsrvLargeBufFreeListTCP,  client->send.buf );
-                else
-                    free(client->send.buf);
-            }
-            else {
-                errlogPrintf ( "CAS: Corrupt send buffer free list type code=%u during client cleanup?\n",
-                    client->send.type );
-            }
-        }
-        if ( client->recv.buf ) {
-            if ( client->recv.type == mbtSmallTCP ) {
-                freeListFree ( rsrvSmallBufFreeListTCP,  client->recv.buf );
-            }
-            else if ( client->recv.type == mbtLargeTCP ) {
-                if(rsrvLargeBufFreeListTCP)
-                    freeListFree ( rsrvLargeBufFreeListTCP,  client->recv.buf );
-                else
-                    free(client->recv.buf);
-            }
-            else {
-                errlogPrintf ( "CAS: Corrupt recv buffer free list type code=%u during client cleanup?\n",
-                    client->send.type );
-            }
+        unsigned i;
+
+        for ( i = 0u; i < client->sendQueLen; i++ ) {
+            casFreeBuffer ( &client->sendQue[i] );
         }
+        casFreeBuffer ( &client->send );
+        casFreeBuffer ( &client->recv );
     }
     else if ( client->proto == IPPROTO_UDP ) {
         if ( client->send.buf ) {
@@ -1128,6 +1231,8 @@ void destroy_client ( struct client *client )
         free ( client->pHostName );
     }
 
+    caShmDestroy ( client->pShm );
+
     freeListFree ( rsrvClientFreeList, client );
 }
 
@@ -1197,6 +1302,9 @@ void destroy_tcp_client ( struct client *client )
         errlogPrintf ( "CAS: Connection %d Terminated\n", (int)client->sock );
     }
 
+    /* ends the wait of a throttled event task, see casSendThrottle() */
+    client->disconnect = TRUE;
+
     if ( client->evuser ) {
         /*
          * turn off extra labor callbacks from the event thread
@@ -1297,6 +1405,8 @@ struct client * create_client ( SOCKET sock, int proto )
     client->evuser = NULL;
     client->priority = CA_PROTO_PRIORITY_MIN;
     client->disconnect = FALSE;
+    client->sendRateTime = epicsMonotonicGet ();
+    client->sendTokenTime = client->sendRateTime;
     epicsTimeGetCurrent ( &client->time_at_last_send );
     epicsTimeGetCurrent ( &client->time_at_last_recv );
     client->minor_version_number = CA_UKN_MINOR_VERSION;
@@ -1392,6 +1502,95 @@ void casExpandSendBuffer ( struct client *pClient, ca_uint32_t size )
     casExpandBuffer (&pClient->send, size, 1);
 }
 
+/*
+ * Move the send buffer to the send queue, and continue in a new
+ * buffer with room for size bytes.  Returns FALSE if the queue is
+ * full, the buffers would hold more than CAS_SEND_QUE_BYTES or no
+ * such buffer is available, the caller should then send what is
+ * pending instead.
+ */
+int casQueueSendBuffer ( struct client *pClient, ca_uint32_t size )
+{
+    char *newbuf = NULL;
+    unsigned i, held, newsize;
+    enum messageBufferType newtype;
+
+    if ( pClient->proto != IPPROTO_TCP ||
+            pClient->sendQueLen >= CAS_SEND_QUE_MAX ) {
+        return FALSE;
+    }
+
+    if ( size <= MAX_TCP ) {
+        newsize = MAX_TCP;
+        newtype = mbtSmallTCP;
+    } else if ( ! rsrvLargeBufFreeListTCP ) {
+        /* round up to multiple of 4K */
+        newsize = ((size-1)|0xfff)+1;
+        newtype = mbtLargeTCP;
+    } else if ( size <= rsrvSizeofLargeBufTCP ) {
+        newsize = rsrvSizeofLargeBufTCP;
+        newtype = mbtLargeTCP;
+    } else {
+        return FALSE;
+    }
+
+    held = pClient->send.maxstk;
+    for ( i = 0u; i < pClient->sendQueLen; i++ ) {
+        held += pClient->sendQue[i].maxstk;
+    }
+    if ( held > CAS_SEND_QUE_BYTES || newsize > CAS_SEND_QUE_BYTES - held ) {
+        return FALSE;
+    }
+
+    if ( newtype == mbtSmallTCP ) {
+        newbuf = freeListMalloc ( rsrvSmallBufFreeListTCP );
+    } else if ( ! rsrvLargeBufFreeListTCP ) {
+        newbuf = malloc ( newsize );
+    } else {
+        newbuf = freeListMalloc ( rsrvLargeBufFreeListTCP );
+    }
+    if ( ! newbuf ) {
+        return FALSE;
+    }
+
+    if ( pClient->send.stk > pClient->send.cnt ) {
+        pClient->sendQue[pClient->sendQueLen++] = pClient->send;
+    }
+    else {
+        casFreeBuffer ( &pClient->send );
+    }
+    pClient->send.buf = newbuf;
+    pClient->send.maxstk = newsize;
+    pClient->send.type = newtype;
+    pClient->send.stk = 0u;
+    pClient->send.cnt = 0u;
+    return TRUE;
+}
+
+/*
+ * Return a TCP buffer to the free list it came from
+ */
+void casFreeBuffer ( struct message_buffer *buf )
+{
+    if ( ! buf->buf ) {
+        return;
+    }
+    if ( buf->type == mbtSmallTCP ) {
+        freeListFree ( rsrvSmallBufFreeListTCP,  buf->buf );
+    }
+    else if ( buf->type == mbtLargeTCP ) {
+        if(rsrvLargeBufFreeListTCP)
+            freeListFree ( rsrvLargeBufFreeListTCP,  buf->buf );
+        else
+            free(buf->buf);
+    }
+    else {
+        errlogPrintf ( "CAS: Corrupt buffer free list type code=%u during cleanup?\n",
+            buf->type );
+    }
+    buf->buf = NULL;
+}
+
 void casExpandRecvBuffer ( struct client *pClient, ca_uint32_t size )
 {
     casExpandBuffer (&pClient->recv, size, 0);
@@ -1494,6 +1693,16 @@ struct client *create_tcp_client (SOCKET sock , const osiSockAddr *peerAddr)
         return NULL;
     }
 
+    if ( rsrvEventBatchSize > 1 ) {
+        status = db_add_event_batch ( client->evuser, rsrv_event_batch,
+            client, (unsigned) rsrvEventBatchSize );
+        if (status != DB_EVENT_OK) {
+            errlogPrintf("CAS: unable to setup batched event delivery\n");
+            destroy_tcp_client (client);
+            return NULL;
+        }
+    }
+
     {
         epicsThreadBooleanStatus    tbs;
 
@@ -0,0 +1,376 @@
+/*************************************************************************\
+* EPICS Base is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+/*
+ *  Shared I/O threads for TCP clients
+ *
+ *  When rsrvIoThreads is set, the sockets of all TCP clients are
+ *  watched by one epoll set, which a fixed number of threads wait on.
+ *  Each client is registered with EPOLLONESHOT, so only one thread at
+ *  a time receives from it and runs camessage(), as the per-client
+ *  camsgtask() thread would.  The client is re-armed when that thread
+ *  has finished with it.
+ *
+ *  The sockets are non-blocking.  A thread never waits for a client:
+ *  when the send queue is full, or a put callback request must wait
+ *  for the previous one to complete, the client's remaining requests
+ *  are left in its receive buffer.  The client is then re-armed for
+ *  EPOLLOUT, by this thread when the send queue backs up, or by
+ *  casIoPoolResume() when the put callback completes or its wait
+ *  times out.  Only a reply which doesn't fit the send queue, such
+ *  as a large array, waits for the socket while it is streamed.
+ *
+ *  The clients ready at the same time are served in order of their CA
+ *  priority.  Each client still has its own event task, which sends
+ *  the subscription updates.
+ */
+
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+
+#include "dbDefs.h"
+#include "epicsAtomic.h"
+#include "epicsSignal.h"
+#include "epicsStdio.h"
+#include "epicsThread.h"
+#include "epicsTime.h"
+#include "epicsTimer.h"
+#include "errlog.h"
+#include "osiSock.h"
+#include "taskwd.h"
+
+#define epicsExportSharedSymbols
+#include "rsrv.h"
+#include "server.h"
+
+#if defined(__linux__)
+#  include <sys/epoll.h>
+#  include <unistd.h>
+#  define CAS_HAVE_EPOLL
+#endif
+
+#ifdef CAS_HAVE_EPOLL
+
+#define CAS_IO_MAX_EVENTS 64
+
+static int casIoFd = -1;
+static unsigned casIoNThreads;
+static int casIoNClients;
+static epicsTimerQueueId casIoTimerQueue;
+
+static int casIoArm ( struct client *client, unsigned events )
+{
+    struct epoll_event ev;
+
+    memset ( &ev, 0, sizeof ( ev ) );
+    ev.events = events | EPOLLONESHOT;
+    ev.data.ptr = client;
+    if ( epoll_ctl ( casIoFd, EPOLL_CTL_MOD, client->sock, &ev ) < 0 ) {
+        char sockErrBuf[64];
+
+        epicsSocketConvertErrnoToString ( sockErrBuf, sizeof ( sockErrBuf ) );
+        errlogPrintf ( "CAS: epoll re-arm failed: %s\n", sockErrBuf );
+        return RSRV_ERROR;
+    }
+    return RSRV_OK;
+}
+
+static void casIoRemove ( struct client *client )
+{
+    epoll_ctl ( casIoFd, EPOLL_CTL_DEL, client->sock, NULL );
+    epicsAtomicDecrIntT ( &casIoNClients );
+
+    /* waits for a running expire callback */
+    if ( client->ioTimer ) {
+        epicsTimerQueueDestroyTimer ( casIoTimerQueue, client->ioTimer );
+        client->ioTimer = 0;
+    }
+
+    LOCK_CLIENTQ;
+    ellDelete ( &clientQ, &client->node );
+    UNLOCK_CLIENTQ;
+
+    destroy_tcp_client ( client );
+}
+
+static void casIoPutExpire ( void *pParm )
+{
+    casIoPoolResume ( (struct client *) pParm );
+}
+
+/*
+ * Wait for the put callback without the thread, returns
+ * RSRV_OK when the client has been re-armed or will be
+ */
+static int casIoPutWait ( struct client *client )
+{
+    double delay;
+    int armNow = FALSE;
+
+    delay = CAS_PUT_NOTIFY_WAIT - ( epicsMonotonicGet () -
+        client->ioPutWaitStart ) / 1e9;
+    if ( delay < 0.0 ) {
+        delay = 0.0;
+    }
+
+    if ( ! client->ioTimer ) {
+        client->ioTimer = epicsTimerQueueCreateTimer ( casIoTimerQueue,
+            casIoPutExpire, client );
+        if ( ! client->ioTimer ) {
+            return RSRV_ERROR;
+        }
+    }
+
+    epicsMutexMustLock ( client->putNotifyLock );
+    if ( client->ioWoken ) {
+        client->ioWoken = FALSE;
+        armNow = TRUE;
+    }
+    else {
+        client->ioWaiting = TRUE;
+        epicsTimerStartDelay ( client->ioTimer, delay );
+    }
+    epicsMutexUnlock ( client->putNotifyLock );
+
+    return armNow ? casIoArm ( client, EPOLLOUT ) : RSRV_OK;
+}
+
+static void casIoService ( struct client *client )
+{
+    int sent;
+
+    client->tid = epicsThreadGetIdSelf ();
+    epicsThreadPrivateSet ( rsrvCurrentClient, client );
+
+    if ( castcp_ctl != ctlRun || client->disconnect ) {
+        epicsThreadPrivateSet ( rsrvCurrentClient, NULL );
+        casIoRemove ( client );
+        return;
+    }
+
+    /* nothing more is taken from the client until its queue has drained */
+    if ( ! casSendTry ( client ) ) {
+        epicsThreadPrivateSet ( rsrvCurrentClient, NULL );
+        if ( client->disconnect || casIoArm ( client, EPOLLOUT ) != RSRV_OK ) {
+            casIoRemove ( client );
+        }
+        return;
+    }
+
+    /* first the requests which were left in the receive buffer */
+    client->ioStopped = 0;
+    if ( client->recv.cnt > 0u && camsgprocess ( client ) != RSRV_OK ) {
+        epicsThreadPrivateSet ( rsrvCurrentClient, NULL );
+        casIoRemove ( client );
+        return;
+    }
+    if ( ! client->ioStopped && camsgrecv ( client ) != RSRV_OK ) {
+        epicsThreadPrivateSet ( rsrvCurrentClient, NULL );
+        casIoRemove ( client );
+        return;
+    }
+
+    /*
+     * camsgtask() flushes before it blocks in recv(), here
+     * the replies are flushed before the next wait instead
+     */
+    sent = casSendTry ( client );
+    epicsThreadPrivateSet ( rsrvCurrentClient, NULL );
+
+    if ( client->disconnect ) {
+        casIoRemove ( client );
+    }
+    else if ( client->ioStopped == CAS_IO_STOP_PUT && sent ) {
+        if ( casIoPutWait ( client ) != RSRV_OK ) {
+            casIoRemove ( client );
+        }
+    }
+    else if ( casIoArm ( client,
+                ( client->ioStopped || ! sent ) ? EPOLLOUT : EPOLLIN ) != RSRV_OK ) {
+        casIoRemove ( client );
+    }
+}
+
+/*
+ * Called by write_notify_reply() when a put callback has completed,
+ * and when the wait for it has timed out
+ */
+void casIoPoolResume ( struct client *client )
+{
+    int arm = FALSE;
+
+    epicsMutexMustLock ( client->putNotifyLock );
+    if ( client->ioWaiting ) {
+        client->ioWaiting = FALSE;
+        arm = TRUE;
+    }
+    else {
+        client->ioWoken = TRUE;
+    }
+    epicsMutexUnlock ( client->putNotifyLock );
+
+    /* a failure leaves the client to the put callback timeout */
+    if ( arm ) {
+        casIoArm ( client, EPOLLOUT );
+    }
+}
+
+static void casIoTask ( void *pParm )
+{
+    struct epoll_event events[CAS_IO_MAX_EVENTS];
+
+    epicsSignalInstallSigAlarmIgnore ();
+    epicsSignalInstallSigPipeIgnore ();
+    taskwdInsert ( epicsThreadGetIdSelf (), NULL, NULL );
+
+    while ( TRUE ) {
+        int i, n;
+
+        n = epoll_wait ( casIoFd, events, CAS_IO_MAX_EVENTS, -1 );
+        if ( n < 0 ) {
+            if ( errno != EINTR ) {
+                char sockErrBuf[64];
+
+                epicsSocketConvertErrnoToString (
+                    sockErrBuf, sizeof ( sockErrBuf ) );
+                errlogPrintf ( "CAS: epoll_wait failed: %s\n", sockErrBuf );
+                epicsThreadSleep ( 1.0 );
+            }
+            continue;
+        }
+
+        /* Serve the clients with the highest CA priority first */
+        for ( i = 1; i < n; i++ ) {
+            struct epoll_event ev = events[i];
+            unsigned priority = ( (struct client *) ev.data.ptr )->priority;
+            int j;
+
+            for ( j = i; j > 0 &&
+                    ( (struct client *) events[j-1].data.ptr )->priority < priority;
+                    j-- ) {
+                events[j] = events[j-1];
+            }
+            events[j] = ev;
+        }
+
+        /* Each client is in at most one of these lists (EPOLLONESHOT) */
+        for ( i = 0; i < n; i++ ) {
+            casIoService ( (struct client *) events[i].data.ptr );
+        }
+    }
+}
+
+int casIoPoolStart ( unsigned nthreads )
+{
+    unsigned i;
+
+    casIoFd = epoll_create ( 64 );
+    if ( casIoFd < 0 ) {
+        char sockErrBuf[64];
+
+        epicsSocketConvertErrnoToString ( sockErrBuf, sizeof ( sockErrBuf ) );
+        errlogPrintf ( "CAS: epoll_create failed: %s\n", sockErrBuf );
+        return RSRV_ERROR;
+    }
+
+    casIoTimerQueue = epicsTimerQueueAllocate ( 1,
+        epicsThreadPriorityCAServerLow );
+    if ( ! casIoTimerQueue ) {
+        errlogPrintf ( "CAS: timer queue creation failed\n" );
+        close ( casIoFd );
+        casIoFd = -1;
+        return RSRV_ERROR;
+    }
+
+    for ( i = 0; i < nthreads; i++ ) {
+        char name[20];
+
+        epicsSnprintf ( name, sizeof ( name ), "CAS-io%u", i );
+        if ( ! epicsThreadCreate ( name, epicsThreadPriorityCAServerLow,
+                    epicsThreadGetStackSize ( epicsThreadStackBig ),
+                    casIoTask, NULL ) ) {
+            errlogPrintf ( "CAS: task creation for %s failed\n", name );
+            break;
+        }
+    }
+    if ( i == 0 ) {
+        close ( casIoFd );
+        casIoFd = -1;
+        return RSRV_ERROR;
+    }
+    casIoNThreads = i;
+    return RSRV_OK;
+}
+
+int casIoPoolAdd ( struct client *client )
+{
+    struct epoll_event ev;
+    osiSockIoctl_t yes = TRUE;
+
+    if ( casIoFd < 0 ) {
+        return RSRV_ERROR;
+    }
+
+    if ( socket_ioctl ( client->sock, FIONBIO, &yes ) < 0 ) {
+        char sockErrBuf[64];
+
+        epicsSocketConvertErrnoToString ( sockErrBuf, sizeof ( sockErrBuf ) );
+        errlogPrintf ( "CAS: non-blocking socket failed: %s\n", sockErrBuf );
+        return RSRV_ERROR;
+    }
+    client->ioPool = TRUE;
+
+    memset ( &ev, 0, sizeof ( ev ) );
+    ev.events = EPOLLIN | EPOLLONESHOT;
+    ev.data.ptr = client;
+    epicsAtomicIncrIntT ( &casIoNClients );
+    if ( epoll_ctl ( casIoFd, EPOLL_CTL_ADD, client->sock, &ev ) < 0 ) {
+        char sockErrBuf[64];
+
+        epicsAtomicDecrIntT ( &casIoNClients );
+        epicsSocketConvertErrnoToString ( sockErrBuf, sizeof ( sockErrBuf ) );
+        errlogPrintf ( "CAS: epoll add failed: %s\n", sockErrBuf );
+        yes = FALSE;
+        socket_ioctl ( client->sock, FIONBIO, &yes );
+        client->ioPool = FALSE;
+        return RSRV_ERROR;
+    }
+    return RSRV_OK;
+}
+
+void casIoPoolShow ( void )
+{
+    if ( casIoFd >= 0 ) {
+        printf ( "%d TCP client%s served by %u I/O thread%s\n",
+            epicsAtomicGetIntT ( &casIoNClients ),
+            epicsAtomicGetIntT ( &casIoNClients ) == 1 ? "" : "s",
+            casIoNThreads, casIoNThreads == 1 ? "" : "s" );
+    }
+}
+
+#else /* CAS_HAVE_EPOLL */
+
+int casIoPoolStart ( unsigned nthreads )
+{
+    errlogPrintf ( "CAS: rsrvIoThreads is not supported on this target,"
+        " using one thread per client\n" );
+    return RSRV_ERROR;
+}
+
+int casIoPoolAdd ( struct client *client )
+{
+    return RSRV_ERROR;
+}
+
+void casIoPoolResume ( struct client *client )
+{
+}
+
+void casIoPoolShow ( void )
+{
+}
+
+#endif /* CAS_HAVE_EPOLL */
@@ -0,0 +1,153 @@
+/*************************************************************************\
+* EPICS Base is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+/*
+ *  Negative name search cache
+ *
+ *  Remembers the names which dbChannelTest() did not find, so repeated
+ *  searches for names which are served elsewhere are answered without
+ *  parsing the name and looking up the record again.
+ *
+ *  The table is direct mapped, a new name replaces whatever was in its
+ *  slot.  Each slot is guarded by a sequence count which is odd while
+ *  the slot is written, readers compare the name and then check that
+ *  the count is unchanged.  So the UDP threads need no lock, and a
+ *  writer which finds a slot busy just doesn't add its name.
+ *
+ *  Each entry keeps the dbPvdGeneration() at which the lookup failed,
+ *  and is ignored once a record or alias has been added since.
+ */
+
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "dbDefs.h"
+#include "epicsAtomic.h"
+#include "epicsStdio.h"
+#include "epicsString.h"
+#include "errlog.h"
+
+#define epicsExportSharedSymbols
+#include "dbChannel.h"
+#include "dbStaticLib.h"
+#include "dbStaticPvt.h"
+#include "rsrv.h"
+#include "server.h"
+
+/* longer names are not cached */
+#define CAS_NEGCACHE_NAMESZ 80
+
+typedef struct {
+    size_t          seq;
+    int             gen;
+    unsigned        hash;
+    unsigned        len;
+    char            name[CAS_NEGCACHE_NAMESZ];
+} casNegEntry;
+
+static casNegEntry *casNegTable;
+static unsigned casNegMask;
+static size_t casNegLookups, casNegHits;
+
+int casNegCacheInit ( unsigned size )
+{
+    unsigned n = 1u;
+
+    while ( n < size && n < 0x100000u ) {
+        n <<= 1;
+    }
+    casNegTable = calloc ( n, sizeof ( *casNegTable ) );
+    if ( ! casNegTable ) {
+        errlogPrintf ( "CAS: No memory for a name cache of %u entries\n", n );
+        return RSRV_ERROR;
+    }
+    casNegMask = n - 1u;
+    return RSRV_OK;
+}
+
+static int casNegCacheFind ( const casNegEntry *pEnt, int gen,
+    unsigned hash, const char *pName, unsigned len )
+{
+    size_t seq = epicsAtomicGetSizeT ( &pEnt->seq );
+    int found;
+
+    if ( seq & 1u ) {
+        return FALSE;
+    }
+    epicsAtomicReadMemoryBarrier ();
+    found = pEnt->gen == gen && pEnt->hash == hash && pEnt->len == len &&
+        memcmp ( pEnt->name, pName, len ) == 0;
+    epicsAtomicReadMemoryBarrier ();
+    return found && epicsAtomicGetSizeT ( &pEnt->seq ) == seq;
+}
+
+static void casNegCacheAdd ( casNegEntry *pEnt, int gen,
+    unsigned hash, const char *pName, unsigned len )
+{
+    size_t seq = epicsAtomicGetSizeT ( &pEnt->seq );
+
+    if ( ( seq & 1u ) ||
+            epicsAtomicCmpAndSwapSizeT ( &pEnt->seq, seq, seq + 1u ) != seq ) {
+        return;
+    }
+    pEnt->gen = gen;
+    pEnt->hash = hash;
+    pEnt->len = len;
+    memcpy ( pEnt->name, pName, len );
+    epicsAtomicWriteMemoryBarrier ();
+    epicsAtomicSetSizeT ( &pEnt->seq, seq + 2u );
+}
+
+/*
+ * dbChannelTest() for the name searches
+ */
+long casChannelTest ( const char *pName )
+{
+    casNegEntry *pEnt;
+    size_t len;
+    unsigned hash;
+    int gen;
+    long status;
+
+    if ( ! casNegTable ) {
+        return dbChannelTest ( pName );
+    }
+
+    len = strlen ( pName );
+    if ( len > CAS_NEGCACHE_NAMESZ ) {
+        return dbChannelTest ( pName );
+    }
+
+    /* before the lookup, so names added during it invalidate the entry */
+    gen = dbPvdGeneration ();
+    hash = epicsMemHash ( pName, len, 0 );
+    pEnt = &casNegTable[hash & casNegMask];
+
+    epicsAtomicIncrSizeT ( &casNegLookups );
+    if ( casNegCacheFind ( pEnt, gen, hash, pName, (unsigned) len ) ) {
+        epicsAtomicIncrSizeT ( &casNegHits );
+        return S_dbLib_recNotFound;
+    }
+
+    status = dbChannelTest ( pName );
+    if ( status ) {
+        casNegCacheAdd ( pEnt, gen, hash, pName, (unsigned) len );
+    }
+    return status;
+}
+
+void casNegCacheShow ( void )
+{
+    size_t lookups, hits;
+
+    if ( ! casNegTable ) {
+        return;
+    }
+    lookups = epicsAtomicGetSizeT ( &casNegLookups );
+    hits = epicsAtomicGetSizeT ( &casNegHits );
+    printf ( "Name cache of %u entries, %lu of %lu lookups (%.1f%%) avoided\n",
+        casNegMask + 1u, (unsigned long) hits, (unsigned long) lookups,
+        lookups ? 100.0 * hits / lookups : 0.0 );
+}
@@ -0,0 +1,369 @@
+/*************************************************************************\
+* EPICS Base is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+/*
+ *  Server statistics
+ *
+ *  The counters in casStats are incremented with epicsAtomic operations
+ *  by whichever thread does the work, so collecting them takes no lock.
+ *  They are size_t, so wrap around like any other counter on 32 bit
+ *  targets.
+ *
+ *  The per client send counters are set the same way.  The event queue
+ *  figures and the per client lists are gathered when they are read,
+ *  with the client list locked while copying.  Scanned records get the
+ *  event queue totals from a snapshot taken at most once a second.
+ */
+
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define EPICS_PRIVATE_API
+
+#include "dbDefs.h"
+#include "epicsAtomic.h"
+#include "epicsMutex.h"
+#include "epicsStdio.h"
+#include "epicsString.h"
+#include "epicsThread.h"
+#include "epicsTime.h"
+#include "errlog.h"
+#include "osiSock.h"
+
+#define epicsExportSharedSymbols
+#include "rsrv.h"
+#include "server.h"
+
+/* indexed by CA command */
+static const char * const casStatCmmdNames[CAS_STAT_NCMMD + 1u] = {
+    "VERSION", "EVENT_ADD", "EVENT_CANCEL", "READ", "WRITE", "SNAPSHOT",
+    "SEARCH", "BUILD", "EVENTS_OFF", "EVENTS_ON", "READ_SYNC", "ERROR",
+    "CLEAR_CHANNEL", "RSRV_IS_UP", "NOT_FOUND", "READ_NOTIFY", "READ_BUILD",
+    "REPEATER_CONFIRM", "CREATE_CHAN", "WRITE_NOTIFY", "CLIENT_NAME",
+    "HOST_NAME", "ACCESS_RIGHTS", "ECHO", "REPEATER_REGISTER", "SIGNAL",
+    "CREATE_CH_FAIL", "SERVER_DISCONN", "SHM", "UNKNOWN"
+};
+
+typedef struct {
+    char            address[40];
+    char            host[64];
+    char            user[64];
+    unsigned        priority;
+    unsigned        channels;
+    unsigned long   pending;
+    unsigned long   sent;
+    unsigned long   sendRate;
+    double          sendSec;
+    dbEventQueueStats qstats;
+    dbEventHoldStats hstats;
+} casClientStats;
+
+/*
+ * Copy the figures of up to max clients, or just sum the event
+ * queues if pClients is NULL.  Returns the number of clients.
+ */
+static unsigned casStatClients ( casClientStats *pClients, unsigned max,
+    unsigned *pDepth, unsigned *pMaxDepth )
+{
+    struct client *client;
+    unsigned n = 0u;
+
+    *pDepth = *pMaxDepth = 0u;
+    if ( ! clientQlock ) {
+        return 0u;
+    }
+
+    LOCK_CLIENTQ;
+    for ( client = (struct client *) ellFirst ( &clientQ ); client;
+            client = (struct client *) ellNext ( &client->node ) ) {
+        dbEventQueueStats qstats;
+
+        memset ( &qstats, 0, sizeof ( qstats ) );
+        if ( client->evuser ) {
+            db_event_queue_status ( client->evuser, &qstats );
+        }
+        *pDepth += qstats.depth;
+        if ( qstats.depth > *pMaxDepth ) {
+            *pMaxDepth = qstats.depth;
+        }
+        if ( pClients && n < max ) {
+            casClientStats *pc = &pClients[n];
+
+            ipAddrToDottedIP ( &client->addr, pc->address,
+                sizeof ( pc->address ) );
+            strncpy ( pc->host, client->pHostName ? client->pHostName : "",
+                sizeof ( pc->host ) - 1u );
+            pc->host[sizeof ( pc->host ) - 1u] = '\0';
+            strncpy ( pc->user, client->pUserName ? client->pUserName : "",
+                sizeof ( pc->user ) - 1u );
+            pc->user[sizeof ( pc->user ) - 1u] = '\0';
+            pc->priority = client->priority;
+            epicsMutexMustLock ( client->chanListLock );
+            pc->channels = ellCount ( &client->chanList ) +
+                ellCount ( &client->chanPendingUpdateARList );
+            epicsMutexUnlock ( client->chanListLock );
+            pc->pending = epicsAtomicGetSizeT ( &client->statPending );
+            pc->sent = epicsAtomicGetSizeT ( &client->statSent );
+            pc->sendRate = epicsAtomicGetSizeT ( &client->statSendRate );
+            pc->sendSec = epicsAtomicGetSizeT ( &client->statSendUsec ) * 1e-6;
+            pc->qstats = qstats;
+            memset ( &pc->hstats, 0, sizeof ( pc->hstats ) );
+            if ( client->evuser ) {
+                db_event_hold_status ( client->evuser, &pc->hstats );
+            }
+        }
+        n++;
+    }
+    UNLOCK_CLIENTQ;
+
+    return n;
+}
+
+/* the event queue totals for casStatGet(), see casStatQueues() */
+#define CAS_STAT_SNAPSHOT_NS 1000000000u
+
+static epicsThreadOnceId casStatOnce = EPICS_THREAD_ONCE_INIT;
+static epicsMutexId casStatLock;
+static epicsUInt64 casStatQueueTime;
+static unsigned casStatDepth, casStatMaxDepth;
+
+static void casStatInit ( void *pParm )
+{
+    casStatLock = epicsMutexMustCreate ();
+}
+
+/*
+ * The event queue totals, summed again only when the snapshot is
+ * older than a second, so scanned records don't lock the client list
+ * and every event queue on each scan.
+ */
+static void casStatQueues ( unsigned *pDepth, unsigned *pMaxDepth )
+{
+    epicsUInt64 now = epicsMonotonicGet ();
+
+    epicsThreadOnce ( &casStatOnce, casStatInit, NULL );
+    epicsMutexMustLock ( casStatLock );
+    if ( ! casStatQueueTime ||
+            now - casStatQueueTime >= CAS_STAT_SNAPSHOT_NS ) {
+        casStatClients ( NULL, 0u, &casStatDepth, &casStatMaxDepth );
+        casStatQueueTime = now;
+    }
+    *pDepth = casStatDepth;
+    *pMaxDepth = casStatMaxDepth;
+    epicsMutexUnlock ( casStatLock );
+}
+
+static double casStatMsgs ( void )
+{
+    double total = 0.0;
+    unsigned i;
+
+    for ( i = 0u; i <= CAS_STAT_NCMMD; i++ ) {
+        total += epicsAtomicGetSizeT ( &casStats.msgs[i] );
+    }
+    return total;
+}
+
+/*
+ * casStatGet()
+ *
+ * Fetch one statistic by name, as used by the "CA Server" device
+ * support.  Returns 0, or -1 for an unknown name.
+ */
+int casStatGet ( const char *pName, double *pValue )
+{
+    static const struct {
+        const char *name;
+        size_t *pCount;
+    } counters[] = {
+        { "BYTES_IN", &casStats.bytesIn },
+        { "BYTES_OUT", &casStats.bytesOut },
+        { "SEARCH_HITS", &casStats.searchHits },
+        { "SEARCH_MISSES", &casStats.searchMisses },
+        { "SEND_STALLS", &casStats.sendStalls },
+        { "SEND_CALLS", &casStats.sendCalls },
+    };
+    unsigned i;
+
+    for ( i = 0u; i < NELEMENTS ( counters ); i++ ) {
+        if ( ! epicsStrCaseCmp ( pName, counters[i].name ) ) {
+            *pValue = epicsAtomicGetSizeT ( counters[i].pCount );
+            return 0;
+        }
+    }
+    if ( ! epicsStrCaseCmp ( pName, "SEND_TIME" ) ) {
+        *pValue = epicsAtomicGetSizeT ( &casStats.sendTimeUsec ) * 1e-6;
+        return 0;
+    }
+    if ( ! epicsStrCaseCmp ( pName, "MSGS" ) ) {
+        *pValue = casStatMsgs ();
+        return 0;
+    }
+    if ( ! epicsStrnCaseCmp ( pName, "MSGS:", 5 ) ) {
+        for ( i = 0u; i <= CAS_STAT_NCMMD; i++ ) {
+            if ( ! epicsStrCaseCmp ( pName + 5, casStatCmmdNames[i] ) ) {
+                *pValue = epicsAtomicGetSizeT ( &casStats.msgs[i] );
+                return 0;
+            }
+        }
+        return -1;
+    }
+    if ( ! epicsStrCaseCmp ( pName, "CLIENTS" ) ||
+            ! epicsStrCaseCmp ( pName, "CHANNELS" ) ) {
+        unsigned nchan = 0u, nconn = 0u;
+
+        if ( clientQlock ) {
+            casStatsFetch ( &nchan, &nconn );
+        }
+        *pValue = epicsStrCaseCmp ( pName, "CLIENTS" ) ? nchan : nconn;
+        return 0;
+    }
+    if ( ! epicsStrCaseCmp ( pName, "EVQ_DEPTH" ) ||
+            ! epicsStrCaseCmp ( pName, "EVQ_MAX" ) ) {
+        unsigned depth, maxDepth;
+
+        casStatQueues ( &depth, &maxDepth );
+        *pValue = epicsStrCaseCmp ( pName, "EVQ_MAX" ) ? depth : maxDepth;
+        return 0;
+    }
+    return -1;
+}
+
+void casStatsShow ( void )
+{
+    double sendTime = epicsAtomicGetSizeT ( &casStats.sendTimeUsec ) * 1e-6;
+    size_t sendCalls = epicsAtomicGetSizeT ( &casStats.sendCalls );
+
+    printf ( "Received %lu bytes in %.0f messages, sent %lu bytes\n",
+        (unsigned long) epicsAtomicGetSizeT ( &casStats.bytesIn ),
+        casStatMsgs (),
+        (unsigned long) epicsAtomicGetSizeT ( &casStats.bytesOut ) );
+    printf ( "Name searches found %lu, not found %lu\n",
+        (unsigned long) epicsAtomicGetSizeT ( &casStats.searchHits ),
+        (unsigned long) epicsAtomicGetSizeT ( &casStats.searchMisses ) );
+    printf ( "%lu TCP sends took %.3f sec, %.1f us each, %lu waited for a full queue\n",
+        (unsigned long) sendCalls, sendTime,
+        sendCalls ? sendTime * 1e6 / sendCalls : 0.0,
+        (unsigned long) epicsAtomicGetSizeT ( &casStats.sendStalls ) );
+}
+
+static void casJsonString ( FILE *fp, const char *pStr )
+{
+    fputc ( '"', fp );
+    for ( ; *pStr; pStr++ ) {
+        unsigned char c = (unsigned char) *pStr;
+
+        if ( c == '"' || c == '\\' ) {
+            fprintf ( fp, "\\%c", c );
+        }
+        else if ( c < 0x20u ) {
+            fprintf ( fp, "\\u%04x", c );
+        }
+        else {
+            fputc ( c, fp );
+        }
+    }
+    fputc ( '"', fp );
+}
+
+static void casStatsWrite ( FILE *fp )
+{
+    casClientStats *pClients = NULL;
+    unsigned nchan = 0u, nconn = 0u, depth, maxDepth, n, i;
+    epicsTimeStamp now;
+    char timeText[40];
+
+    /* room for a few more clients than there were a moment ago */
+    if ( clientQlock ) {
+        casStatsFetch ( &nchan, &nconn );
+    }
+    nconn += 16u;
+    pClients = calloc ( nconn, sizeof ( *pClients ) );
+    if ( ! pClients ) {
+        nconn = 0u;
+    }
+    n = casStatClients ( pClients, nconn, &depth, &maxDepth );
+    if ( n > nconn ) {
+        n = nconn;
+    }
+
+    epicsTimeGetCurrent ( &now );
+    epicsTimeToStrftime ( timeText, sizeof ( timeText ),
+        "%Y-%m-%dT%H:%M:%S.%06f", &now );
+
+    fprintf ( fp, "{\n  \"time\": \"%s\",\n", timeText );
+    fprintf ( fp, "  \"channels\": %u,\n", nchan );
+    fprintf ( fp, "  \"bytesIn\": %lu,\n  \"bytesOut\": %lu,\n",
+        (unsigned long) epicsAtomicGetSizeT ( &casStats.bytesIn ),
+        (unsigned long) epicsAtomicGetSizeT ( &casStats.bytesOut ) );
+    fprintf ( fp, "  \"messages\": {" );
+    for ( i = 0u; i <= CAS_STAT_NCMMD; i++ ) {
+        fprintf ( fp, "%s\n    \"%s\": %lu", i ? "," : "",
+            casStatCmmdNames[i],
+            (unsigned long) epicsAtomicGetSizeT ( &casStats.msgs[i] ) );
+    }
+    fprintf ( fp, "\n  },\n" );
+    fprintf ( fp, "  \"searchHits\": %lu,\n  \"searchMisses\": %lu,\n",
+        (unsigned long) epicsAtomicGetSizeT ( &casStats.searchHits ),
+        (unsigned long) epicsAtomicGetSizeT ( &casStats.searchMisses ) );
+    fprintf ( fp, "  \"sendCalls\": %lu,\n  \"sendSeconds\": %.6f,\n"
+        "  \"sendStalls\": %lu,\n",
+        (unsigned long) epicsAtomicGetSizeT ( &casStats.sendCalls ),
+        epicsAtomicGetSizeT ( &casStats.sendTimeUsec ) * 1e-6,
+        (unsigned long) epicsAtomicGetSizeT ( &casStats.sendStalls ) );
+    fprintf ( fp, "  \"eventQueueDepth\": %u,\n  \"eventQueueMax\": %u,\n",
+        depth, maxDepth );
+    fprintf ( fp, "  \"clients\": [" );
+    for ( i = 0u; i < n; i++ ) {
+        const casClientStats *pc = &pClients[i];
+
+        fprintf ( fp, "%s\n    {\"address\": ", i ? "," : "" );
+        casJsonString ( fp, pc->address );
+        fprintf ( fp, ", \"host\": " );
+        casJsonString ( fp, pc->host );
+        fprintf ( fp, ", \"user\": " );
+        casJsonString ( fp, pc->user );
+        fprintf ( fp, ",\n     \"priority\": %u, \"channels\": %u,"
+            " \"bytesOut\": %lu, \"bytesPerSec\": %lu,"
+            " \"sendSeconds\": %.6f, \"pendingBytes\": %lu,\n",
+            pc->priority, pc->channels, pc->sent, pc->sendRate,
+            pc->sendSec, pc->pending );
+        fprintf ( fp, "     \"eventQueueDepth\": %u, \"eventQueueMax\": %u,"
+            " \"eventQueueSize\": %u, \"eventsReplaced\": %lu,"
+            " \"eventsDropped\": %lu, \"eventsCoalesced\": %lu}",
+            pc->qstats.depth, pc->qstats.maxDepth, pc->qstats.size,
+            pc->qstats.nReplaced, pc->qstats.nDropped,
+            pc->hstats.nCoalesced );
+    }
+    fprintf ( fp, "%s]\n}\n", n ? "\n  " : "" );
+
+    free ( pClients );
+}
+
+/*
+ * casStatsDump()
+ *
+ * Write the statistics as a JSON object to pFile, or to stdout
+ */
+int casStatsDump ( const char *pFile )
+{
+    FILE *fp = stdout;
+
+    if ( pFile && *pFile ) {
+        fp = fopen ( pFile, "w" );
+        if ( ! fp ) {
+            errlogPrintf ( "casStatsDump: can't open \"%s\"\n", pFile );
+            return -1;
+        }
+    }
+    casStatsWrite ( fp );
+    if ( fp != stdout ) {
+        if ( fclose ( fp ) ) {
+            errlogPrintf ( "casStatsDump: error writing \"%s\"\n", pFile );
+            return -1;
+        }
+    }
+    return 0;
+}
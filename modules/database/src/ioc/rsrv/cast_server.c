@@ -108,6 +108,303 @@ static void clean_addrq(struct client *client)
 
 }
 
+/*
+ * cast_recv
+ *
+ * handle one datagram, which is in client->recv.buf
+ */
+static void cast_recv ( struct client *client,
+    const struct sockaddr_in *pAddr, unsigned size )
+{
+    int status;
+    int count=0;
+    size_t idx;
+
+    for(idx=0; casIgnoreAddrs[idx]; idx++)
+    {
+        if(pAddr->sin_addr.s_addr==casIgnoreAddrs[idx]) {
+            return; /* ignore */
+        }
+    }
+
+    if (casudp_ctl != ctlRun)
+        return;
+
+    client->recv.cnt = size;
+    client->recv.stk = 0ul;
+    CAS_STAT_ADD ( bytesIn, size );
+    epicsTimeGetCurrent(&client->time_at_last_recv);
+
+    client->minor_version_number = CA_UKN_MINOR_VERSION;
+    client->seqNoOfReq = 0;
+
+    /*
+     * If we are talking to a new client flush to the old one
+     * in case we are holding UDP messages waiting to
+     * see if the next message is for this same client.
+     */
+    if (client->send.stk>sizeof(caHdr)) {
+        status = memcmp(&client->addr, pAddr, sizeof(*pAddr));
+        if(status){
+            /*
+             * if the address is different
+             */
+            cas_send_dg_msg(client);
+            client->addr = *pAddr;
+        }
+    }
+    else {
+        client->addr = *pAddr;
+    }
+
+    if (CASDEBUG>1) {
+        char    buf[40];
+
+        ipAddrToDottedIP (&client->addr, buf, sizeof(buf));
+        errlogPrintf ("CAS: cast server msg of %d bytes from addr %s\n",
+            client->recv.cnt, buf);
+    }
+
+    if (CASDEBUG>2)
+        count = ellCount (&client->chanList);
+
+    status = camessage ( client );
+    if(status == RSRV_OK){
+        if(client->recv.cnt !=
+            client->recv.stk){
+            char buf[40];
+
+            ipAddrToDottedIP (&client->addr, buf, sizeof(buf));
+
+            epicsPrintf ("CAS: partial (damaged?) UDP msg of %d bytes from %s ?\n",
+                client->recv.cnt - client->recv.stk, buf);
+
+            epicsTimeToStrftime(buf, sizeof(buf), "%Y-%m-%d %H:%M:%S",
+                &client->time_at_last_recv);
+            epicsPrintf ("CAS: message received at %s\n", buf);
+        }
+    }
+    else if (CASDEBUG>0){
+        char buf[40];
+
+        ipAddrToDottedIP (&client->addr, buf, sizeof(buf));
+
+        epicsPrintf ("CAS: invalid (damaged?) UDP request from %s ?\n", buf);
+
+        epicsTimeToStrftime(buf, sizeof(buf), "%Y-%m-%d %H:%M:%S",
+            &client->time_at_last_recv);
+        epicsPrintf ("CAS: message received at %s\n", buf);
+    }
+
+    if (CASDEBUG>2) {
+        if ( ellCount (&client->chanList) ) {
+            errlogPrintf ("CAS: Fnd %d name matches (%d tot)\n",
+                ellCount(&client->chanList)-count,
+                ellCount(&client->chanList));
+        }
+    }
+}
+
+static void cast_recv_error ( void )
+{
+    if (SOCKERRNO != SOCK_EINTR) {
+        char sockErrBuf[64];
+        epicsSocketConvertErrnoToString (
+            sockErrBuf, sizeof ( sockErrBuf ) );
+        epicsPrintf ("CAS: UDP recv error: %s\n",
+                sockErrBuf);
+        epicsThreadSleep(1.0);
+    }
+}
+
+/*
+ * allow messages to batch up if more are comming,
+ * returns TRUE if the replies should be sent now
+ */
+static int cast_idle ( SOCKET recv_sock )
+{
+    osiSockIoctl_t nchars = 0; /* supress purify warning */
+    int status = socket_ioctl(recv_sock, FIONREAD, &nchars);
+
+    if (status<0) {
+        errlogPrintf ("CA cast server: Unable to fetch N characters pending\n");
+        return TRUE;
+    }
+    return nchars == 0;
+}
+
+#if defined(__linux__) && defined(MSG_WAITFORONE)
+#  define CAS_HAVE_MMSG
+#endif
+
+#ifdef CAS_HAVE_MMSG
+
+/*
+ * Datagrams are received with recvmmsg() into recvBuf, and the
+ * replies are built in sendBuf and sent with sendmmsg().  The send
+ * buffer of the client always points at the next free send slot.
+ */
+struct casUdpBatch {
+    unsigned            max;
+    unsigned            nsend;
+    char                *recvBuf;   /* max * MAX_UDP_RECV */
+    char                *sendBuf;   /* max * MAX_UDP_SEND */
+    struct sockaddr_in  *recvAddr;
+    struct sockaddr_in  *sendAddr;
+    struct iovec        *recvIov;
+    struct iovec        *sendIov;
+    struct mmsghdr      *recvMsg;
+    struct mmsghdr      *sendMsg;
+};
+
+static struct casUdpBatch * casUdpBatchCreate ( unsigned max )
+{
+    struct casUdpBatch *pb = calloc ( 1, sizeof ( *pb ) );
+    unsigned i;
+
+    if ( ! pb ) {
+        return NULL;
+    }
+    pb->max = max;
+    pb->recvBuf = malloc ( max * MAX_UDP_RECV );
+    pb->sendBuf = malloc ( max * MAX_UDP_SEND );
+    pb->recvAddr = calloc ( max, sizeof ( *pb->recvAddr ) );
+    pb->sendAddr = calloc ( max, sizeof ( *pb->sendAddr ) );
+    pb->recvIov = calloc ( max, sizeof ( *pb->recvIov ) );
+    pb->sendIov = calloc ( max, sizeof ( *pb->sendIov ) );
+    pb->recvMsg = calloc ( max, sizeof ( *pb->recvMsg ) );
+    pb->sendMsg = calloc ( max, sizeof ( *pb->sendMsg ) );
+    if ( ! pb->recvBuf || ! pb->sendBuf || ! pb->recvAddr || ! pb->sendAddr ||
+            ! pb->recvIov || ! pb->sendIov || ! pb->recvMsg || ! pb->sendMsg ) {
+        free ( pb->recvBuf );
+        free ( pb->sendBuf );
+        free ( pb->recvAddr );
+        free ( pb->sendAddr );
+        free ( pb->recvIov );
+        free ( pb->sendIov );
+        free ( pb->recvMsg );
+        free ( pb->sendMsg );
+        free ( pb );
+        return NULL;
+    }
+
+    for ( i = 0u; i < max; i++ ) {
+        pb->recvIov[i].iov_base = pb->recvBuf + i * MAX_UDP_RECV;
+        pb->recvIov[i].iov_len = MAX_UDP_RECV;
+        pb->recvMsg[i].msg_hdr.msg_iov = &pb->recvIov[i];
+        pb->recvMsg[i].msg_hdr.msg_iovlen = 1;
+        pb->recvMsg[i].msg_hdr.msg_name = &pb->recvAddr[i];
+        pb->sendMsg[i].msg_hdr.msg_iov = &pb->sendIov[i];
+        pb->sendMsg[i].msg_hdr.msg_iovlen = 1;
+        pb->sendMsg[i].msg_hdr.msg_name = &pb->sendAddr[i];
+        pb->sendMsg[i].msg_hdr.msg_namelen = sizeof ( pb->sendAddr[i] );
+    }
+    return pb;
+}
+
+static void casUdpBatchSend ( struct client *client )
+{
+    struct casUdpBatch *pb = client->pUdpBatch;
+    unsigned sent = 0u;
+
+    while ( sent < pb->nsend ) {
+        int status = sendmmsg ( client->sock, &pb->sendMsg[sent],
+            pb->nsend - sent, 0 );
+
+        if ( status < 0 ) {
+            char sockErrBuf[64];
+            char buf[128];
+
+            if ( SOCKERRNO == SOCK_EINTR ) {
+                continue;
+            }
+            epicsSocketConvertErrnoToString (
+                sockErrBuf, sizeof ( sockErrBuf ) );
+            ipAddrToDottedIP ( &pb->sendAddr[sent], buf, sizeof(buf) );
+            errlogPrintf( "CAS: UDP send to %s failed: %s\n",
+                buf, sockErrBuf);
+            /* skip this one */
+            status = 1;
+        }
+        else {
+            epicsTimeGetCurrent ( &client->time_at_last_send );
+        }
+        sent += (unsigned) status;
+    }
+    pb->nsend = 0u;
+}
+
+/*
+ * Called by cas_send_dg_msg() with the send lock held
+ */
+void casUdpBatchQueue ( struct client *client, char *pDG, int sizeDG )
+{
+    struct casUdpBatch *pb = client->pUdpBatch;
+
+    pb->sendIov[pb->nsend].iov_base = pDG;
+    pb->sendIov[pb->nsend].iov_len = sizeDG;
+    pb->sendAddr[pb->nsend] = client->addr;
+    pb->nsend++;
+
+    if ( pb->nsend == pb->max ) {
+        casUdpBatchSend ( client );
+    }
+    client->send.buf = pb->sendBuf + pb->nsend * MAX_UDP_SEND;
+}
+
+/*
+ * Send everything queued, keeping the version header
+ * which has already been added to the send buffer
+ */
+static void casUdpBatchFlush ( struct client *client )
+{
+    struct casUdpBatch *pb = client->pUdpBatch;
+
+    SEND_LOCK ( client );
+    if ( pb->nsend ) {
+        casUdpBatchSend ( client );
+        memcpy ( pb->sendBuf, client->send.buf, client->send.stk );
+        client->send.buf = pb->sendBuf;
+    }
+    SEND_UNLOCK ( client );
+}
+
+static void cast_server_batched ( struct client *client, SOCKET recv_sock,
+    struct casUdpBatch *pb )
+{
+    while (TRUE) {
+        int i, n;
+
+        for ( i = 0; i < (int) pb->max; i++ ) {
+            pb->recvMsg[i].msg_hdr.msg_namelen = sizeof ( pb->recvAddr[i] );
+        }
+
+        n = recvmmsg ( recv_sock, pb->recvMsg, pb->max, MSG_WAITFORONE, NULL );
+        if (n < 0) {
+            cast_recv_error ();
+        }
+
+        for ( i = 0; i < n; i++ ) {
+            client->recv.buf = pb->recvIov[i].iov_base;
+            cast_recv ( client, &pb->recvAddr[i], pb->recvMsg[i].msg_len );
+        }
+
+        if ( cast_idle ( recv_sock ) ) {
+            cas_send_dg_msg (client);
+            casUdpBatchFlush (client);
+            clean_addrq (client);
+        }
+    }
+}
+
+#else /* CAS_HAVE_MMSG */
+
+void casUdpBatchQueue ( struct client *client, char *pDG, int sizeDG )
+{
+}
+
+#endif /* CAS_HAVE_MMSG */
+
 /*
  * CAST_SERVER
  *
@@ -118,17 +415,18 @@ void cast_server(void *pParm)
 {
     rsrv_iface_config *conf = pParm;
     int                 status;
-    int                 count=0;
     int                 mysocket=0;
     struct sockaddr_in  new_recv_addr;
     osiSocklen_t        recv_addr_size;
-    osiSockIoctl_t      nchars;
     SOCKET              recv_sock, reply_sock;
     struct client      *client;
 
-    recv_addr_size = sizeof(new_recv_addr);
-
-    reply_sock = conf->udp;
+    if (conf->startshard) {
+        reply_sock = conf->udpshard[conf->startshard - 1];
+    }
+    else {
+        reply_sock = conf->udp;
+    }
 
     /*
      * setup new client structure but reuse old structure if
@@ -142,7 +440,11 @@ void cast_server(void *pParm)
         }
         epicsThreadSleep(300.0);
     }
-    if (conf->startbcast) {
+    if (conf->startshard) {
+        recv_sock = reply_sock;
+        conf->sclient[conf->startshard - 1] = client;
+    }
+    else if (conf->startbcast) {
         recv_sock = conf->udpbcast;
         conf->bclient = client;
     }
@@ -154,6 +456,22 @@ void cast_server(void *pParm)
 
     casAttachThreadToClient ( client );
 
+#ifdef CAS_HAVE_MMSG
+    if ( rsrvUdpBatch > 1 ) {
+        struct casUdpBatch *pb = casUdpBatchCreate ( rsrvUdpBatch );
+
+        if ( pb ) {
+            free ( client->send.buf );
+            client->send.buf = pb->sendBuf;
+            client->pUdpBatch = pb;
+        }
+        else {
+            errlogPrintf ( "CAS: No memory for UDP batches of %d\n",
+                rsrvUdpBatch );
+        }
+    }
+#endif
+
     /*
      * add placeholder for the first version message should it be needed
      */
@@ -164,7 +482,17 @@ void cast_server(void *pParm)
 
     epicsEventSignal(casudp_startStopEvent);
 
+#ifdef CAS_HAVE_MMSG
+    if ( client->pUdpBatch ) {
+        struct casUdpBatch *pb = client->pUdpBatch;
+
+        free ( client->recv.buf );
+        cast_server_batched ( client, recv_sock, pb );
+    }
+#endif
+
     while (TRUE) {
+        recv_addr_size = sizeof(new_recv_addr);
         status = recvfrom (
             recv_sock,
             client->recv.buf,
@@ -173,113 +501,13 @@ void cast_server(void *pParm)
             (struct sockaddr *)&new_recv_addr,
             &recv_addr_size);
         if (status < 0) {
-            if (SOCKERRNO != SOCK_EINTR) {
-                char sockErrBuf[64];
-                epicsSocketConvertErrnoToString (
-                    sockErrBuf, sizeof ( sockErrBuf ) );
-                epicsPrintf ("CAS: UDP recv error: %s\n",
-                        sockErrBuf);
-                epicsThreadSleep(1.0);
-            }
-
-        } else {
-            size_t idx;
-            for(idx=0; casIgnoreAddrs[idx]; idx++)
-            {
-                if(new_recv_addr.sin_addr.s_addr==casIgnoreAddrs[idx]) {
-                    status = -1; /* ignore */
-                    break;
-                }
-            }
+            cast_recv_error ();
         }
-
-        if (status >= 0 && casudp_ctl == ctlRun) {
-            client->recv.cnt = (unsigned) status;
-            client->recv.stk = 0ul;
-            epicsTimeGetCurrent(&client->time_at_last_recv);
-
-            client->minor_version_number = CA_UKN_MINOR_VERSION;
-            client->seqNoOfReq = 0;
-
-            /*
-             * If we are talking to a new client flush to the old one
-             * in case we are holding UDP messages waiting to
-             * see if the next message is for this same client.
-             */
-            if (client->send.stk>sizeof(caHdr)) {
-                status = memcmp(&client->addr,
-                    &new_recv_addr, recv_addr_size);
-                if(status){
-                    /*
-                     * if the address is different
-                     */
-                    cas_send_dg_msg(client);
-                    client->addr = new_recv_addr;
-                }
-            }
-            else {
-                client->addr = new_recv_addr;
-            }
-
-            if (CASDEBUG>1) {
-                char    buf[40];
-
-                ipAddrToDottedIP (&client->addr, buf, sizeof(buf));
-                errlogPrintf ("CAS: cast server msg of %d bytes from addr %s\n",
-                    client->recv.cnt, buf);
-            }
-
-            if (CASDEBUG>2)
-                count = ellCount (&client->chanList);
-
-            status = camessage ( client );
-            if(status == RSRV_OK){
-                if(client->recv.cnt !=
-                    client->recv.stk){
-                    char buf[40];
-
-                    ipAddrToDottedIP (&client->addr, buf, sizeof(buf));
-
-                    epicsPrintf ("CAS: partial (damaged?) UDP msg of %d bytes from %s ?\n",
-                        client->recv.cnt - client->recv.stk, buf);
-
-                    epicsTimeToStrftime(buf, sizeof(buf), "%Y-%m-%d %H:%M:%S",
-                        &client->time_at_last_recv);
-                    epicsPrintf ("CAS: message received at %s\n", buf);
-                }
-            }
-            else if (CASDEBUG>0){
-                char buf[40];
-
-                ipAddrToDottedIP (&client->addr, buf, sizeof(buf));
-
-                epicsPrintf ("CAS: invalid (damaged?) UDP request from %s ?\n", buf);
-
-                epicsTimeToStrftime(buf, sizeof(buf), "%Y-%m-%d %H:%M:%S",
-                    &client->time_at_last_recv);
-                epicsPrintf ("CAS: message received at %s\n", buf);
-            }
-
-            if (CASDEBUG>2) {
-                if ( ellCount (&client->chanList) ) {
-                    errlogPrintf ("CAS: Fnd %d name matches (%d tot)\n",
-                        ellCount(&client->chanList)-count,
-                        ellCount(&client->chanList));
-                }
-            }
+        else {
+            cast_recv ( client, &new_recv_addr, (unsigned) status );
         }
 
-        /*
-         * allow messages to batch up if more are comming
-         */
-        nchars = 0; /* supress purify warning */
-        status = socket_ioctl(recv_sock, FIONREAD, &nchars);
-        if (status<0) {
-            errlogPrintf ("CA cast server: Unable to fetch N characters pending\n");
-            cas_send_dg_msg (client);
-            clean_addrq (client);
-        }
-        else if (nchars == 0) {
+        if ( cast_idle ( recv_sock ) ) {
             cas_send_dg_msg (client);
             clean_addrq (client);
         }
@@ -35,6 +35,8 @@ epicsShareFunc int casClientInitiatingCurrentThread (
                         char * pBuf, size_t bufSize );
 epicsShareFunc void casStatsFetch (
                         unsigned *pChanCount, unsigned *pConnCount );
+epicsShareFunc int casStatGet ( const char *pName, double *pValue );
+epicsShareFunc int casStatsDump ( const char *pFile );
 
 #ifdef __cplusplus
 }
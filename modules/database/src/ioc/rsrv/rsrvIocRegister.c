@@ -26,12 +26,30 @@ static void casrCallFunc(const iocshArgBuf *args)
     casr(args[0].ival);
 }
 
+/* casStatsDump */
+static const iocshArg casStatsDumpArg0 = { "file",iocshArgString};
+static const iocshArg * const casStatsDumpArgs[1] = {&casStatsDumpArg0};
+static const iocshFuncDef casStatsDumpFuncDef = {"casStatsDump",1,casStatsDumpArgs};
+static void casStatsDumpCallFunc(const iocshArgBuf *args)
+{
+    casStatsDump(args[0].sval);
+}
+
 static
 void rsrvRegistrar(void)
 {
     rsrv_register_server();
     iocshRegister(&casrFuncDef,casrCallFunc);
+    iocshRegister(&casStatsDumpFuncDef,casStatsDumpCallFunc);
 }
 
 epicsExportAddress(int, CASDEBUG);
+epicsExportAddress(int, rsrvEventBatchSize);
+epicsExportAddress(int, rsrvIoThreads);
+epicsExportAddress(int, rsrvUdpBatch);
+epicsExportAddress(int, rsrvUdpThreads);
+epicsExportAddress(int, rsrvNegCacheSize);
+epicsExportAddress(double, rsrvClientRateLimit);
+epicsExportAddress(int, rsrvShmRingSize);
+epicsExportAddress(int, rsrvClientPeriods);
 epicsExportRegistrar(rsrvRegistrar);
@@ -21,6 +21,7 @@
 #   undef epicsExportSharedSymbols
 #endif /* ifdef epicsExportSharedSymbols */
 
+#include "epicsAtomic.h"
 #include "epicsThread.h"
 #include "epicsMutex.h"
 #include "epicsEvent.h"
@@ -28,10 +29,12 @@
 #include "asLib.h"
 #include "dbChannel.h"
 #include "dbNotify.h"
-#define CA_MINOR_PROTOCOL_REVISION 13
+#include "dbEvent.h"
+#define CA_MINOR_PROTOCOL_REVISION 14
 #include "caProto.h"
 #include "ellLib.h"
 #include "epicsTime.h"
+#include "epicsTimer.h"
 #include "epicsAssert.h"
 #include "osiSock.h"
 
@@ -67,17 +70,32 @@ struct message_buffer {
   /*! points to first filled byte in buffer */
   unsigned                  stk;
   unsigned                  maxstk;
-  /*! points to first unused byte in buffer (after filled bytes) */
+  /*! points to first unused byte in buffer (after filled bytes),
+   *  for send buffers the number of bytes already sent */
   unsigned                  cnt;
   enum messageBufferType    type;
 };
 
+/*
+ * Full send buffers are queued here instead of being sent or
+ * copied into a larger buffer, cas_send_bs_msg() writes out
+ * the queue and the current buffer with one system call.
+ * The queued buffers and the current one together hold at most
+ * CAS_SEND_QUE_BYTES, so a large buffer is only queued when the
+ * queue is short enough.
+ */
+#define CAS_SEND_QUE_MAX 8
+#define CAS_SEND_QUE_BYTES ( CAS_SEND_QUE_MAX * MAX_TCP )
+
 extern epicsThreadPrivateId rsrvCurrentClient;
 
 typedef struct client {
   ELLNODE               node;
   /*! guarded by SEND_LOCK()  aka. client::lock */
   struct message_buffer send;
+  /*! guarded by SEND_LOCK(), filled before send */
+  struct message_buffer sendQue[CAS_SEND_QUE_MAX];
+  unsigned              sendQueLen;
   /*! accessed by receive thread w/o locks cf. camsgtask() */
   struct message_buffer recv;
   epicsMutexId          lock;
@@ -101,9 +119,46 @@ typedef struct client {
   ca_uint32_t           seqNoOfReq; /* for udp  */
   unsigned              recvBytesToDrain;
   unsigned              priority;
+  struct casUdpBatch    *pUdpBatch; /* UDP only, see cast_server() */
+  /*! send rate, guarded by SEND_LOCK() */
+  epicsUInt64           sendRateTime;
+  epicsUInt64           sendRateBytes;
+  /*! send rate limit, guarded by SEND_LOCK() */
+  double                sendTokens; /* bytes, negative while over the limit */
+  epicsUInt64           sendTokenTime;
+  unsigned long         sendThrottled;
+  double                sendThrottleSec;
+  epicsUInt64           sendTime; /* ns in cas_send_bs_msg(), guarded by SEND_LOCK() */
+  /*! set with epicsAtomic, so casstats.c reads them without locks */
+  size_t                statSent; /* bytes */
+  size_t                statSendRate; /* bytes/sec, updated each second of sending */
+  size_t                statSendUsec; /* in cas_send_bs_msg() */
+  size_t                statPending; /* bytes left unsent by the last send */
+  unsigned              streamLeft; /* payload still to come, see cas_stream_header() */
+  epicsUInt64           tracePosted; /* oldest traced update not yet sent, see dbLatency.h */
+  struct caShm          *pShm; /* shared memory rings, see shm_action() */
+  char                  shmSend; /* send through pShm, guarded by SEND_LOCK() */
+  char                  shmRecv; /* receive through pShm, receive thread only */
+  /*! rsrvIoThreads pool only, see casiopool.c */
+  char                  ioPool; /* served by the pool, socket is non-blocking */
+  char                  ioStopped; /* requests left for later, CAS_IO_STOP_* */
+  char                  ioWaiting; /* for a put callback, guarded by putNotifyLock */
+  char                  ioWoken; /* put callback done, guarded by putNotifyLock */
+  epicsUInt64           ioPutWaitStart; /* 0 unless a put callback request waits */
+  epicsTimerId          ioTimer; /* ends the wait for a put callback */
   char                  disconnect; /* disconnect detected */
 } client;
 
+/* Why camessage() stopped early for a client of the I/O pool */
+#define CAS_IO_STOP_SEND 1 /* the send queue is full */
+#define CAS_IO_STOP_PUT  2 /* a put callback is still in progress */
+
+/* How long a put callback request waits for the previous one, sec */
+#define CAS_PUT_NOTIFY_WAIT 60.0
+
+/* How long a send waits for space in a full shared memory ring, sec */
+#define CAS_SHM_SEND_WAIT 30.0
+
 /* Channel state shows which struct client list a
  * channel_in_us::node is in.
  *
@@ -163,12 +218,38 @@ typedef struct {
                 udpbcastAddr; /* UDP name broadcast receiver endpoint */
     SOCKET tcp, udp, udpbcast;
     struct client *client, *bclient;
+    /* more unicast receivers bound to udpAddr, see rsrvUdpThreads */
+    SOCKET *udpshard;
+    struct client **sclient;
+    unsigned nudpshard;
 
     unsigned int startbcast:1;
+    unsigned startshard; /* 1 + index in udpshard */
 } rsrv_iface_config;
 
 enum ctl {ctlInit, ctlRun, ctlPause, ctlExit};
 
+/*
+ * Server statistics, see casstats.c.  These are only changed
+ * with epicsAtomic operations, so counting takes no locks.
+ */
+#define CAS_STAT_NCMMD 29u /* commands counted separately */
+typedef struct casStatCounters {
+    size_t bytesIn;
+    size_t bytesOut;
+    size_t msgs[CAS_STAT_NCMMD + 1u]; /* the last for unknown commands */
+    size_t searchHits;
+    size_t searchMisses;
+    size_t sendStalls; /* sends waited for as the send queue was full */
+    size_t sendCalls;
+    size_t sendTimeUsec;
+} casStatCounters;
+
+#define CAS_STAT_ADD(FIELD, N) \
+    epicsAtomicAddSizeT ( &casStats.FIELD, (size_t) (N) )
+#define CAS_STAT_INCR(FIELD) \
+    epicsAtomicIncrSizeT ( &casStats.FIELD )
+
 /*  NOTE: external used so they remember the state across loads */
 #ifdef  GLBLSOURCE
 #   define GLBLTYPE
@@ -189,6 +270,14 @@ enum ctl {ctlInit, ctlRun, ctlPause, ctlExit};
 #endif
 
 GLBLTYPE int                CASDEBUG;
+GLBLTYPE int                rsrvEventBatchSize; /* updates per batch, 0 for none */
+GLBLTYPE int                rsrvIoThreads; /* 0 for a thread per client */
+GLBLTYPE int                rsrvUdpBatch; /* datagrams per system call, 0 for one */
+GLBLTYPE int                rsrvUdpThreads; /* receivers per unicast UDP port */
+GLBLTYPE int                rsrvNegCacheSize; /* names not found to remember */
+GLBLTYPE double             rsrvClientRateLimit; /* bytes/sec, 0 for none */
+GLBLTYPE int                rsrvShmRingSize; /* bytes, 0 for TCP only */
+GLBLTYPE int                rsrvClientPeriods; /* honour m_toval of event add */
 GLBLTYPE unsigned short     ca_server_port, ca_udp_port, ca_beacon_port;
 GLBLTYPE ELLLIST            clientQ             GLBLTYPE_INIT(ELLLIST_INIT);
 GLBLTYPE ELLLIST            servers; /* rsrv_iface_config::node, read-only after rsrv_init() */
@@ -206,6 +295,7 @@ GLBLTYPE void               *rsrvLargeBufFreeListTCP;
 GLBLTYPE unsigned           rsrvSizeofLargeBufTCP;
 GLBLTYPE void               *rsrvPutNotifyFreeList;
 GLBLTYPE unsigned           rsrvChannelCount; /* locked by clientQlock */
+GLBLTYPE casStatCounters    casStats;
 
 GLBLTYPE epicsEventId       casudp_startStopEvent;
 GLBLTYPE epicsEventId       beacon_startStopEvent;
@@ -229,8 +319,23 @@ extern "C" {
 #endif
 
 void camsgtask (void *client);
+int camsgrecv ( struct client *client );
+int camsgprocess ( struct client *client );
+int casIoPoolStart ( unsigned nthreads );
+int casIoPoolAdd ( struct client *client );
+void casIoPoolResume ( struct client *client );
+void casIoPoolShow ( void );
+int casNegCacheInit ( unsigned size );
+long casChannelTest ( const char *pName );
+void casNegCacheShow ( void );
+void casStatsShow ( void );
 void cas_send_bs_msg ( struct client *pclient, int lock_needed );
+int casSendTry ( struct client *pclient );
+int casSendBacklog ( struct client *pclient );
+void casSendThrottle ( struct client *pclient );
+double casSendRateLimit ( const struct client *pclient );
 void cas_send_dg_msg ( struct client *pclient );
+void casUdpBatchQueue ( struct client *pclient, char *pDG, int sizeDG );
 void rsrv_online_notify_task (void *);
 void cast_server (void *);
 struct client *create_client ( SOCKET sock, int proto );
@@ -240,6 +345,7 @@ void destroy_tcp_client ( struct client * );
 void casAttachThreadToClient ( struct client * );
 int camessage ( struct client *client );
 void rsrv_extra_labor ( void * pArg );
+EVENTBATCHFUNC rsrv_event_batch;
 int rsrvCheckPut ( const struct channel_in_use *pciu );
 int rsrv_version_reply ( struct client *client );
 void rsrvFreePutNotify ( struct client *pClient,
@@ -256,6 +362,9 @@ void casExpandRecvBuffer ( struct client *pClient, ca_uint32_t size );
  * outgoing protocol maintenance
  */
 void casExpandSendBuffer ( struct client *pClient, ca_uint32_t size );
+int casQueueSendBuffer ( struct client *pClient, ca_uint32_t size );
+unsigned casSendPending ( const struct client *pClient );
+void casFreeBuffer ( struct message_buffer *buf );
 int cas_copy_in_header (
     struct client *pClient, ca_uint16_t response, ca_uint32_t payloadSize,
     ca_uint16_t dataType, ca_uint32_t nElem, ca_uint32_t cid,
@@ -263,6 +372,13 @@ int cas_copy_in_header (
 void cas_set_header_cid ( struct client *pClient, ca_uint32_t );
 void cas_set_header_count (struct client *pClient, ca_uint32_t count);
 void cas_commit_msg ( struct client *pClient, ca_uint32_t size );
+int cas_stream_header ( struct client *pclient, ca_uint16_t response,
+    ca_uint32_t payloadSize, ca_uint16_t dataType, ca_uint32_t nElem,
+    ca_uint32_t cid, ca_uint32_t responseSpecific );
+void * cas_stream_space ( struct client *pclient, unsigned minSize,
+    unsigned *pSize );
+void cas_stream_commit ( struct client *pclient, unsigned size );
+void cas_stream_end ( struct client *pclient );
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,60 @@
+/*************************************************************************\
+* EPICS BASE is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+
+/*
+ *   Device support for the CA server statistics
+ *
+ *   INP is "@name", with a name known to casStatGet().
+ */
+
+#include <stdlib.h>
+
+#include "alarm.h"
+#include "dbDefs.h"
+#include "dbAccess.h"
+#include "recGbl.h"
+#include "devSup.h"
+#include "rsrv.h"
+
+#include "aiRecord.h"
+#include "epicsExport.h"
+
+static long init_ai(dbCommon *pcommon)
+{
+    aiRecord *prec = (aiRecord *)pcommon;
+    double junk;
+
+    if (prec->inp.type != INST_IO) {
+        recGblRecordError(S_db_badField, (void *)prec,
+                          "devAiCasStats::init_ai: Illegal INP field");
+        prec->pact = TRUE;
+        return S_db_badField;
+    }
+
+    if (casStatGet(prec->inp.value.instio.string, &junk)) {
+        recGblRecordError(S_db_badField, (void *)prec,
+                          "devAiCasStats::init_ai: Bad parm");
+        prec->pact = TRUE;
+        return S_db_badField;
+    }
+    return 0;
+}
+
+static long read_ai(aiRecord *prec)
+{
+    if (casStatGet(prec->inp.value.instio.string, &prec->val)) {
+        prec->udf = TRUE;
+        recGblSetSevr(prec, READ_ALARM, INVALID_ALARM);
+        return -1;
+    }
+    prec->udf = FALSE;
+    return 2;
+}
+
+aidset devAiCasStats = {
+    {6, NULL, NULL, init_ai, NULL},
+    read_ai,  NULL
+};
+epicsExportAddress(dset, devAiCasStats);
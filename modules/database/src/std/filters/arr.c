@@ -15,6 +15,7 @@
 
 #include <freeList.h>
 #include <dbAccess.h>
+#include <dbEvent.h>
 #include <dbExtractArray.h>
 #include <db_field_log.h>
 #include <dbLock.h>
@@ -150,6 +151,11 @@ static db_field_log* filter(void* pvt, dbChannel *chan, db_field_log *pfl)
         nSource = pfl->no_elements;
         nTarget = wrapArrayIndices(&start, my->incr, &end, nSource);
         pfl->no_elements = nTarget;
+        if (my->incr == 1 && db_field_log_is_snapshot(pfl)) {
+            /* A contiguous slice of a shared snapshot needs no copy */
+            pfl->u.r.field = (char *) pfl->u.r.field + start * pfl->field_size;
+            break;
+        }
         if (nTarget) {
             /* Copy the data out */
             void *psrc = pfl->u.r.field;
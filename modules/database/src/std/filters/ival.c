@@ -0,0 +1,101 @@
+/*************************************************************************\
+* EPICS BASE is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+
+/*
+ *  Minimum interval between monitor updates.
+ *
+ *  The filter itself passes every update; it only sets the channel's
+ *  min_interval, and the event queue holds back the updates arriving
+ *  sooner than that, sending only the latest at the end of the interval.
+ */
+
+#include <stdio.h>
+
+#include "freeList.h"
+#include "dbChannel.h"
+#include "chfPlugin.h"
+#include "epicsExit.h"
+#include "epicsExport.h"
+
+typedef struct myStruct {
+    double t;
+} myStruct;
+
+static void *myStructFreeList;
+
+static const
+chfPluginArgDef opts[] = {
+    chfDouble(myStruct, t, "t", 1, 1),
+    chfPluginArgEnd
+};
+
+static void * allocPvt(void)
+{
+    myStruct *my = (myStruct*) freeListCalloc(myStructFreeList);
+    return (void *) my;
+}
+
+static void freePvt(void *pvt)
+{
+    freeListFree(myStructFreeList, pvt);
+}
+
+static int parse_ok(void *pvt)
+{
+    myStruct *my = (myStruct*) pvt;
+
+    if (!(my->t >= 0.0))
+        return -1;
+
+    return 0;
+}
+
+static long channel_open(dbChannel *chan, void *pvt)
+{
+    myStruct *my = (myStruct*) pvt;
+
+    /* the longest interval wins if the filter is given twice */
+    if (my->t > chan->min_interval)
+        chan->min_interval = my->t;
+    return 0;
+}
+
+static void channel_report(dbChannel *chan, void *pvt, int level, const unsigned short indent)
+{
+    myStruct *my = (myStruct*) pvt;
+    printf("%*sMinimum interval (ival): t=%g\n", indent, "", my->t);
+}
+
+static chfPluginIf pif = {
+    allocPvt,
+    freePvt,
+
+    NULL, /* parse_error, */
+    parse_ok,
+
+    channel_open,
+    NULL, /* channelRegisterPre, */
+    NULL, /* channelRegisterPost, */
+    channel_report,
+    NULL /* channel_close */
+};
+
+static void ivalShutdown(void* ignore)
+{
+    if (myStructFreeList)
+        freeListCleanup(myStructFreeList);
+    myStructFreeList = NULL;
+}
+
+static void ivalInitialize(void)
+{
+    if (!myStructFreeList)
+        freeListInitPvt(&myStructFreeList, sizeof(myStruct), 64);
+
+    chfPluginRegister("ival", &pif, opts);
+    epicsAtExit(ivalShutdown, NULL);
+}
+
+epicsExportRegistrar(ivalInitialize);
@@ -20,6 +20,7 @@
 
 #include "callback.h"
 #include "cantProceed.h"
+#include "epicsAtomic.h"
 #include "epicsThread.h"
 #include "epicsEvent.h"
 #include "epicsTime.h"
@@ -96,6 +97,75 @@ static void printStats(double *stats, const char* tag) {
             sqrt(stats[4]*stats[3]-pow(stats[2], 2.0))/stats[4]);
 }
 
+/*
+ * With callbackWorkerQueues set each thread has its own queue.  Requests
+ * are spread over the queues, and a thread which has emptied its own
+ * takes from the others.  Each callback holds its thread for a while,
+ * so all the threads should take part.
+ */
+#define NWORKERCALLBACKS 100
+
+static epicsCallback workerCb[NWORKERCALLBACKS];
+static epicsThreadId workerTid[NWORKERCALLBACKS];
+static int workerDone;
+static epicsEventId workerFinished;
+
+static void workerCallback(epicsCallback *pCallback)
+{
+    workerTid[pCallback - workerCb] = epicsThreadGetIdSelf();
+    epicsThreadSleep(0.01);
+    if (epicsAtomicIncrIntT(&workerDone) == NWORKERCALLBACKS)
+        epicsEventMustTrigger(workerFinished);
+}
+
+static void testWorkerQueues(int noCpus)
+{
+    callbackQueueStats stats;
+    callbackQueueExtStats ext;
+    int i, j, nthreads, status;
+
+    if (noCpus < 2)
+        noCpus = 2;
+    testDiag("Starting %d parallel callback threads with their own queues",
+        noCpus);
+
+    callbackWorkerQueues = 1;
+    callbackParallelThreads(noCpus, "");
+    callbackInit();
+    workerFinished = epicsEventMustCreate(epicsEventEmpty);
+
+    for (i = 0; i < NWORKERCALLBACKS; i++) {
+        callbackSetCallback(workerCallback, &workerCb[i]);
+        callbackSetPriority(priorityLow, &workerCb[i]);
+        callbackRequest(&workerCb[i]);
+    }
+    status = epicsEventWaitWithTimeout(workerFinished, 30.0);
+    testOk(status == epicsEventOK, "%d of %d callbacks ran",
+        epicsAtomicGetIntT(&workerDone), NWORKERCALLBACKS);
+
+    for (i = 0, nthreads = 0; i < NWORKERCALLBACKS; i++) {
+        for (j = 0; j < i && workerTid[j] != workerTid[i]; j++)
+            ;
+        if (j == i)
+            nthreads++;
+    }
+    testOk(nthreads > 1, "Callbacks ran in %d threads", nthreads);
+
+    testOk1(callbackQueueStatus(0, &stats) == 0 &&
+        stats.numUsed[priorityLow] == 0);
+    status = callbackQueueExtStatus(&ext);
+    testOk(status == 0 &&
+        ext.maxWait[priorityLow] >= ext.meanWait[priorityLow] &&
+        ext.maxWait[priorityLow] > 0.0,
+        "Queue wait mean %.3f ms, max %.3f ms",
+        1e3 * ext.meanWait[priorityLow], 1e3 * ext.maxWait[priorityLow]);
+
+    callbackStop();
+    callbackCleanup();
+    epicsEventDestroy(workerFinished);
+    callbackWorkerQueues = 0;
+}
+
 MAIN(callbackParallelTest)
 {
     myPvt *pcbt[NCALLBACKS];
@@ -111,7 +181,7 @@ MAIN(callbackParallelTest)
         for (j = 0; j < 5; j++)
             setupError[i][j] = timeError[i][j] = defaultError[j];
 
-    testPlan(2);
+    testPlan(6);
 
     testDiag("Starting %d parallel callback threads", noCpus);
 
@@ -206,5 +276,7 @@ MAIN(callbackParallelTest)
     callbackStop();
     callbackCleanup();
 
+    testWorkerQueues(noCpus);
+
     return testDone();
 }
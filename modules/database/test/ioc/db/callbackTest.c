@@ -97,6 +97,88 @@ static void printStats(double *stats, const char* tag) {
             sqrt(stats[4]*stats[3]-pow(stats[2], 2.0))/stats[4]);
 }
 
+#define NGROW 16
+
+static epicsEventId blockerStarted, blockerRelease;
+static int growCount;
+
+static void blockerCallback(epicsCallback *pCallback)
+{
+    epicsEventSignal(blockerStarted);
+    epicsEventMustWait(blockerRelease);
+}
+
+static void countCallback(epicsCallback *pCallback)
+{
+    growCount++;
+}
+
+/*
+ * Stall the low priority thread, then check that its queue grows up
+ * to the limit and that each full-queue policy does what it says.
+ */
+static void testQueueGrowth(void)
+{
+    epicsCallback blocker, cb[NGROW];
+    callbackQueueStats stats;
+    callbackQueueExtStats ext;
+    int i, ok;
+
+    testDiag("Test queue growth and full-queue policies");
+
+    testOk1(callbackSetQueueSize(4) == 0);
+    testOk1(callbackSetQueueLimit(8, "drop") == 0);
+    testOk1(callbackSetQueueLimit(8, "sideways") == -1);
+    callbackInit();
+
+    blockerStarted = epicsEventMustCreate(epicsEventEmpty);
+    blockerRelease = epicsEventMustCreate(epicsEventEmpty);
+    callbackSetCallback(blockerCallback, &blocker);
+    callbackSetPriority(priorityLow, &blocker);
+    for (i = 0; i < NGROW; i++) {
+        callbackSetCallback(countCallback, &cb[i]);
+        callbackSetPriority(priorityLow, &cb[i]);
+    }
+    growCount = 0;
+
+    callbackRequest(&blocker);
+    epicsEventMustWait(blockerStarted);
+
+    /* 4 entries in the original ring, the other 4 of the limit of 8
+     * in its replacement */
+    for (ok = 0, i = 0; i < 13; i++)
+        if (!callbackRequest(&cb[i]))
+            ok++;
+    testOk(ok == 8, "%d of 13 requests queued", ok);
+    callbackQueueStatus(0, &stats);
+    callbackQueueExtStatus(&ext);
+    testOk(ext.numGrowths[priorityLow] == 1, "queue grew %d times",
+        ext.numGrowths[priorityLow]);
+    testOk(stats.size == 8, "queue size %d", stats.size);
+    testOk(stats.numOverflow[priorityLow] == 1, "%d overflows",
+        stats.numOverflow[priorityLow]);
+
+    callbackSetQueueLimit(8, "coalesce");
+    testOk(callbackRequest(&cb[0]) == 0, "queued request coalesced");
+    testOk(callbackRequest(&cb[13]) != 0, "new request dropped");
+    callbackQueueExtStatus(&ext);
+    testOk(ext.numCoalesced[priorityLow] == 1, "%d coalesced",
+        ext.numCoalesced[priorityLow]);
+
+    testOk(callbackSetQueueLimit(8, "dropOldest") == -1,
+        "queued callbacks are never dropped");
+
+    epicsEventSignal(blockerRelease);
+    for (i = 0; i < 50 && growCount < 8; i++)
+        epicsThreadSleep(0.1);
+    testOk(growCount == 8, "%d queued callbacks ran", growCount);
+
+    callbackStop();
+    callbackCleanup();
+    epicsEventDestroy(blockerStarted);
+    epicsEventDestroy(blockerRelease);
+}
+
 MAIN(callbackTest)
 {
     myPvt *pcbt[NCALLBACKS];
@@ -111,7 +193,7 @@ MAIN(callbackTest)
         for (j = 0; j < 5; j++)
             setupError[i][j] = timeError[i][j] = defaultError[j];
 
-    testPlan(2);
+    testPlan(14);
 
     callbackInit();
     epicsThreadSleep(1.0);
@@ -203,5 +285,7 @@ MAIN(callbackTest)
     callbackStop();
     callbackCleanup();
 
+    testQueueGrowth();
+
     return testDone();
 }
@@ -0,0 +1,644 @@
+/*************************************************************************\
+* EPICS BASE is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+
+/*
+ * Test the adaptive sizing of the event queues, batched delivery,
+ * the array snapshots shared by subscriptions, latency tracing and
+ * the minimum interval between updates
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#define EPICS_PRIVATE_API
+
+#include "dbAccess.h"
+#include "dbChannel.h"
+#include "dbEvent.h"
+#include "dbLatency.h"
+#include "dbLock.h"
+#include "dbUnitTest.h"
+#include "db_field_log.h"
+#include "epicsEvent.h"
+#include "epicsThread.h"
+#include "epicsTime.h"
+#include "errlog.h"
+#include "testMain.h"
+
+#include "arrRecord.h"
+#include "xRecord.h"
+
+void dbTestIoc_registerRecordDeviceDriver(struct dbBase *);
+
+static epicsEventId gateOpen, gateReached;
+static int nEvents;
+
+static void eventCallback(void *user_arg, struct dbChannel *chan,
+    int eventsRemaining, struct db_field_log *pfl)
+{
+    int first;
+
+    testGlobalLock();
+    first = nEvents++ == 0;
+    testGlobalUnlock();
+
+    /* Hold up the event task so that the queue fills */
+    if (first) {
+        epicsEventMustTrigger(gateReached);
+        epicsEventMustWait(gateOpen);
+    }
+}
+
+static int waitForEvents(int count)
+{
+    int i, n = 0;
+
+    for (i = 0; i < 100; i++) {
+        testGlobalLock();
+        n = nEvents;
+        testGlobalUnlock();
+        if (n >= count)
+            break;
+        epicsThreadSleep(0.05);
+    }
+    return n;
+}
+
+static void post(xRecord *prec, int count)
+{
+    int i;
+
+    dbScanLock((dbCommon *)prec);
+    for (i = 0; i < count; i++) {
+        prec->val = i;
+        db_post_events(prec, &prec->val, DBE_VALUE);
+    }
+    dbScanUnlock((dbCommon *)prec);
+}
+
+static void testQueueSize(void)
+{
+    dbEventQueueStats stats;
+    dbEventCtx ctx;
+    dbEventSubscription sub;
+    dbChannel *chan;
+    xRecord *prec;
+    unsigned size;
+    int i, n;
+
+    testDiag("Test event queue sizing");
+
+    prec = (xRecord *)testdbRecordPtr("reca");
+    nEvents = 0;
+
+    ctx = db_init_events();
+    testOk1(ctx != NULL);
+    testOk1(db_start_events(ctx, "testEvents", NULL, NULL,
+        epicsThreadPriorityMedium) == DB_EVENT_OK);
+
+    chan = dbChannelCreate("reca.VAL");
+    testOk1(chan && dbChannelOpen(chan) == 0);
+    sub = db_add_event(ctx, chan, eventCallback, NULL, DBE_VALUE);
+    testOk1(sub != NULL);
+    db_event_enable(sub);
+
+    db_event_queue_status(ctx, &stats);
+    size = stats.size;
+    testDiag("Initial queue size %u", size);
+
+    /* First update stalls the event task, the rest pile up */
+    post(prec, 1);
+    epicsEventMustWait(gateReached);
+    post(prec, 2 * size);
+
+    db_event_queue_status(ctx, &stats);
+    testOk(stats.nDropped > 0, "%lu updates dropped from a full queue",
+        stats.nDropped);
+    testOk(stats.depth > 0 && stats.depth == stats.maxDepth,
+        "queue depth %u, max %u", stats.depth, stats.maxDepth);
+
+    epicsEventMustTrigger(gateOpen);
+    n = waitForEvents(1 + stats.depth);
+    testOk(n == 1 + (int)stats.depth, "%d updates delivered", n);
+
+    for (i = 0; i < 50; i++) {
+        db_event_queue_status(ctx, &stats);
+        if (stats.nGrowths)
+            break;
+        epicsThreadSleep(0.05);
+    }
+    testOk(stats.nGrowths == 1 && stats.size == 2 * size,
+        "queue grew %u times to %u entries", stats.nGrowths, stats.size);
+
+    /* Lowering the limit shrinks the queue on the next pass */
+    db_event_set_queue_size(ctx, 0, size);
+    for (i = 0; i < 50; i++) {
+        db_event_queue_status(ctx, &stats);
+        if (stats.nShrinks)
+            break;
+        epicsThreadSleep(0.05);
+    }
+    testOk(stats.nShrinks == 1 && stats.size == size,
+        "queue shrunk %u times to %u entries", stats.nShrinks, stats.size);
+    testOk(stats.maxSize == size, "largest size now %u", stats.maxSize);
+
+    /* Updates still get through the resized queue */
+    testGlobalLock();
+    n = nEvents;
+    testGlobalUnlock();
+    post(prec, 1);
+    testOk(waitForEvents(n + 1) == n + 1, "update delivered after resize");
+
+    db_cancel_event(sub);
+    dbChannelDelete(chan);
+    db_close_events(ctx);
+}
+
+#define NADMITSUBS 50
+
+static int nCounted;
+
+static void countCallback(void *user_arg, struct dbChannel *chan,
+    int eventsRemaining, struct db_field_log *pfl)
+{
+    testGlobalLock();
+    nCounted++;
+    testGlobalUnlock();
+}
+
+/* How many subscriptions share a queue follows the largest queue size */
+static void testAdmission(unsigned sizeFactor, unsigned nQueues)
+{
+    dbEventSubscription subs[NADMITSUBS];
+    dbEventQueueStats stats;
+    dbEventCtx ctx;
+    dbChannel *chan;
+    unsigned size;
+    int i, n = 0;
+
+    ctx = db_init_events();
+    db_event_queue_status(ctx, &stats);
+    size = stats.size;
+    db_event_set_queue_size(ctx, 0, sizeFactor * size);
+    testOk1(db_start_events(ctx, "testAdmit", NULL, NULL,
+        epicsThreadPriorityMedium) == DB_EVENT_OK);
+
+    chan = dbChannelCreate("reca.VAL");
+    if (!chan || dbChannelOpen(chan))
+        testAbort("Can't open channel reca.VAL");
+    for (i = 0; i < NADMITSUBS; i++) {
+        subs[i] = db_add_event(ctx, chan, countCallback, NULL, DBE_VALUE);
+        db_event_enable(subs[i]);
+    }
+
+    db_event_queue_status(ctx, &stats);
+    testOk(stats.nQueues == nQueues && stats.size >= 4 * NADMITSUBS,
+        "%d subscriptions on %u queues of %u entries with up to %u",
+        NADMITSUBS, stats.nQueues, stats.size, sizeFactor * size);
+
+    testGlobalLock();
+    nCounted = 0;
+    testGlobalUnlock();
+    post((xRecord *)testdbRecordPtr("reca"), 1);
+    for (i = 0; i < 100 && n < NADMITSUBS; i++) {
+        epicsThreadSleep(0.05);
+        testGlobalLock();
+        n = nCounted;
+        testGlobalUnlock();
+    }
+    testOk(n == NADMITSUBS, "%d updates delivered", n);
+
+    for (i = 0; i < NADMITSUBS; i++)
+        db_cancel_event(subs[i]);
+    dbChannelDelete(chan);
+    db_close_events(ctx);
+}
+
+#define NBATCHSUBS 3
+
+static dbEventSubscription batchSubs[NBATCHSUBS];
+static int nBatchCalls, nBatchEntries, maxBatchEntries, badEntries;
+static int cancelInBatch;
+
+static void batchCallback(void *batch_arg, dbEventBatchEntry *entries,
+    unsigned count, int eventsRemaining)
+{
+    unsigned i;
+    int first;
+
+    testGlobalLock();
+    first = nBatchCalls++ == 0;
+    nBatchEntries += count;
+    if ((int)count > maxBatchEntries)
+        maxBatchEntries = count;
+    for (i = 0; i < count; i++)
+        if (entries[i].user_sub != eventCallback || !entries[i].pfl)
+            badEntries++;
+    testGlobalUnlock();
+
+    if (first) {
+        epicsEventMustTrigger(gateReached);
+        epicsEventMustWait(gateOpen);
+    }
+    /* Subscriptions in the batch may cancel themselves */
+    if (cancelInBatch && !first) {
+        for (i = 0; i < count; i++) {
+            if (entries[i].user_arg == (void *)&batchSubs[0]) {
+                db_cancel_event(batchSubs[0]);
+                batchSubs[0] = NULL;
+            }
+        }
+    }
+}
+
+static void testBatch(void)
+{
+    static const char * const names[NBATCHSUBS] = {
+        "recb.VAL", "recc.VAL", "recd.VAL"
+    };
+    dbChannel *chans[NBATCHSUBS];
+    dbEventQueueStats stats;
+    dbEventCtx ctx;
+    int i, n;
+
+    testDiag("Test batched event delivery");
+
+    ctx = db_init_events();
+    testOk1(db_add_event_batch(ctx, batchCallback, NULL, 0) == DB_EVENT_ERROR);
+    testOk1(db_add_event_batch(ctx, batchCallback, (void *)&batchSubs, 4)
+        == DB_EVENT_OK);
+    testOk1(db_start_events(ctx, "testBatch", NULL, NULL,
+        epicsThreadPriorityMedium) == DB_EVENT_OK);
+    testOk(db_add_event_batch(ctx, batchCallback, NULL, 4) == DB_EVENT_ERROR,
+        "batch function can not be changed once started");
+
+    for (i = 0; i < NBATCHSUBS; i++) {
+        chans[i] = dbChannelCreate(names[i]);
+        if (!chans[i] || dbChannelOpen(chans[i]))
+            testAbort("Can't open channel %s", names[i]);
+        batchSubs[i] = db_add_event(ctx, chans[i], eventCallback,
+            &batchSubs[i], DBE_VALUE);
+        db_event_enable(batchSubs[i]);
+    }
+
+    /* First batch stalls the event task, the rest pile up */
+    post((xRecord *)testdbRecordPtr("recb"), 1);
+    epicsEventMustWait(gateReached);
+    for (n = 0; n < 3; n++) {
+        for (i = 0; i < NBATCHSUBS; i++) {
+            char name[8];
+
+            strcpy(name, names[i]);
+            name[4] = '\0';
+            post((xRecord *)testdbRecordPtr(name), 1);
+        }
+    }
+    /* Canceling recb in the next batch purges its two later updates */
+    cancelInBatch = 1;
+    epicsEventMustTrigger(gateOpen);
+
+    for (i = 0; i < 100; i++) {
+        testGlobalLock();
+        n = nBatchEntries;
+        testGlobalUnlock();
+        if (n >= 1 + 3 * NBATCHSUBS - 2)
+            break;
+        epicsThreadSleep(0.05);
+    }
+    epicsThreadSleep(0.1);
+    testGlobalLock();
+    testOk(nBatchEntries == 1 + 3 * NBATCHSUBS - 2,
+        "%d events delivered in %d batches", nBatchEntries, nBatchCalls);
+    testOk(maxBatchEntries == NBATCHSUBS,
+        "up to %d events per batch", maxBatchEntries);
+    testOk(badEntries == 0, "%d bad batch entries", badEntries);
+    testGlobalUnlock();
+    testOk(batchSubs[0] == NULL, "subscription canceled from a batch");
+
+    db_event_queue_status(ctx, &stats);
+    testOk(stats.nBatched == (unsigned long)n && stats.nBatches > 1,
+        "%lu events in %lu batches reported", stats.nBatched, stats.nBatches);
+
+    for (i = 0; i < NBATCHSUBS; i++) {
+        if (batchSubs[i])
+            db_cancel_event(batchSubs[i]);
+        dbChannelDelete(chans[i]);
+    }
+    db_close_events(ctx);
+}
+
+#define NSNAPSUBS 3
+#define NSNAPELEMS 5
+
+static struct {
+    int nEvents;
+    int snapshot;
+    void *pvt;
+    long no_elements;
+    epicsInt32 data[NSNAPELEMS];
+} snapResult[NSNAPSUBS];
+
+static void snapCallback(void *user_arg, struct dbChannel *chan,
+    int eventsRemaining, struct db_field_log *pfl)
+{
+    int i = (int)(size_t)user_arg;
+    long n = pfl->no_elements < NSNAPELEMS ? pfl->no_elements : NSNAPELEMS;
+
+    testGlobalLock();
+    snapResult[i].nEvents++;
+    snapResult[i].snapshot = db_field_log_is_snapshot(pfl);
+    snapResult[i].pvt = pfl->u.r.pvt;
+    snapResult[i].no_elements = pfl->no_elements;
+    if (snapResult[i].snapshot && n > 0)
+        memcpy(snapResult[i].data, pfl->u.r.field, n * sizeof(epicsInt32));
+    testGlobalUnlock();
+}
+
+static int waitForSnapshots(int count)
+{
+    int i, j, n = 0;
+
+    for (i = 0; i < 100; i++) {
+        testGlobalLock();
+        for (n = NSNAPSUBS, j = 0; j < NSNAPSUBS; j++)
+            if (snapResult[j].nEvents < count)
+                n--;
+        testGlobalUnlock();
+        if (n == NSNAPSUBS)
+            break;
+        epicsThreadSleep(0.05);
+    }
+    return n;
+}
+
+static void postArray(arrRecord *prec, epicsInt32 first)
+{
+    epicsInt32 *pdata = (epicsInt32 *)prec->bptr;
+    int i;
+
+    dbScanLock((dbCommon *)prec);
+    for (i = 0; i < NSNAPELEMS; i++)
+        pdata[i] = first + i;
+    prec->nord = NSNAPELEMS;
+    db_post_events(prec, &prec->val, DBE_VALUE);
+    /* Subscribers must still see the values posted */
+    for (i = 0; i < NSNAPELEMS; i++)
+        pdata[i] = -1;
+    dbScanUnlock((dbCommon *)prec);
+}
+
+static void checkSnapshots(int count, epicsInt32 first)
+{
+    int i, j, ok;
+
+    testOk(waitForSnapshots(count) == NSNAPSUBS,
+        "update %d delivered to %d subscriptions", count, NSNAPSUBS);
+
+    testGlobalLock();
+    for (ok = 1, i = 0; i < NSNAPSUBS; i++)
+        ok &= snapResult[i].snapshot && snapResult[i].pvt == snapResult[0].pvt;
+    testOk(ok, "subscriptions share one snapshot");
+    for (ok = 1, i = 0; i < NSNAPSUBS; i++) {
+        ok &= snapResult[i].no_elements == NSNAPELEMS;
+        for (j = 0; j < NSNAPELEMS; j++)
+            ok &= snapResult[i].data[j] == first + j;
+    }
+    testOk(ok, "snapshot holds the values posted");
+    testGlobalUnlock();
+}
+
+static void testSnapshot(void)
+{
+    dbChannel *chans[NSNAPSUBS];
+    dbEventSubscription subs[NSNAPSUBS];
+    arrRecord *prec = (arrRecord *)testdbRecordPtr("i32");
+    dbEventCtx ctx;
+    int i;
+
+    testDiag("Test shared array snapshots");
+
+    ctx = db_init_events();
+    testOk1(db_start_events(ctx, "testSnapshot", NULL, NULL,
+        epicsThreadPriorityMedium) == DB_EVENT_OK);
+
+    for (i = 0; i < NSNAPSUBS; i++) {
+        chans[i] = dbChannelCreate("i32.VAL");
+        if (!chans[i] || dbChannelOpen(chans[i]))
+            testAbort("Can't open channel i32.VAL");
+        subs[i] = db_add_event(ctx, chans[i], snapCallback,
+            (void *)(size_t)i, DBE_VALUE);
+        db_event_enable(subs[i]);
+    }
+
+    dbEventArraySnapshots = 0;
+    postArray(prec, 1);
+    testOk(waitForSnapshots(1) == NSNAPSUBS && !snapResult[0].snapshot,
+        "no snapshots unless dbEventArraySnapshots is set");
+
+    dbEventArraySnapshots = 1;
+    postArray(prec, 1);
+    checkSnapshots(2, 1);
+    postArray(prec, 10);
+    checkSnapshots(3, 10);
+
+    for (i = 1; i < NSNAPSUBS; i++) {
+        db_cancel_event(subs[i]);
+        dbChannelDelete(chans[i]);
+    }
+    postArray(prec, 20);
+    for (i = 0; i < 100 && snapResult[0].nEvents < 4; i++)
+        epicsThreadSleep(0.05);
+    testOk(snapResult[0].nEvents == 4 && !snapResult[0].snapshot,
+        "no snapshot for a single subscription");
+
+    db_cancel_event(subs[0]);
+    dbChannelDelete(chans[0]);
+    db_close_events(ctx);
+    dbEventArraySnapshots = 0;
+}
+
+static epicsUInt64 latPostTime;
+
+static void latCallback(void *user_arg, struct dbChannel *chan,
+    int eventsRemaining, struct db_field_log *pfl)
+{
+    testGlobalLock();
+    latPostTime = pfl->postTime;
+    nEvents++;
+    testGlobalUnlock();
+}
+
+static void testLatency(void)
+{
+    dbEventCtx ctx;
+    dbEventSubscription sub;
+    dbChannel *chan;
+    xRecord *prec = (xRecord *)testdbRecordPtr("reca");
+    epicsUInt64 before;
+    char line[256];
+    int nPost = 0, nQueue = 0;
+    FILE *fp;
+
+    testDiag("Test monitor latency tracing");
+
+    ctx = db_init_events();
+    testOk1(db_start_events(ctx, "testLatency", NULL, NULL,
+        epicsThreadPriorityMedium) == DB_EVENT_OK);
+    chan = dbChannelCreate("reca.VAL");
+    if (!chan || dbChannelOpen(chan))
+        testAbort("Can't open channel reca.VAL");
+    sub = db_add_event(ctx, chan, latCallback, NULL, DBE_VALUE);
+    db_event_enable(sub);
+
+    nEvents = 0;
+    post(prec, 1);
+    testOk(waitForEvents(1) == 1 && latPostTime == 0,
+        "updates not stamped while tracing is off");
+
+    dbLatencyReset();
+    dbLatencyTracing = 1;
+    before = epicsMonotonicGet();
+    post(prec, 1);
+    testOk(waitForEvents(2) == 2 && latPostTime >= before &&
+        latPostTime <= epicsMonotonicGet(), "update stamped when posted");
+    dbLatencyTracing = 0;
+
+    testOk1(dbLatencyDump("dbEventQueueTest.json") == 0);
+    fp = fopen("dbEventQueueTest.json", "r");
+    while (fp && fgets(line, sizeof(line), fp)) {
+        nPost += strstr(line, "\"name\": \"post\"") != NULL;
+        nQueue += strstr(line, "\"name\": \"queue\"") != NULL;
+    }
+    if (fp)
+        fclose(fp);
+    remove("dbEventQueueTest.json");
+    testOk(nPost == 1 && nQueue == 1,
+        "trace holds %d post and %d queue samples", nPost, nQueue);
+
+    db_cancel_event(sub);
+    dbChannelDelete(chan);
+    db_close_events(ctx);
+}
+
+static epicsInt32 lastValue;
+static epicsUInt64 lastTime;
+
+static void ivalCallback(void *user_arg, struct dbChannel *chan,
+    int eventsRemaining, struct db_field_log *pfl)
+{
+    testGlobalLock();
+    if (pfl->type == dbfl_type_val)
+        lastValue = pfl->u.v.field.dbf_long;
+    lastTime = epicsMonotonicGet();
+    nEvents++;
+    testGlobalUnlock();
+}
+
+static void postValue(xRecord *prec, epicsInt32 val)
+{
+    dbScanLock((dbCommon *)prec);
+    prec->val = val;
+    db_post_events(prec, &prec->val, DBE_VALUE);
+    dbScanUnlock((dbCommon *)prec);
+}
+
+static void testMinInterval(void)
+{
+    dbEventHoldStats stats;
+    dbEventCtx ctx;
+    dbEventSubscription sub;
+    dbChannel *chan;
+    xRecord *prec = (xRecord *)testdbRecordPtr("reca");
+    epicsUInt64 start;
+    int n, logs;
+
+    testDiag("Test the minimum interval between updates");
+
+    ctx = db_init_events();
+    testOk1(db_start_events(ctx, "testInterval", NULL, NULL,
+        epicsThreadPriorityMedium) == DB_EVENT_OK);
+    chan = dbChannelCreate("reca.VAL");
+    if (!chan || dbChannelOpen(chan))
+        testAbort("Can't open channel reca.VAL");
+    sub = db_add_event(ctx, chan, ivalCallback, NULL, DBE_VALUE);
+    db_event_min_interval(sub, 1.0);
+    db_event_enable(sub);
+
+    nEvents = 0;
+    start = epicsMonotonicGet();
+    postValue(prec, 1);
+    n = waitForEvents(1);
+    testOk(n == 1 && lastValue == 1, "first update sent at once");
+
+    postValue(prec, 2);
+    postValue(prec, 3);
+    db_event_hold_status(ctx, &stats);
+    testOk(stats.nHeld == 1 && stats.nCoalesced == 1,
+        "%u update held, %lu coalesced", stats.nHeld, stats.nCoalesced);
+
+    n = waitForEvents(2);
+    testOk(n == 2 && lastValue == 3, "latest update sent, value %d",
+        lastValue);
+    testOk(lastTime - start >= 1000000000u,
+        "after %.3f seconds", (lastTime - start) * 1e-9);
+    epicsThreadSleep(0.1);
+    db_event_hold_status(ctx, &stats);
+    testOk(nEvents == 2 && stats.nHeld == 0, "nothing held afterwards");
+
+    /* Every update is sent again without an interval */
+    db_event_min_interval(sub, 0.0);
+    postValue(prec, 4);
+    postValue(prec, 5);
+    n = waitForEvents(4);
+    testOk(n == 4 && lastValue == 5, "%d updates sent with no interval", n);
+
+    /* Cancelling frees a held update */
+    db_event_min_interval(sub, 10.0);
+    postValue(prec, 6);
+    db_event_hold_status(ctx, &stats);
+    testOk1(stats.nHeld == 1);
+    logs = db_available_logs();
+    db_cancel_event(sub);
+    testOk(db_available_logs() == logs + 1, "held update freed by cancel");
+
+    dbChannelDelete(chan);
+    db_close_events(ctx);
+}
+
+MAIN(dbEventQueueTest)
+{
+    testPlan(49);
+
+    gateOpen = epicsEventMustCreate(epicsEventEmpty);
+    gateReached = epicsEventMustCreate(epicsEventEmpty);
+
+    testdbPrepare();
+
+    testdbReadDatabase("dbTestIoc.dbd", NULL, NULL);
+    dbTestIoc_registerRecordDeviceDriver(pdbbase);
+    testdbReadDatabase("dbLockTest.db", NULL, NULL);
+    testdbReadDatabase("dbChArrTest.db", NULL, NULL);
+
+    eltc(0);
+    testIocInitOk();
+    eltc(1);
+
+    testQueueSize();
+    testAdmission(1, 2);
+    testAdmission(4, 1);
+    testBatch();
+    testSnapshot();
+    testLatency();
+    testMinInterval();
+
+    testIocShutdownOk();
+
+    testdbCleanup();
+
+    epicsEventDestroy(gateOpen);
+    epicsEventDestroy(gateReached);
+
+    return testDone();
+}
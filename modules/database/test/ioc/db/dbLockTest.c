@@ -11,8 +11,10 @@
  */
 
 #include <stdlib.h>
+#include <string.h>
 
 #include "epicsSpin.h"
+#include "epicsEvent.h"
 #include "epicsMutex.h"
 #include "dbCommon.h"
 #include "epicsThread.h"
@@ -414,12 +416,194 @@ static void testLinkNOP(void)
     testdbCleanup();
 }
 
+typedef struct {
+    dbCommon *prec;
+    int shared;
+    epicsEventId locked, release, done;
+} lockerThread;
+
+static void lockerThreadFn(void *raw)
+{
+    lockerThread *pvt = raw;
+
+    if(pvt->shared)
+        dbScanLockRead(pvt->prec);
+    else
+        dbScanLock(pvt->prec);
+    epicsEventMustTrigger(pvt->locked);
+    epicsEventMustWait(pvt->release);
+    if(pvt->shared)
+        dbScanUnlockRead(pvt->prec);
+    else
+        dbScanUnlock(pvt->prec);
+    epicsEventMustTrigger(pvt->done);
+}
+
+static void startLocker(lockerThread *pvt, const char *rec, int shared)
+{
+    pvt->prec = testdbRecordPtr(rec);
+    pvt->shared = shared;
+    pvt->locked = epicsEventMustCreate(epicsEventEmpty);
+    pvt->release = epicsEventMustCreate(epicsEventEmpty);
+    pvt->done = epicsEventMustCreate(epicsEventEmpty);
+    epicsThreadMustCreate("locker", epicsThreadPriorityMedium,
+                          epicsThreadGetStackSize(epicsThreadStackSmall),
+                          &lockerThreadFn, pvt);
+}
+
+static void stopLocker(lockerThread *pvt)
+{
+    epicsEventMustTrigger(pvt->release);
+    epicsEventMustWait(pvt->done);
+    epicsEventDestroy(pvt->locked);
+    epicsEventDestroy(pvt->release);
+    epicsEventDestroy(pvt->done);
+}
+
+static void testSharedReaders(void)
+{
+    lockerThread reader, writer;
+    dbCommon *precB, *precC;
+
+    testDiag("Test shared (reader) locking of lock sets");
+
+    testdbPrepare();
+
+    testdbReadDatabase("dbTestIoc.dbd", NULL, NULL);
+    dbTestIoc_registerRecordDeviceDriver(pdbbase);
+    testdbReadDatabase("dbLockTest.db", NULL, NULL);
+
+    dbLockSharedReaders = 1;
+    eltc(0);
+    testIocInitOk();
+    eltc(1);
+
+    precB = testdbRecordPtr("recb");
+    precC = testdbRecordPtr("recc");
+    testOk1(precB->lset->plockSet==precC->lset->plockSet);
+
+    /* readers of records in the same lock set run together */
+    dbScanLockRead(precB);
+    startLocker(&reader, "recc", 1);
+    testOk(epicsEventWaitWithTimeout(reader.locked, 5.0)==epicsEventOK,
+           "second reader shares the lock set");
+    testIntOk1(precB->lset->plockSet->readers, ==, 2);
+
+    /* a writer waits for both readers to leave */
+    startLocker(&writer, "recb", 0);
+    testOk(epicsEventWaitWithTimeout(writer.locked, 0.2)==epicsEventWaitTimeout,
+           "writer excluded by readers");
+    stopLocker(&reader);
+    testOk(epicsEventWaitWithTimeout(writer.locked, 0.2)==epicsEventWaitTimeout,
+           "writer still excluded by one reader");
+    dbScanUnlockRead(precB);
+    testOk(epicsEventWaitWithTimeout(writer.locked, 5.0)==epicsEventOK,
+           "writer runs once the readers have left");
+
+    /* and readers wait for the writer */
+    startLocker(&reader, "recc", 1);
+    testOk(epicsEventWaitWithTimeout(reader.locked, 0.2)==epicsEventWaitTimeout,
+           "reader excluded by writer");
+    stopLocker(&writer);
+    testOk(epicsEventWaitWithTimeout(reader.locked, 5.0)==epicsEventOK,
+           "reader runs once the writer has left");
+    stopLocker(&reader);
+    testIntOk1(precB->lset->plockSet->readers, ==, 0);
+
+    /* the exclusive holder may also read */
+    dbScanLock(precB);
+    dbScanLockRead(precC);
+    dbScanLock(precC);
+    dbScanUnlock(precC);
+    dbScanUnlockRead(precC);
+    dbScanUnlock(precB);
+    testPass("reading and recursive locking by the exclusive holder");
+
+    /* lock set split and merge still work */
+    testdbPutFieldOk("recb.SDIS", DBR_STRING, "");
+    compareSets(0, "recb", "recc");
+    testdbPutFieldOk("recb.SDIS", DBR_STRING, "recc");
+    compareSets(1, "recb", "recc");
+
+    testIocShutdownOk();
+
+    testdbCleanup();
+    dbLockSharedReaders = 0;
+}
+
+static void testProfile(void)
+{
+    dbCommon *prec;
+    lockSet *ls;
+    lockerThread locker;
+
+    testDiag("Test lock set contention profile");
+
+    testdbPrepare();
+
+    testdbReadDatabase("dbTestIoc.dbd", NULL, NULL);
+    dbTestIoc_registerRecordDeviceDriver(pdbbase);
+    testdbReadDatabase("dbLockTest.db", NULL, NULL);
+
+    eltc(0);
+    testIocInitOk();
+    eltc(1);
+
+    prec = testdbRecordPtr("reca");
+    ls = prec->lset->plockSet;
+    dbLockResetProfile();
+    dbLockProfiling = 1;
+
+    dbScanLock(prec);
+    dbScanLock(prec);
+    epicsThreadSleep(0.05);
+    dbScanUnlock(prec);
+    dbScanUnlock(prec);
+
+    testOk(ls->profLocks==2, "%u acquisitions counted", (unsigned)ls->profLocks);
+    testOk(ls->profHoldMax>=40000000u && ls->profHold==ls->profHoldMax,
+           "one hold of %.3f ms", ls->profHoldMax*1e-6);
+    testOk(strcmp(ls->profHoldMaxThread, epicsThreadGetNameSelf())==0 &&
+           ls->profHoldMaxId==epicsThreadGetIdSelf(),
+           "held by \"%s\"", ls->profHoldMaxThread);
+    testOk1(ls->profDepth==0 && ls->profHolder==NULL);
+
+    testOk1(dbLockShowProfile(5, "max")==0);
+    testOk1(dbLockShowProfile(5, "bogus")==-1);
+
+    dbLockProfiling = 0;
+    dbScanLock(prec);
+    dbScanUnlock(prec);
+    testOk1(ls->profLocks==2);
+
+    dbLockResetProfile();
+    testOk1(ls->profLocks==0 && ls->profHoldMax==0 && !ls->profHoldMaxThread[0]);
+
+    testDiag("Reset while another thread holds the lock set");
+    dbLockProfiling = 1;
+    dbScanLock(prec);
+    dbScanUnlock(prec);
+    startLocker(&locker, "reca", 0);
+    epicsEventMustWait(locker.locked);
+    dbLockResetProfile();
+    testOk1(ls->profResetPending==1);
+    stopLocker(&locker);
+    testOk(ls->profLocks==0 && ls->profHoldMaxId!=NULL &&
+           strcmp(ls->profHoldMaxThread, "locker")==0,
+           "reset by the holder, held by \"%s\"", ls->profHoldMaxThread);
+    dbLockProfiling = 0;
+
+    testIocShutdownOk();
+
+    testdbCleanup();
+}
+
 MAIN(dbLockTest)
 {
 #ifdef LOCKSET_DEBUG
-    testPlan(100);
+    testPlan(124);
 #else
-    testPlan(88);
+    testPlan(112);
 #endif
     testSets();
     testSingleLock();
@@ -428,5 +612,7 @@ MAIN(dbLockTest)
     testLinkMake();
     testLinkChange();
     testLinkNOP();
+    testSharedReaders();
+    testProfile();
     return testDone();
 }
@@ -13,14 +13,20 @@
 #include <string.h>
 
 #include "dbScan.h"
+#include "epicsAtomic.h"
 #include "epicsEvent.h"
+#include "epicsThread.h"
 
 #include "dbUnitTest.h"
 #include "testMain.h"
 
 #include "dbAccess.h"
+#include "dbCommonPvt.h"
+#include "dbProfile.h"
 #include "errlog.h"
 
+#include "xRecord.h"
+
 void dbTestIoc_registerRecordDeviceDriver(struct dbBase *);
 
 static epicsEventId waiter;
@@ -66,9 +72,326 @@ static void testOnce(void)
     epicsEventDestroy(waiter);
 }
 
+static epicsEventId onceStarted, onceRelease;
+
+static void blockOnce(void *junk, dbCommon *prec)
+{
+    epicsEventMustTrigger(onceStarted);
+    epicsEventMustWait(onceRelease);
+}
+
+static int nOnceDone;
+
+static void onceDone(void *junk, dbCommon *prec)
+{
+    epicsAtomicIncrIntT(&nOnceDone);
+}
+
+static void testOnceQueue(void)
+{
+    scanOnceQueueStats stats;
+    scanOnceQueueExtStats ext;
+    dbCommon *precb, *precc;
+    int i, ok;
+
+    testDiag("check scanOnce queue growth and full-queue policies");
+    onceStarted = epicsEventMustCreate(epicsEventEmpty);
+    onceRelease = epicsEventMustCreate(epicsEventEmpty);
+
+    testdbPrepare();
+
+    testdbReadDatabase("dbTestIoc.dbd", NULL, NULL);
+    dbTestIoc_registerRecordDeviceDriver(pdbbase);
+    testdbReadDatabase("dbLockTest.db", NULL, NULL);
+
+    scanOnceSetQueueSize(4);
+    testOk1(scanOnceSetQueueLimit(8, "drop") == 0);
+    testOk1(scanOnceSetQueueLimit(8, "sideways") == -1);
+
+    eltc(0);
+    testIocInitOk();
+    eltc(1);
+
+    precb = testdbRecordPtr("recb");
+    precc = testdbRecordPtr("recc");
+
+    /* Stall the scanOnce thread */
+    scanOnceCallback(testdbRecordPtr("reca"), blockOnce, NULL);
+    epicsEventMustWait(onceStarted);
+
+    eltc(0);
+    for (ok = 0, i = 0; i < 9; i++)
+        if (!(i == 1 ? scanOnceCallback(precb, onceDone, NULL) :
+              scanOnce(precb)))
+            ok++;
+    eltc(1);
+    testOk(ok == 8, "%d of 9 requests queued", ok);
+    scanOnceQueueStatus(0, &stats);
+    scanOnceQueueExtStatus(&ext);
+    testOk(stats.size == 8 && ext.numGrowths == 1,
+        "queue size %d after %d growths", stats.size, ext.numGrowths);
+    testOk(dbRec2Pvt(precb)->dropCount == 1, "recb dropped %d requests",
+        dbRec2Pvt(precb)->dropCount);
+
+    scanOnceSetQueueLimit(8, "coalesce");
+    testOk(scanOnce(precb) == 0, "queued request coalesced");
+    testOk(scanOnceCallback(precb, onceDone, NULL) != 0,
+        "request with a completion not coalesced");
+    testOk(scanOnce(precc) != 0, "new request dropped");
+    scanOnceQueueExtStatus(&ext);
+    testOk(ext.numCoalesced == 1, "%d coalesced", ext.numCoalesced);
+
+    scanOnceSetQueueLimit(8, "dropOldest");
+    testOk(scanOnce(precc) == 0, "oldest request dropped instead");
+    testOk(dbRec2Pvt(precb)->dropCount == 3, "recb dropped %d requests",
+        dbRec2Pvt(precb)->dropCount);
+    testOk(scanOnce(precc) != 0,
+        "oldest request has a completion, new request dropped");
+
+    epicsEventMustTrigger(onceRelease);
+    for (i = 0; i < 50 && !epicsAtomicGetIntT(&nOnceDone); i++)
+        epicsThreadSleep(0.1);
+    testOk(nOnceDone == 1, "queued completion called %d times", nOnceDone);
+
+    testIocShutdownOk();
+
+    testdbCleanup();
+    epicsEventDestroy(onceStarted);
+    epicsEventDestroy(onceRelease);
+}
+
+epicsShareExtern int scanOnceCoalesce;
+
+static int nprocb;
+
+static void countProcB(xRecord *prec)
+{
+    testGlobalLock();
+    nprocb++;
+    testGlobalUnlock();
+}
+
+static void signalOnce(void *junk, dbCommon *prec)
+{
+    epicsEventMustTrigger(onceStarted);
+}
+
+static void testOnceCoalesce(void)
+{
+    scanOnceQueueStats stats;
+    scanOnceQueueExtStats ext;
+    dbCommon *precb;
+    int i, ok, coalesced;
+
+    testDiag("check scanOnce folds requests for queued records");
+    onceStarted = epicsEventMustCreate(epicsEventEmpty);
+    onceRelease = epicsEventMustCreate(epicsEventEmpty);
+    scanOnceCoalesce = 1;
+
+    testdbPrepare();
+
+    testdbReadDatabase("dbTestIoc.dbd", NULL, NULL);
+    dbTestIoc_registerRecordDeviceDriver(pdbbase);
+    testdbReadDatabase("dbLockTest.db", NULL, NULL);
+
+    eltc(0);
+    testIocInitOk();
+    eltc(1);
+
+    precb = testdbRecordPtr("recb");
+    ((xRecord *)precb)->clbk = countProcB;
+
+    scanOnceQueueExtStatus(&ext);
+    coalesced = ext.numCoalesced;
+
+    scanOnceCallback(testdbRecordPtr("reca"), blockOnce, NULL);
+    epicsEventMustWait(onceStarted);
+
+    for (ok = 0, i = 0; i < 10; i++)
+        if (!scanOnce(precb))
+            ok++;
+    testOk(ok == 10, "%d of 10 requests accepted", ok);
+    /* completions are chained onto the queued request */
+    epicsAtomicSetIntT(&nOnceDone, 0);
+    for (i = 0; i < 3; i++)
+        scanOnceCallback(precb, onceDone, NULL);
+    scanOnceQueueStatus(0, &stats);
+    scanOnceQueueExtStatus(&ext);
+    testOk(stats.numUsed == 1, "%d requests queued", stats.numUsed);
+    testOk(ext.numCoalesced - coalesced == 12, "%d requests coalesced",
+        ext.numCoalesced - coalesced);
+
+    epicsEventMustTrigger(onceRelease);
+    scanOnceCallback(testdbRecordPtr("recc"), signalOnce, NULL);
+    epicsEventMustWait(onceStarted);
+    testGlobalLock();
+    testOk(nprocb == 1, "recb processed %d times", nprocb);
+    testGlobalUnlock();
+    testOk(nOnceDone == 3, "%d chained completions called", nOnceDone);
+
+    /* Once processed the record can be queued again */
+    scanOnce(precb);
+    scanOnceCallback(testdbRecordPtr("recc"), signalOnce, NULL);
+    epicsEventMustWait(onceStarted);
+    testGlobalLock();
+    testOk(nprocb == 2, "recb processed %d times", nprocb);
+    testGlobalUnlock();
+
+    testIocShutdownOk();
+
+    testdbCleanup();
+    scanOnceCoalesce = 0;
+    epicsEventDestroy(onceStarted);
+    epicsEventDestroy(onceRelease);
+}
+
+#define NPERIODIC 4
+
+static int nproc[NPERIODIC];
+static epicsThreadId procThread[NPERIODIC];
+
+static void countProc(xRecord *prec)
+{
+    int i = prec->name[3] - '1';
+
+    testGlobalLock();
+    nproc[i]++;
+    procThread[i] = epicsThreadGetIdSelf();
+    testGlobalUnlock();
+}
+
+static void testPeriodicWorkers(void)
+{
+    int i, done, tries;
+    int nthreads = 0;
+    epicsThreadId threads[NPERIODIC];
+
+    testDiag("check scanPeriodicWorkers() splits a periodic list");
+
+    testdbPrepare();
+
+    testdbReadDatabase("dbTestIoc.dbd", NULL, NULL);
+    dbTestIoc_registerRecordDeviceDriver(pdbbase);
+    testdbReadDatabase("dbScanTest.db", NULL, NULL);
+
+    testOk1(scanPeriodicWorkers(2, "no such rate") == -1);
+    testOk1(scanPeriodicWorkers(2, ".1 second") == 0);
+
+    for (i = 0; i < NPERIODIC; i++) {
+        char name[8];
+
+        sprintf(name, "per%d", i + 1);
+        ((xRecord *)testdbRecordPtr(name))->clbk = countProc;
+    }
+
+    eltc(0);
+    testIocInitOk();
+    eltc(1);
+
+    testOk1(scanPeriodicWorkers(2, ".1 second") == -1);
+
+    for (tries = 0; tries < 100; tries++) {
+        epicsThreadSleep(0.1);
+        testGlobalLock();
+        for (done = 1, i = 0; i < NPERIODIC; i++)
+            done &= (nproc[i] >= 2);
+        testGlobalUnlock();
+        if (done) break;
+    }
+
+    testIocShutdownOk();
+
+    testGlobalLock();
+    for (i = 0; i < NPERIODIC; i++) {
+        int j;
+
+        testOk(nproc[i] >= 2, "per%d processed %d times", i + 1, nproc[i]);
+        for (j = 0; j < nthreads; j++)
+            if (threads[j] == procThread[i]) break;
+        if (j == nthreads && procThread[i])
+            threads[nthreads++] = procThread[i];
+    }
+    testGlobalUnlock();
+    testOk(nthreads == 2, "processed by %d threads", nthreads);
+
+    testdbCleanup();
+}
+
+static void slowProc(xRecord *prec)
+{
+    epicsThreadSleep(0.01);
+}
+
+static void testProfile(void)
+{
+    dbCommon *preca;
+    dbProcessProfile prof;
+    unsigned i, nhist = 0;
+
+    testDiag("check dbProcessProfiling times record processing");
+    onceStarted = epicsEventMustCreate(epicsEventEmpty);
+
+    testdbPrepare();
+
+    testdbReadDatabase("dbTestIoc.dbd", NULL, NULL);
+    dbTestIoc_registerRecordDeviceDriver(pdbbase);
+    testdbReadDatabase("dbLockTest.db", NULL, NULL);
+
+    eltc(0);
+    testIocInitOk();
+    eltc(1);
+
+    preca = testdbRecordPtr("reca");
+    ((xRecord *)preca)->clbk = slowProc;
+
+    scanOnceCallback(preca, signalOnce, NULL);
+    epicsEventMustWait(onceStarted);
+    testOk(dbProcessProfileGet(preca, &prof) == -1, "no profile while off");
+
+    dbProcessProfiling = 1;
+    scanOnceCallback(preca, signalOnce, NULL);
+    epicsEventMustWait(onceStarted);
+    dbProcessProfiling = 0;
+
+    testOk1(dbProcessProfileGet(preca, &prof) == 0);
+    testOk(prof.count == 1, "timed %u calls", (unsigned)prof.count);
+    testOk(prof.max >= 10000000u && prof.self <= prof.total,
+        "max %.3f ms, self %.3f ms, total %.3f ms",
+        prof.max * 1e-6, prof.self * 1e-6, prof.total * 1e-6);
+    for (i = 0; i < DBPROF_NBUCKETS; i++)
+        nhist += prof.hist[i];
+    testOk(nhist == 1, "%u histogram entries", nhist);
+    testOk(prof.delayCount == 1, "timed %u scan requests",
+        (unsigned)prof.delayCount);
+    testdbGetFieldEqual("reca.PTIM", DBF_DOUBLE, prof.total * 1e-3);
+
+    /* a request which doesn't reach process() isn't timed */
+    dbProcessProfiling = 1;
+    preca->pact = 1;
+    scanOnceCallback(preca, signalOnce, NULL);
+    epicsEventMustWait(onceStarted);
+    preca->pact = 0;
+    dbProcessProfiling = 0;
+    testOk(dbRec2Pvt(preca)->profRequested == 0 &&
+        dbProcessProfileGet(preca, &prof) == 0 && prof.delayCount == 1,
+        "request to an active record cleared");
+
+    dbtopReset();
+    testOk1(dbProcessProfileGet(preca, &prof) == 0 && prof.count == 0);
+
+    testIocShutdownOk();
+
+    testdbCleanup();
+    epicsEventDestroy(onceStarted);
+}
+
 MAIN(dbScanTest)
 {
-    testPlan(3);
+    testPlan(39);
     testOnce();
+    testOnceQueue();
+    testOnceCoalesce();
+    testPeriodicWorkers();
+    testProfile();
     return testDone();
 }
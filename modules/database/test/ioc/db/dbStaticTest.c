@@ -290,11 +290,32 @@ static void testDbVerify(const char *record)
     dbFinishEntry(&entry);
 }
 
+static void testPvdGeneration(void)
+{
+    DBENTRY entry;
+    int gen = dbPvdGeneration();
+
+    testDiag("testPvdGeneration()");
+
+    dbInitEntry(pdbbase, &entry);
+    testOk1(dbFindRecord(&entry, "testgen")!=0);
+    testOk1(dbPvdGeneration()==gen);
+
+    testOk1(dbFindRecordType(&entry, "x")==0);
+    testOk1(dbCreateRecord(&entry, "testgen")==0);
+    testOk(dbPvdGeneration()!=gen, "Changed by dbCreateRecord()");
+
+    gen = dbPvdGeneration();
+    testOk1(dbCreateAlias(&entry, "testgenalias")==0);
+    testOk(dbPvdGeneration()!=gen, "Changed by dbCreateAlias()");
+    dbFinishEntry(&entry);
+}
+
 void dbTestIoc_registerRecordDeviceDriver(struct dbBase *);
 
 MAIN(dbStaticTest)
 {
-    testPlan(310);
+    testPlan(317);
     testdbPrepare();
 
     testdbReadDatabase("dbTestIoc.dbd", NULL, NULL);
@@ -313,6 +334,7 @@ MAIN(dbStaticTest)
     testRec2Entry("testalias");
     testRec2Entry("testalias2");
     testRec2Entry("testalias3");
+    testPvdGeneration();
 
     eltc(0);
     testIocInitOk();
@@ -25,6 +25,7 @@ int dbServerTest(void);
 int dbCaStatsTest(void);
 int dbShutdownTest(void);
 int dbScanTest(void);
+int dbEventQueueTest(void);
 int scanIoTest(void);
 int dbLockTest(void);
 int dbPutLinkTest(void);
@@ -47,6 +48,7 @@ void epicsRunDbTests(void)
     runTest(dbCaStatsTest);
     runTest(dbShutdownTest);
     runTest(dbScanTest);
+    runTest(dbEventQueueTest);
     runTest(scanIoTest);
     runTest(dbLockTest);
     runTest(dbPutLinkTest);
@@ -0,0 +1,89 @@
+/*************************************************************************\
+* EPICS BASE is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+
+/*
+ *  Test the minimum interval filter, which only configures the channel.
+ *  The holding back of updates is tested in dbEventQueueTest.
+ */
+
+#include <string.h>
+
+#include "dbStaticLib.h"
+#include "dbAccessDefs.h"
+#include "db_field_log.h"
+#include "dbCommon.h"
+#include "dbChannel.h"
+#include "dbEvent.h"
+#include "registry.h"
+#include "chfPlugin.h"
+#include "errlog.h"
+#include "dbmf.h"
+#include "epicsUnitTest.h"
+#include "dbUnitTest.h"
+#include "testMain.h"
+
+void filterTest_registerRecordDeviceDriver(struct dbBase *);
+
+static void testInterval(const char *name, double t)
+{
+    dbChannel *pch;
+
+    testDiag("Channel %s", name);
+
+    pch = dbChannelCreate(name);
+    testOk(!!pch, "dbChannel created");
+    if (!pch)
+        return;
+
+    testOk(!dbChannelOpen(pch), "dbChannel opened");
+    testOk(ellCount(&pch->pre_chain) == 0 && ellCount(&pch->post_chain) == 0,
+        "ival adds no filter to the chains");
+    testOk(pch->min_interval == t, "min_interval = %g", pch->min_interval);
+
+    dbChannelDelete(pch);
+}
+
+MAIN(ivalTest)
+{
+    const chFilterPlugin *plug;
+    char myname[] = "ival";
+
+    testPlan(20);
+
+    testdbPrepare();
+
+    testdbReadDatabase("filterTest.dbd", NULL, NULL);
+
+    filterTest_registerRecordDeviceDriver(pdbbase);
+
+    testdbReadDatabase("xRecord.db", NULL, NULL);
+
+    eltc(0);
+    testIocInitOk();
+    eltc(1);
+
+    testOk(!!(plug = dbFindFilter(myname, strlen(myname))),
+        "plugin '%s' registered correctly", myname);
+
+    /* Bad parms */
+    testOk(!dbChannelCreate("x.VAL{ival:{}}"),
+           "dbChannel with ival (no parm) failed");
+    testOk(!dbChannelCreate("x.VAL{ival:{t:-1}}"),
+           "dbChannel with ival (t=-1) failed");
+    testOk(!dbChannelCreate("x.VAL{ival:{t:\"x\"}}"),
+           "dbChannel with ival (t=\"x\") failed");
+
+    testInterval("x.VAL", 0.0);
+    testInterval("x.VAL{ival:{t:0.5}}", 0.5);
+    testInterval("x.VAL{ival:{t:2}}", 2.0);
+    /* The longer interval wins */
+    testInterval("x.VAL{ival:{t:0.5},ival:{t:0.25}}", 0.5);
+
+    testIocShutdownOk();
+
+    testdbCleanup();
+
+    return testDone();
+}
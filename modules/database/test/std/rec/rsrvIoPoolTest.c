@@ -0,0 +1,207 @@
+/*************************************************************************\
+* EPICS Base is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+/*
+ * Loopback test of the RSRV I/O thread pool (rsrvIoThreads).
+ *
+ * Put callback requests to an asynchronous record wait for the previous
+ * one to complete without a pool thread, large array replies back up
+ * the send queue of the non-blocking socket.
+ *
+ * A CA client in the IOC's process would reach the records without the
+ * server, so the IOC runs in a child process.  The pool needs epoll, so
+ * this only runs on Linux.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__linux__)
+#  include <signal.h>
+#  include <unistd.h>
+#  include <sys/wait.h>
+#endif
+
+#include "dbUnitTest.h"
+#include "envDefs.h"
+#include "epicsAtomic.h"
+#include "epicsEvent.h"
+#include "epicsThread.h"
+#include "errlog.h"
+#include "iocInit.h"
+#include "iocsh.h"
+#include "testMain.h"
+
+/* after the database headers */
+#include "cadef.h"
+#include "db_access_routines.h"
+
+#define NPUTS 50
+#define NGETS 100
+#define NBIG 100000
+#define NSMALL 8000
+
+void recTestIoc_registerRecordDeviceDriver(struct dbBase *);
+
+static epicsEventId done;
+static int nPutsDone, nPutsFailed;
+static int nGetsDone, nGetsFailed;
+
+static void putDone(struct event_handler_args args)
+{
+    if (args.status != ECA_NORMAL)
+        epicsAtomicIncrIntT(&nPutsFailed);
+    if (epicsAtomicIncrIntT(&nPutsDone) == NPUTS)
+        epicsEventMustTrigger(done);
+}
+
+static void getDone(struct event_handler_args args)
+{
+    const double *pval = (const double *) args.dbr;
+    long i;
+
+    if (args.status != ECA_NORMAL || args.count != (long) (size_t) args.usr) {
+        epicsAtomicIncrIntT(&nGetsFailed);
+    }
+    else {
+        for (i = 0; i < args.count; i++) {
+            if (pval[i] != (double) i) {
+                epicsAtomicIncrIntT(&nGetsFailed);
+                break;
+            }
+        }
+    }
+    /* a slow reader, so the server's send queue fills */
+    epicsThreadSleep(0.01);
+
+    if (epicsAtomicIncrIntT(&nGetsDone) == NGETS)
+        epicsEventMustTrigger(done);
+}
+
+#if defined(__linux__)
+
+static void runIoc(void)
+{
+    /* keep the IOC's output out of the test's */
+    if (!freopen("/dev/null", "w", stdout))
+        exit(1);
+    eltc(0);
+
+    testdbPrepare();
+    testdbReadDatabase("recTestIoc.dbd", NULL, NULL);
+    recTestIoc_registerRecordDeviceDriver(pdbbase);
+    testdbReadDatabase("rsrvIoPoolTest.db", NULL, NULL);
+
+    iocshCmd("var rsrvIoThreads 2");
+
+    /* not testIocInitOk(), which leaves out the CA server */
+    if (iocInit())
+        exit(1);
+
+    /* The CA server can't be stopped, the test kills this process */
+    while (getppid() != 1)
+        epicsThreadSleep(1.0);
+    exit(0);
+}
+
+MAIN(rsrvIoPoolTest)
+{
+    chid async, big;
+    double *pbuf;
+    double val = 0.0;
+    pid_t ioc;
+    int i;
+
+    epicsEnvSet("EPICS_CA_AUTO_ADDR_LIST", "NO");
+    epicsEnvSet("EPICS_CA_ADDR_LIST", "127.0.0.1");
+    epicsEnvSet("EPICS_CAS_INTF_ADDR_LIST", "127.0.0.1");
+    epicsEnvSet("EPICS_CA_SERVER_PORT", "25064");
+    epicsEnvSet("EPICS_CAS_BEACON_PORT", "25065");
+    epicsEnvSet("EPICS_CA_MAX_ARRAY_BYTES", "1000000");
+
+    /* before any threads are started */
+    fflush(stdout);
+    ioc = fork();
+    if (ioc == 0)
+        runIoc();
+
+    testPlan(11);
+
+    testOk(ioc > 0, "IOC started");
+    if (ioc < 0)
+        testAbort("fork() failed");
+
+    done = epicsEventMustCreate(epicsEventEmpty);
+
+    testOk1(ca_context_create(ca_enable_preemptive_callback) == ECA_NORMAL);
+    ca_create_channel("pool:async", NULL, NULL, CA_PRIORITY_DEFAULT, &async);
+    ca_create_channel("pool:big", NULL, NULL, CA_PRIORITY_DEFAULT, &big);
+    if (ca_pend_io(10.0) != ECA_NORMAL) {
+        kill(ioc, SIGKILL);
+        testAbort("Channels not connected");
+    }
+
+    testDiag("Put callback requests queue up behind an asynchronous record");
+
+    for (i = 1; i <= NPUTS; i++) {
+        val = i;
+        ca_array_put_callback(DBR_DOUBLE, 1, async, &val, putDone, NULL);
+    }
+    ca_flush_io();
+
+    testOk(epicsEventWaitWithTimeout(done, 30.0) == epicsEventOK,
+        "Put callbacks completed");
+    testOk(epicsAtomicGetIntT(&nPutsDone) == NPUTS,
+        "%d of %d put callbacks", epicsAtomicGetIntT(&nPutsDone), NPUTS);
+    testOk(epicsAtomicGetIntT(&nPutsFailed) == 0,
+        "%d put callbacks failed", epicsAtomicGetIntT(&nPutsFailed));
+
+    val = 0.0;
+    testOk1(ca_get(DBR_DOUBLE, async, &val) == ECA_NORMAL &&
+        ca_pend_io(10.0) == ECA_NORMAL);
+    testOk(val == NPUTS, "Last value %g written", val);
+
+    testDiag("Large arrays back up the send queue");
+
+    pbuf = (double *) malloc(NBIG * sizeof(double));
+    for (i = 0; i < NBIG; i++)
+        pbuf[i] = i;
+    testOk1(ca_array_put(DBR_DOUBLE, NBIG, big, pbuf) == ECA_NORMAL);
+    free(pbuf);
+
+    /* streamed replies, and replies of a few buffers each */
+    for (i = 0; i < NGETS; i++) {
+        size_t count = i % 10 ? NSMALL : NBIG;
+
+        ca_array_get_callback(DBR_DOUBLE, count, big, getDone,
+            (void *) count);
+    }
+    ca_flush_io();
+
+    testOk(epicsEventWaitWithTimeout(done, 30.0) == epicsEventOK,
+        "Array gets completed");
+    testOk(epicsAtomicGetIntT(&nGetsDone) == NGETS,
+        "%d of %d array gets", epicsAtomicGetIntT(&nGetsDone), NGETS);
+    testOk(epicsAtomicGetIntT(&nGetsFailed) == 0,
+        "%d array gets failed", epicsAtomicGetIntT(&nGetsFailed));
+
+    ca_context_destroy();
+
+    kill(ioc, SIGKILL);
+    waitpid(ioc, NULL, 0);
+
+    return testDone();
+}
+
+#else /* __linux__ */
+
+MAIN(rsrvIoPoolTest)
+{
+    testPlan(1);
+    testSkip(1, "rsrvIoThreads needs epoll");
+    return testDone();
+}
+
+#endif /* __linux__ */
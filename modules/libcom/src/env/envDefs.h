@@ -54,6 +54,10 @@ LIBCOM_API extern const ENV_PARAM EPICS_CA_AUTO_ARRAY_BYTES;
 LIBCOM_API extern const ENV_PARAM EPICS_CA_MAX_SEARCH_PERIOD;
 LIBCOM_API extern const ENV_PARAM EPICS_CA_NAME_SERVERS;
 LIBCOM_API extern const ENV_PARAM EPICS_CA_MCAST_TTL;
+LIBCOM_API extern const ENV_PARAM EPICS_CA_USE_SHM;
+LIBCOM_API extern const ENV_PARAM EPICS_CA_IO_THREADS;
+LIBCOM_API extern const ENV_PARAM EPICS_CA_NAME_CACHE;
+LIBCOM_API extern const ENV_PARAM EPICS_CA_TCP_BLOCK_BYTES;
 LIBCOM_API extern const ENV_PARAM EPICS_CAS_INTF_ADDR_LIST;
 LIBCOM_API extern const ENV_PARAM EPICS_CAS_IGNORE_ADDR_LIST;
 LIBCOM_API extern const ENV_PARAM EPICS_CAS_AUTO_BEACON_ADDR_LIST;
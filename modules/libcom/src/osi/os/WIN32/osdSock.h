@@ -56,6 +56,7 @@ typedef DWORD osiSockOptMcastTTL_t;
 #define SOCK_EADDRNOTAVAIL WSAEADDRNOTAVAIL
 #define SOCK_ECONNREFUSED WSAECONNREFUSED
 #define SOCK_ECONNABORTED WSAECONNABORTED
+#define SOCK_ENOTCONN WSAENOTCONN
 #define SOCK_EINPROGRESS WSAEINPROGRESS
 #define SOCK_EISCONN WSAEISCONN
 #define SOCK_EALREADY WSAEALREADY
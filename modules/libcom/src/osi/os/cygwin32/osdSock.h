@@ -61,6 +61,7 @@ typedef int osiSockOptMcastTTL_t;
 #define SOCK_EADDRNOTAVAIL EADDRNOTAVAIL
 #define SOCK_ECONNREFUSED ECONNREFUSED
 #define SOCK_ECONNABORTED ECONNABORTED
+#define SOCK_ENOTCONN ENOTCONN
 #define SOCK_EINPROGRESS EINPROGRESS
 #define SOCK_EISCONN EISCONN
 #define SOCK_EALREADY EALREADY